@@ -3,6 +3,7 @@
 #include <QFont>
 #include <algorithm>
 #include <limits>
+#include <cmath>
 #include <QTextStream>
 #include <QDesktopServices>
 #include <QUrl>
@@ -13,6 +14,9 @@
 #include <QDialog>
 #include <QVBoxLayout>
 #include <QTextEdit>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrentRun>
+#include <memory>
 
 EstadisticasWindow::EstadisticasWindow(QWidget *parent)
     : QMainWindow(parent),
@@ -20,7 +24,7 @@ EstadisticasWindow::EstadisticasWindow(QWidget *parent)
 {
     configurarInterfaz();
     setWindowTitle("Estadísticas de Algoritmos de Calendarización");
-    resize(800, 700);
+    resize(800, 950);
 }
 
 void EstadisticasWindow::configurarInterfaz()
@@ -52,9 +56,15 @@ void EstadisticasWindow::configurarInterfaz()
     
     checkFIFO = new QCheckBox("First In First Out (FIFO)", this);
     checkRoundRobin = new QCheckBox("Round Robin", this);
+    checkRRAdaptativo = new QCheckBox("Round Robin Adaptativo", this);
     checkSJF = new QCheckBox("Shortest Job First (SJF)", this);
     checkPriority = new QCheckBox("Priority Scheduling", this);
     checkSRT = new QCheckBox("Shortest Remaining Time (SRT)", this);
+    checkPreemptivePriority = new QCheckBox("Preemptive Priority (Aging)", this);
+    checkMLFQ = new QCheckBox("Multilevel Feedback Queue (MLFQ)", this);
+    checkCFS = new QCheckBox("Completely Fair Scheduler (CFS)", this);
+    checkLottery = new QCheckBox("Lottery Scheduling", this);
+    checkStride = new QCheckBox("Stride Scheduling", this);
     
     // Por defecto, seleccionar algunos algoritmos
     checkFIFO->setChecked(true);
@@ -62,11 +72,17 @@ void EstadisticasWindow::configurarInterfaz()
     
     layoutAlgoritmos->addWidget(checkFIFO);
     layoutAlgoritmos->addWidget(checkRoundRobin);
+    layoutAlgoritmos->addWidget(checkRRAdaptativo);
     layoutAlgoritmos->addWidget(checkSJF);
     layoutAlgoritmos->addWidget(checkPriority);
     layoutAlgoritmos->addWidget(checkSRT);
+    layoutAlgoritmos->addWidget(checkPreemptivePriority);
+    layoutAlgoritmos->addWidget(checkMLFQ);
+    layoutAlgoritmos->addWidget(checkCFS);
+    layoutAlgoritmos->addWidget(checkLottery);
+    layoutAlgoritmos->addWidget(checkStride);
     
-    // Control de Quantum para Round Robin
+    // Control de Quantum para Round Robin, Lottery y Stride
     QHBoxLayout *layoutQuantum = new QHBoxLayout();
     labelQuantum = new QLabel("Quantum:", this);
     spinQuantum = new QSpinBox(this);
@@ -77,13 +93,146 @@ void EstadisticasWindow::configurarInterfaz()
     labelQuantum->setVisible(false);
     spinQuantum->setVisible(false);
     
+    // Semilla de Lottery (misma semilla = mismo sorteo)
+    labelSemilla = new QLabel("Semilla:", this);
+    spinSemilla = new QSpinBox(this);
+    spinSemilla->setRange(0, 1000000);
+    spinSemilla->setValue(1);
+    labelSemilla->setVisible(false);
+    spinSemilla->setVisible(false);
+    
     layoutQuantum->addWidget(labelQuantum);
     layoutQuantum->addWidget(spinQuantum);
+    // Round Robin adaptativo: quantum = percentil del restante en la cola ready
+    labelPercentil = new QLabel("Percentil del restante:", this);
+    spinPercentil = new QSpinBox(this);
+    spinPercentil->setRange(1, 100);
+    spinPercentil->setValue(50);
+    labelPercentil->setVisible(false);
+    spinPercentil->setVisible(false);
+    
+    layoutQuantum->addWidget(labelPercentil);
+    layoutQuantum->addWidget(spinPercentil);
+    layoutQuantum->addWidget(labelSemilla);
+    layoutQuantum->addWidget(spinSemilla);
     layoutQuantum->addStretch();
     
     layoutAlgoritmos->addLayout(layoutQuantum);
     
-    connect(checkRoundRobin, &QCheckBox::toggled, this, &EstadisticasWindow::onRoundRobinToggled);
+    // Control de envejecimiento para Preemptive Priority (0 = sin aging)
+    QHBoxLayout *layoutEnvejecimiento = new QHBoxLayout();
+    labelEnvejecimiento = new QLabel("Envejecimiento (ciclos):", this);
+    spinEnvejecimiento = new QSpinBox(this);
+    spinEnvejecimiento->setRange(0, 1000);
+    spinEnvejecimiento->setValue(5);
+    spinEnvejecimiento->setToolTip("Cada tantos ciclos de espera el proceso sube al siguiente valor de prioridad "
+                                   "presente en la carga (no resta 1 al valor); 0 = sin aging");
+    
+    labelEnvejecimiento->setVisible(false);
+    spinEnvejecimiento->setVisible(false);
+    
+    layoutEnvejecimiento->addWidget(labelEnvejecimiento);
+    layoutEnvejecimiento->addWidget(spinEnvejecimiento);
+    layoutEnvejecimiento->addStretch();
+    
+    layoutAlgoritmos->addLayout(layoutEnvejecimiento);
+    
+    // Controles de MLFQ: quantums por nivel y boost (0 = sin boost)
+    QHBoxLayout *layoutMLFQ = new QHBoxLayout();
+    labelQuantumsMLFQ = new QLabel("Quantums por nivel:", this);
+    lineEditQuantumsMLFQ = new QLineEdit("2,4,8", this);
+    labelBoost = new QLabel("Boost cada (ciclos):", this);
+    spinBoost = new QSpinBox(this);
+    spinBoost->setRange(0, 10000);
+    spinBoost->setValue(50);
+    
+    labelQuantumsMLFQ->setVisible(false);
+    lineEditQuantumsMLFQ->setVisible(false);
+    labelBoost->setVisible(false);
+    spinBoost->setVisible(false);
+    
+    layoutMLFQ->addWidget(labelQuantumsMLFQ);
+    layoutMLFQ->addWidget(lineEditQuantumsMLFQ);
+    layoutMLFQ->addWidget(labelBoost);
+    layoutMLFQ->addWidget(spinBoost);
+    layoutMLFQ->addStretch();
+    
+    layoutAlgoritmos->addLayout(layoutMLFQ);
+    
+    // Controles de CFS: latencia objetivo y granularidad mínima (ciclos)
+    QHBoxLayout *layoutCFS = new QHBoxLayout();
+    labelLatencia = new QLabel("Latencia objetivo:", this);
+    spinLatencia = new QSpinBox(this);
+    spinLatencia->setRange(1, 1000);
+    spinLatencia->setValue(6);
+    labelGranularidad = new QLabel("Granularidad mínima:", this);
+    spinGranularidad = new QSpinBox(this);
+    spinGranularidad->setRange(1, 100);
+    spinGranularidad->setValue(1);
+    
+    labelLatencia->setVisible(false);
+    spinLatencia->setVisible(false);
+    labelGranularidad->setVisible(false);
+    spinGranularidad->setVisible(false);
+    
+    layoutCFS->addWidget(labelLatencia);
+    layoutCFS->addWidget(spinLatencia);
+    layoutCFS->addWidget(labelGranularidad);
+    layoutCFS->addWidget(spinGranularidad);
+    layoutCFS->addStretch();
+    
+    layoutAlgoritmos->addLayout(layoutCFS);
+
+    // Ráfagas CPU/E/S: todas las políticas sobre el motor con dispositivos
+    QHBoxLayout *layoutES = new QHBoxLayout();
+    checkRafagasES = new QCheckBox("Ráfagas de E/S", this);
+    labelDisciplinaES = new QLabel("Cola de E/S:", this);
+    comboDisciplinaES = new QComboBox(this);
+    comboDisciplinaES->addItems({ "FCFS", "Prioridad" });
+
+    labelDisciplinaES->setVisible(false);
+    comboDisciplinaES->setVisible(false);
+
+    layoutES->addWidget(checkRafagasES);
+    layoutES->addWidget(labelDisciplinaES);
+    layoutES->addWidget(comboDisciplinaES);
+    layoutES->addStretch();
+
+    layoutAlgoritmos->addLayout(layoutES);
+
+    // Costo de cambio de contexto: con costo > 0 todas las políticas corren
+    // en el motor, que lo cobra en cada despacho
+    QHBoxLayout *layoutCambio = new QHBoxLayout();
+    labelCambioContexto = new QLabel("Cambio de contexto (ciclos):", this);
+    spinCambioContexto = new QSpinBox(this);
+    spinCambioContexto->setRange(0, 100);
+    spinCambioContexto->setValue(0);
+    labelCambioMismo = new QLabel("Mismo proceso (ciclos):", this);
+    spinCambioMismo = new QSpinBox(this);
+    spinCambioMismo->setRange(0, 100);
+    spinCambioMismo->setValue(0);
+
+    layoutCambio->addWidget(labelCambioContexto);
+    layoutCambio->addWidget(spinCambioContexto);
+    layoutCambio->addWidget(labelCambioMismo);
+    layoutCambio->addWidget(spinCambioMismo);
+    layoutCambio->addStretch();
+
+    layoutAlgoritmos->addLayout(layoutCambio);
+
+    // Solo agregados: el motor acumula percentiles al terminar cada proceso y
+    // no arma el vector de resultados (ni el detalle por proceso del CSV)
+    checkSoloAgregados = new QCheckBox("Solo agregados (sin detalle por proceso)", this);
+    layoutAlgoritmos->addWidget(checkSoloAgregados);
+    
+    connect(checkRoundRobin, &QCheckBox::toggled, this, &EstadisticasWindow::onAlgoritmoConQuantumToggled);
+    connect(checkStride, &QCheckBox::toggled, this, &EstadisticasWindow::onAlgoritmoConQuantumToggled);
+    connect(checkLottery, &QCheckBox::toggled, this, &EstadisticasWindow::onLotteryToggled);
+    connect(checkRRAdaptativo, &QCheckBox::toggled, this, &EstadisticasWindow::onRRAdaptativoToggled);
+    connect(checkPreemptivePriority, &QCheckBox::toggled, this, &EstadisticasWindow::onPreemptivePriorityToggled);
+    connect(checkMLFQ, &QCheckBox::toggled, this, &EstadisticasWindow::onMLFQToggled);
+    connect(checkCFS, &QCheckBox::toggled, this, &EstadisticasWindow::onCFSToggled);
+    connect(checkRafagasES, &QCheckBox::toggled, this, &EstadisticasWindow::onRafagasESToggled);
     
     layoutPrincipal->addWidget(grupoAlgoritmos);
     
@@ -139,22 +288,167 @@ void EstadisticasWindow::configurarInterfaz()
     
     layoutPrincipal->addWidget(grupoResultados);
     
+    configurarBarrido();
+    layoutPrincipal->addWidget(grupoBarrido);
+    
+    configurarReplicas();
+    layoutPrincipal->addWidget(grupoReplicas);
+    
+    configurarModelo();
+    layoutPrincipal->addWidget(grupoModelo);
+    
     setCentralWidget(central);
 }
 
+void EstadisticasWindow::configurarBarrido()
+{
+    // --- Grupo: Barrido de quantum (Round Robin) ---
+    grupoBarrido = new QGroupBox("Barrido de Quantum (Round Robin)", this);
+    QVBoxLayout *layoutBarrido = new QVBoxLayout(grupoBarrido);
+    
+    QHBoxLayout *layoutParametros = new QHBoxLayout();
+    spinQuantumDesde = new QSpinBox(this);
+    spinQuantumDesde->setRange(1, 10000);
+    spinQuantumDesde->setValue(1);
+    spinQuantumHasta = new QSpinBox(this);
+    spinQuantumHasta->setRange(1, 10000);
+    spinQuantumHasta->setValue(20);
+    lineEditCostosCambio = new QLineEdit("0", this);
+    lineEditCostosCambio->setToolTip("Costos de cambio de contexto separados por coma, p. ej. 0,1,2");
+    btnBarrido = new QPushButton("Ejecutar barrido", this);
+    
+    layoutParametros->addWidget(new QLabel("Quantum desde:", this));
+    layoutParametros->addWidget(spinQuantumDesde);
+    layoutParametros->addWidget(new QLabel("hasta:", this));
+    layoutParametros->addWidget(spinQuantumHasta);
+    layoutParametros->addWidget(new QLabel("Costo de cambio:", this));
+    layoutParametros->addWidget(lineEditCostosCambio);
+    layoutParametros->addWidget(btnBarrido);
+    layoutBarrido->addLayout(layoutParametros);
+    
+    tablaBarrido = new QTableWidget(0, 5, this);
+    QStringList headers;
+    headers << "Quantum" << "Costo de Cambio" << "Espera Promedio" << "Turnaround Promedio" << "Cambios de Contexto";
+    tablaBarrido->setHorizontalHeaderLabels(headers);
+    tablaBarrido->horizontalHeader()->setStretchLastSection(true);
+    tablaBarrido->setSelectionBehavior(QAbstractItemView::SelectRows);
+    tablaBarrido->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    tablaBarrido->verticalHeader()->setVisible(false);
+    layoutBarrido->addWidget(tablaBarrido);
+    
+    labelMejorQuantum = new QLabel("", this);
+    labelMejorQuantum->setStyleSheet("QLabel { color: #27ae60; font-weight: bold; padding: 6px; }");
+    labelMejorQuantum->setAlignment(Qt::AlignCenter);
+    layoutBarrido->addWidget(labelMejorQuantum);
+    
+    connect(btnBarrido, &QPushButton::clicked, this, &EstadisticasWindow::onEjecutarBarrido);
+}
+
+void EstadisticasWindow::configurarReplicas()
+{
+    // --- Grupo: Réplicas Monte Carlo ---
+    grupoReplicas = new QGroupBox("Réplicas Monte Carlo (algoritmos marcados)", this);
+    QVBoxLayout *layoutReplicas = new QVBoxLayout(grupoReplicas);
+    
+    QHBoxLayout *layoutParametros = new QHBoxLayout();
+    spinReplicas = new QSpinBox(this);
+    spinReplicas->setRange(2, 100000);
+    spinReplicas->setValue(30);
+    spinSemillaReplicas = new QSpinBox(this);
+    spinSemillaReplicas->setRange(0, 2147483647);
+    spinSemillaReplicas->setValue(1);
+    spinSemillaReplicas->setToolTip("Semilla maestra: cada réplica deriva la suya, el resultado no depende de los hilos");
+    spinVariacionLlegada = new QSpinBox(this);
+    spinVariacionLlegada->setRange(0, 500);
+    spinVariacionLlegada->setValue(20);
+    spinVariacionLlegada->setSuffix(" %");
+    spinVariacionLlegada->setToolTip("Coeficiente de variación de las interllegadas (0 = sin perturbar)");
+    spinVariacionRafaga = new QSpinBox(this);
+    spinVariacionRafaga->setRange(0, 500);
+    spinVariacionRafaga->setValue(20);
+    spinVariacionRafaga->setSuffix(" %");
+    spinVariacionRafaga->setToolTip("Coeficiente de variación de las ráfagas (0 = sin perturbar)");
+    comboDistribucion = new QComboBox(this);
+    comboDistribucion->addItems({ "Lognormal", "Uniforme", "Exponencial" });
+    comboConfianza = new QComboBox(this);
+    comboConfianza->addItems({ "90 %", "95 %", "99 %" });
+    comboConfianza->setCurrentIndex(1);
+    btnReplicas = new QPushButton("Ejecutar réplicas", this);
+    
+    layoutParametros->addWidget(new QLabel("Réplicas:", this));
+    layoutParametros->addWidget(spinReplicas);
+    layoutParametros->addWidget(new QLabel("Semilla:", this));
+    layoutParametros->addWidget(spinSemillaReplicas);
+    layoutParametros->addWidget(new QLabel("Variación llegadas:", this));
+    layoutParametros->addWidget(spinVariacionLlegada);
+    layoutParametros->addWidget(new QLabel("ráfagas:", this));
+    layoutParametros->addWidget(spinVariacionRafaga);
+    layoutParametros->addWidget(comboDistribucion);
+    layoutParametros->addWidget(new QLabel("Confianza:", this));
+    layoutParametros->addWidget(comboConfianza);
+    layoutParametros->addWidget(btnReplicas);
+    layoutReplicas->addLayout(layoutParametros);
+    
+    tablaReplicas = new QTableWidget(0, 0, this);
+    tablaReplicas->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    tablaReplicas->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    layoutReplicas->addWidget(tablaReplicas);
+    
+    connect(btnReplicas, &QPushButton::clicked, this, &EstadisticasWindow::onEjecutarReplicas);
+}
+
+void EstadisticasWindow::configurarModelo()
+{
+    // --- Grupo: Modelo analítico (M/G/1) ---
+    grupoModelo = new QGroupBox("Modelo analítico M/G/1 (algoritmos marcados)", this);
+    QVBoxLayout *layoutModelo = new QVBoxLayout(grupoModelo);
+    
+    QHBoxLayout *layoutBoton = new QHBoxLayout();
+    btnModelo = new QPushButton("Estimar espera", this);
+    btnModelo->setToolTip("Predice la espera promedio con teoría de colas en milisegundos, sin simular");
+    labelAjuste = new QLabel("", this);
+    layoutBoton->addWidget(btnModelo);
+    layoutBoton->addWidget(labelAjuste, 1);
+    layoutModelo->addLayout(layoutBoton);
+    
+    tablaModelo = new QTableWidget(0, 6, this);
+    tablaModelo->setHorizontalHeaderLabels({ "Algoritmo", "Modelo", "Espera estimada", "Espera simulada",
+                                             "Diferencia", "Estado" });
+    tablaModelo->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    tablaModelo->verticalHeader()->setVisible(false);
+    tablaModelo->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    layoutModelo->addWidget(tablaModelo);
+    
+    connect(btnModelo, &QPushButton::clicked, this, &EstadisticasWindow::onEstimarModelo);
+}
+
 void EstadisticasWindow::configurarTablaResultados()
 {
-    tablaResultados = new QTableWidget(0, 3, this);
+    tablaResultados = new QTableWidget(0, 13, this);
     
     // Configurar headers
     QStringList headers;
-    headers << "Algoritmo" << "Tiempo de Espera Promedio" << "Estado";
+    headers << "Algoritmo" << "Tiempo de Espera Promedio" << "Desviación de Cuota"
+            << "Utilización CPU" << "Utilización E/S" << "Throughput"
+            << "Cambios de Contexto" << "Ciclos de Cambio"
+            << "Espera p50/p90/p99/máx" << "Turnaround p50/p90/p99/máx"
+            << "Respuesta p50/p90/p99/máx" << "Índice de Jain" << "Estado";
     tablaResultados->setHorizontalHeaderLabels(headers);
     
     // Configurar tamaños de columnas
     tablaResultados->horizontalHeader()->setStretchLastSection(true);
-    tablaResultados->setColumnWidth(0, 250);
-    tablaResultados->setColumnWidth(1, 200);
+    tablaResultados->setColumnWidth(0, 220);
+    tablaResultados->setColumnWidth(1, 170);
+    tablaResultados->setColumnWidth(2, 130);
+    tablaResultados->setColumnWidth(3, 110);
+    tablaResultados->setColumnWidth(4, 160);
+    tablaResultados->setColumnWidth(5, 100);
+    tablaResultados->setColumnWidth(6, 140);
+    tablaResultados->setColumnWidth(7, 120);
+    tablaResultados->setColumnWidth(8, 180);
+    tablaResultados->setColumnWidth(9, 200);
+    tablaResultados->setColumnWidth(10, 190);
+    tablaResultados->setColumnWidth(11, 110);
     
     // Configurar propiedades de la tabla
     tablaResultados->setAlternatingRowColors(true);
@@ -185,23 +479,79 @@ void EstadisticasWindow::onSeleccionarArchivo()
 
 void EstadisticasWindow::onArchivoDefault()
 {
-    archivoSeleccionado = "../data/procesos.txt";
+    archivoSeleccionado = checkRafagasES->isChecked() ? "../data/procesos_es.txt" : "../data/procesos.txt";
     lineEditArchivo->setText(archivoSeleccionado);
     QMessageBox::information(this, "Archivo por Defecto",
-                           "Se utilizará el archivo por defecto: ../data/procesos.txt");
+                           "Se utilizará el archivo por defecto: " + archivoSeleccionado);
+}
+
+void EstadisticasWindow::onAlgoritmoConQuantumToggled(bool)
+{
+    // El quantum se muestra mientras algún algoritmo que lo usa esté marcado
+    bool visible = checkRoundRobin->isChecked() || checkLottery->isChecked() ||
+                   checkStride->isChecked();
+    labelQuantum->setVisible(visible);
+    spinQuantum->setVisible(visible);
+}
+
+void EstadisticasWindow::onLotteryToggled(bool checked)
+{
+    labelSemilla->setVisible(checked);
+    spinSemilla->setVisible(checked);
+    onAlgoritmoConQuantumToggled(checked);
+}
+
+void EstadisticasWindow::onRRAdaptativoToggled(bool checked)
+{
+    labelPercentil->setVisible(checked);
+    spinPercentil->setVisible(checked);
+}
+
+void EstadisticasWindow::onPreemptivePriorityToggled(bool checked)
+{
+    labelEnvejecimiento->setVisible(checked);
+    spinEnvejecimiento->setVisible(checked);
+}
+
+void EstadisticasWindow::onMLFQToggled(bool checked)
+{
+    labelQuantumsMLFQ->setVisible(checked);
+    lineEditQuantumsMLFQ->setVisible(checked);
+    labelBoost->setVisible(checked);
+    spinBoost->setVisible(checked);
+}
+
+void EstadisticasWindow::onCFSToggled(bool checked)
+{
+    labelLatencia->setVisible(checked);
+    spinLatencia->setVisible(checked);
+    labelGranularidad->setVisible(checked);
+    spinGranularidad->setVisible(checked);
 }
 
-void EstadisticasWindow::onRoundRobinToggled(bool checked)
+void EstadisticasWindow::onRafagasESToggled(bool checked)
 {
-    labelQuantum->setVisible(checked);
-    spinQuantum->setVisible(checked);
+    labelDisciplinaES->setVisible(checked);
+    comboDisciplinaES->setVisible(checked);
+    // Alterna el archivo por defecto entre procesos.txt y procesos_es.txt
+    if (checked && archivoSeleccionado == "../data/procesos.txt") {
+        archivoSeleccionado = "../data/procesos_es.txt";
+    } else if (!checked && archivoSeleccionado == "../data/procesos_es.txt") {
+        archivoSeleccionado = "../data/procesos.txt";
+    }
+    lineEditArchivo->setText(archivoSeleccionado);
 }
 
 void EstadisticasWindow::onCalcularEstadisticas()
 {
+    // Ya hay una comparación en curso
+    if (algoritmosPendientes > 0) return;
+    
     // Validar que hay al menos un algoritmo seleccionado
-    if (!checkFIFO->isChecked() && !checkRoundRobin->isChecked() && 
-        !checkSJF->isChecked() && !checkPriority->isChecked() && !checkSRT->isChecked()) {
+    if (!checkFIFO->isChecked() && !checkRoundRobin->isChecked() && !checkRRAdaptativo->isChecked() &&
+        !checkSJF->isChecked() && !checkPriority->isChecked() && !checkSRT->isChecked() &&
+        !checkPreemptivePriority->isChecked() && !checkMLFQ->isChecked() &&
+        !checkCFS->isChecked() && !checkLottery->isChecked() && !checkStride->isChecked()) {
         QMessageBox::warning(this, "Error", "Por favor seleccione al menos un algoritmo.");
         return;
     }
@@ -214,176 +564,328 @@ void EstadisticasWindow::onCalcularEstadisticas()
         return;
     }
     
-    // Cargar procesos
-    auto procesos = cargarProcesosDesdeArchivo(archivoSeleccionado);
+    // Cargar procesos (con ráfagas de E/S, también sus perfiles y dispositivos)
+    QStringList erroresCarga;
+    CargaES cargaES;
+    std::vector<Proceso> procesos;
+    if (checkRafagasES->isChecked()) {
+        cargaES = cargarProcesosES(archivoSeleccionado, &erroresCarga);
+        procesos = cargaES.procesos;
+    } else {
+        procesos = cargarProcesosDesdeArchivo(archivoSeleccionado, &erroresCarga);
+    }
+    if (!erroresCarga.isEmpty()) {
+        QMessageBox::warning(this, "Errores en procesos.txt", erroresCarga.join("\n"));
+    }
     if (procesos.empty()) {
         QMessageBox::warning(this, "Error", "No se cargaron procesos o formato incorrecto.");
         return;
     }
     
-    // Ejecutar algoritmos seleccionados
-    std::vector<ResultadoAlgoritmo> resultados = ejecutarAlgoritmos(procesos);
-    
-    // Actualizar tabla con resultados
-    actualizarTablaResultados(resultados);
-    
-    // Mostrar mejor algoritmo
-    mostrarMejorAlgoritmo(resultados);
-    
+    // Ejecutar algoritmos seleccionados (en hilos; la tabla se llena al terminar cada uno)
+    if (checkRafagasES->isChecked()) {
+        const DisciplinaES disciplina = comboDisciplinaES->currentIndex() == 1
+            ? DisciplinaES::Prioridad : DisciplinaES::FCFS;
+        for (Dispositivo &d : cargaES.dispositivos) d.disciplina = disciplina;
+        ejecutarAlgoritmos(procesos, &cargaES);
+    } else {
+        ejecutarAlgoritmos(procesos);
+    }
+}
+
+void EstadisticasWindow::guardarResultados(const std::vector<ResultadoAlgoritmo>& resultados)
+{
     // resultados_estadisticas.txt
-    {
-        QString rutaSalida = "resultados_estadisticas.txt";
-        QFile file(rutaSalida);
-        if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            QTextStream out(&file);
-            // Encabezado CSV
-            out << "Algoritmo,TiempoEsperaPromedio,Estado\n";
-            // Volcar cada resultado de algoritmo
-            for (const ResultadoAlgoritmo &r : resultados) {
-                out << r.nombre << ","
-                    << r.tiempoEsperaPromedio << ","
-                    << (r.ejecutado ? "Completado" : "Error") << "\n";
+    QString rutaSalida = "resultados_estadisticas.txt";
+    QFile file(rutaSalida);
+    if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        QTextStream out(&file);
+        // Encabezado CSV
+        out << "Algoritmo,TiempoEsperaPromedio,DesviacionCuotaPromedio,CPUUtilization,Throughput,DeviceUtilization,"
+               "ContextSwitches,SwitchCycles,"
+               "WaitingP50,WaitingP90,WaitingP99,WaitingMax,"
+               "TurnaroundAvg,TurnaroundP50,TurnaroundP90,TurnaroundP99,TurnaroundMax,"
+               "ResponseAvg,ResponseP50,ResponseP90,ResponseP99,ResponseMax,JainIndex,Estado\n";
+        // Volcar cada resultado de algoritmo
+        for (const ResultadoAlgoritmo &r : resultados) {
+            // Utilización por dispositivo como "DISCO=0.32;RED=0.26" (vacío sin E/S)
+            QStringList dispositivos;
+            for (const EstadisticasDispositivo &d : r.dispositivos) {
+                dispositivos << QString("%1=%2").arg(d.nombre).arg(d.utilizacion);
             }
-            // Opcional: detalle por proceso en cada algoritmo
-            out << "\n--- Detalle por algoritmo ---\n";
-            for (const ResultadoAlgoritmo &r : resultados) {
-                if (!r.ejecutado) continue;
-                out << "\n" << r.nombre << "\n";
-                out << "PID,Start,Completion,Waiting,Turnaround\n";
-                for (const Proceso &p : r.procesosEjecutados) {
-                    out << p.pid << ","
-                        << p.startTime << ","
-                        << p.completionTime << ","
-                        << p.waitingTime << ","
-                        << p.turnaroundTime << "\n";
-                }
+            const MetricasEjecucion &m = r.metricas;
+            out << r.nombre << ","
+                << r.tiempoEsperaPromedio << ","
+                << (r.procesosEjecutados.empty() ? QString("-") : QString::number(r.desviacionCuotaPromedio)) << ","
+                << r.utilizacionCPU << ","
+                << r.throughput << ","
+                << dispositivos.join(";") << ","
+                << r.cambiosContexto << ","
+                << r.ciclosCambio << ","
+                << m.espera.p50 << "," << m.espera.p90 << "," << m.espera.p99 << "," << m.espera.maximo << ","
+                << m.turnaround.promedio << "," << m.turnaround.p50 << "," << m.turnaround.p90 << ","
+                << m.turnaround.p99 << "," << m.turnaround.maximo << ","
+                << m.respuesta.promedio << "," << m.respuesta.p50 << "," << m.respuesta.p90 << ","
+                << m.respuesta.p99 << "," << m.respuesta.maximo << ","
+                << m.indiceJain << ","
+                << (r.ejecutado ? "Completado" : "Error") << "\n";
+        }
+        // Opcional: detalle por proceso en cada algoritmo (no existe en modo solo agregados)
+        out << "\n--- Detalle por algoritmo ---\n";
+        for (const ResultadoAlgoritmo &r : resultados) {
+            if (!r.ejecutado || r.procesosEjecutados.empty()) continue;
+            out << "\n" << r.nombre << "\n";
+            out << "PID,Start,Completion,Waiting,Turnaround,ShareDeviation,TargetShare,AchievedShare\n";
+            std::vector<double> desviacion = calcularDesviacionCuota(r.procesosEjecutados);
+            std::vector<CuotaProceso> cuotas = calcularCuotas(r.procesosEjecutados);
+            for (size_t k = 0; k < r.procesosEjecutados.size(); ++k) {
+                const Proceso &p = r.procesosEjecutados[k];
+                out << p.pid << ","
+                    << p.startTime << ","
+                    << p.completionTime << ","
+                    << p.waitingTime << ","
+                    << p.turnaroundTime << ","
+                    << desviacion[k] << ","
+                    << cuotas[k].objetivo << ","
+                    << cuotas[k].obtenida << "\n";
             }
-            file.close();
-        } else {
-            QMessageBox::warning(this, "Error al escribir archivo",
-                                 "No se pudo crear 'resultados_estadisticas.txt'.");
         }
+        file.close();
+    } else {
+        QMessageBox::warning(this, "Error al escribir archivo",
+                             "No se pudo crear 'resultados_estadisticas.txt'.");
     }
 }
 
-std::vector<ResultadoAlgoritmo> EstadisticasWindow::ejecutarAlgoritmos(const std::vector<Proceso>& procesos)
+std::vector<EstadisticasWindow::AlgoritmoMarcado> EstadisticasWindow::algoritmosMarcados() const
 {
-    std::vector<ResultadoAlgoritmo> resultados;
+    // Un algoritmo = nombre (con sus parámetros) + política
+    std::vector<AlgoritmoMarcado> marcados;
     
     // FIFO
     if (checkFIFO->isChecked()) {
-        ResultadoAlgoritmo resultado;
-        resultado.nombre = "First In First Out (FIFO)";
-        try {
-            auto procesosOriginal = procesos; // Copia para mantener el original
-            resultado.procesosEjecutados = fifo(procesosOriginal);
-            resultado.tiempoEsperaPromedio = calcularTiempoEsperaPromedio(procesos, resultado.procesosEjecutados);
-            resultado.ejecutado = true;
-        } catch (...) {
-            resultado.ejecutado = false;
-        }
-        resultados.push_back(resultado);
+        marcados.push_back({ "First In First Out (FIFO)", Politica::FIFO });
     }
     
     // Round Robin
     if (checkRoundRobin->isChecked()) {
-        ResultadoAlgoritmo resultado;
-        resultado.nombre = QString("Round Robin (Q=%1)").arg(spinQuantum->value());
-        try {
-            auto procesosOriginal = procesos;
-            std::vector<BloqueGantt> bloques; // Para Round Robin
-            resultado.procesosEjecutados = roundRobin(procesosOriginal, spinQuantum->value(), bloques);
-            resultado.tiempoEsperaPromedio = calcularTiempoEsperaPromedio(procesos, resultado.procesosEjecutados);
-            resultado.ejecutado = true;
-        } catch (...) {
-            resultado.ejecutado = false;
-        }
-        resultados.push_back(resultado);
+        marcados.push_back({ QString("Round Robin (Q=%1)").arg(spinQuantum->value()), Politica::RoundRobin });
+    }
+    
+    // Round Robin adaptativo
+    if (checkRRAdaptativo->isChecked()) {
+        marcados.push_back({ QString("Round Robin Adaptativo (P%1)").arg(spinPercentil->value()),
+                             Politica::RoundRobinAdaptativo });
     }
     
     // Shortest Job First
     if (checkSJF->isChecked()) {
-        ResultadoAlgoritmo resultado;
-        resultado.nombre = "Shortest Job First (SJF)";
-        try {
-            auto procesosOriginal = procesos;
-            resultado.procesosEjecutados = shortestJobFirst(procesosOriginal);
-            resultado.tiempoEsperaPromedio = calcularTiempoEsperaPromedio(procesos, resultado.procesosEjecutados);
-            resultado.ejecutado = true;
-        } catch (...) {
-            resultado.ejecutado = false;
-        }
-        resultados.push_back(resultado);
+        marcados.push_back({ "Shortest Job First (SJF)", Politica::SJF });
     }
     
     // Priority Scheduling
     if (checkPriority->isChecked()) {
-        ResultadoAlgoritmo resultado;
-        resultado.nombre = "Priority Scheduling";
-        try {
-            auto procesosOriginal = procesos;
-            resultado.procesosEjecutados = priorityScheduling(procesosOriginal);
-            resultado.tiempoEsperaPromedio = calcularTiempoEsperaPromedio(procesos, resultado.procesosEjecutados);
-            resultado.ejecutado = true;
-        } catch (...) {
-            resultado.ejecutado = false;
-        }
-        resultados.push_back(resultado);
+        marcados.push_back({ "Priority Scheduling", Politica::Priority });
     }
     
     // Shortest Remaining Time
     if (checkSRT->isChecked()) {
-        ResultadoAlgoritmo resultado;
-        resultado.nombre = "Shortest Remaining Time (SRT)";
-        try {
-            auto procesosOriginal = procesos;
-            std::vector<BloqueGantt> bloques; // Para SRT
-            resultado.procesosEjecutados = shortestRemainingTime(procesosOriginal, bloques);
-            resultado.tiempoEsperaPromedio = calcularTiempoEsperaPromedio(procesos, resultado.procesosEjecutados);
-            resultado.ejecutado = true;
-        } catch (...) {
-            resultado.ejecutado = false;
-        }
-        resultados.push_back(resultado);
+        marcados.push_back({ "Shortest Remaining Time (SRT)", Politica::SRT });
     }
     
-    return resultados;
+    // Preemptive Priority con aging
+    if (checkPreemptivePriority->isChecked()) {
+        marcados.push_back({ QString("Preemptive Priority (Aging=%1)").arg(spinEnvejecimiento->value()),
+                             Politica::PreemptivePriority });
+    }
+    
+    // Multilevel Feedback Queue
+    if (checkMLFQ->isChecked()) {
+        marcados.push_back({ QString("MLFQ (Q=%1, Boost=%2)").arg(lineEditQuantumsMLFQ->text().trimmed())
+                                                             .arg(spinBoost->value()), Politica::MLFQ });
+    }
+    
+    // Completely Fair Scheduler
+    if (checkCFS->isChecked()) {
+        marcados.push_back({ QString("CFS (Latencia=%1, Gran=%2)").arg(spinLatencia->value())
+                                                                  .arg(spinGranularidad->value()), Politica::CFS });
+    }
+    
+    // Lottery
+    if (checkLottery->isChecked()) {
+        marcados.push_back({ QString("Lottery (Q=%1, Semilla=%2)").arg(spinQuantum->value()).arg(spinSemilla->value()),
+                             Politica::Lottery });
+    }
+    
+    // Stride
+    if (checkStride->isChecked()) {
+        marcados.push_back({ QString("Stride (Q=%1)").arg(spinQuantum->value()), Politica::Stride });
+    }
+    return marcados;
+}
+
+ParametrosPolitica EstadisticasWindow::parametrosPolitica() const
+{
+    // Parámetros de todas las políticas; cada una lee solo los suyos
+    ParametrosPolitica parametros;
+    parametros.quantum = spinQuantum->value();
+    parametros.envejecimiento = spinEnvejecimiento->value();
+    parametros.quantumPorNivel = parsearQuantums(lineEditQuantumsMLFQ->text());
+    parametros.periodoBoost = spinBoost->value();
+    parametros.latenciaObjetivo = spinLatencia->value();
+    parametros.granularidadMinima = spinGranularidad->value();
+    parametros.semillaLoteria = static_cast<uint64_t>(spinSemilla->value());
+    parametros.percentilQuantum = spinPercentil->value();
+    return parametros;
+}
+
+ConfigSMP EstadisticasWindow::configMotor() const
+{
+    ConfigSMP config;
+    config.costoCambioContexto = spinCambioContexto->value();
+    config.costoMismoProceso = spinCambioMismo->value();
+    config.soloAgregados = checkSoloAgregados->isChecked();
+    return config;
 }
 
-void EstadisticasWindow::actualizarTablaResultados(const std::vector<ResultadoAlgoritmo>& resultados)
+void EstadisticasWindow::ejecutarAlgoritmos(const std::vector<Proceso>& procesos, const CargaES* cargaES)
 {
-    tablaResultados->setRowCount(resultados.size());
+    // Los parámetros se leen de los widgets aquí, en el hilo de la GUI, y se
+    // capturan por valor; la carga se valida, interna y ordena una sola vez y
+    // todos los hilos la comparten
+    const std::vector<AlgoritmoMarcado> tareas = algoritmosMarcados();
+    const ParametrosPolitica parametros = parametrosPolitica();
+    const ConfigSMP config = configMotor();
     
-    for (int i = 0; i < resultados.size(); ++i) {
-        const auto& resultado = resultados[i];
-        
-        // Columna: Algoritmo
-        QTableWidgetItem *itemAlgoritmo = new QTableWidgetItem(resultado.nombre);
-        tablaResultados->setItem(i, 0, itemAlgoritmo);
-        
-        // Columna: Tiempo de Espera Promedio
-        QString tiempoTexto;
-        if (resultado.ejecutado) {
-            tiempoTexto = QString::number(resultado.tiempoEsperaPromedio, 'f', 2);
-        } else {
-            tiempoTexto = "Error";
-        }
-        QTableWidgetItem *itemTiempo = new QTableWidgetItem(tiempoTexto);
-        if (!resultado.ejecutado) {
-            itemTiempo->setBackground(QColor(255, 200, 200)); 
+    // Una sola carga validada e internada, compartida (solo lectura) por todos los hilos
+    auto carga = std::make_shared<const CargaComparacion>(
+        cargaES ? prepararComparacion(*cargaES) : prepararComparacion(procesos));
+    
+    resultadosActuales.assign(tareas.size(), ResultadoAlgoritmo());
+    algoritmosPendientes = static_cast<int>(tareas.size());
+    btnCalcular->setEnabled(false);
+    labelMejorAlgoritmo->setText("");
+    
+    // Filas en espera; cada una se completa cuando termina su algoritmo
+    tablaResultados->setRowCount(static_cast<int>(tareas.size()));
+    for (int i = 0; i < static_cast<int>(tareas.size()); ++i) {
+        resultadosActuales[i].nombre = tareas[i].nombre;
+        tablaResultados->setItem(i, 0, new QTableWidgetItem(tareas[i].nombre));
+        tablaResultados->setItem(i, 1, new QTableWidgetItem("..."));
+        for (int c = 2; c < 12; ++c) {
+            tablaResultados->setItem(i, c, new QTableWidgetItem("..."));
         }
-        tablaResultados->setItem(i, 1, itemTiempo);
+        QTableWidgetItem *itemEstado = new QTableWidgetItem("Ejecutando...");
+        itemEstado->setBackground(QColor(255, 245, 200));
+        tablaResultados->setItem(i, 12, itemEstado);
+    }
+    
+    for (int i = 0; i < static_cast<int>(tareas.size()); ++i) {
+        auto *watcher = new QFutureWatcher<ResultadoAlgoritmo>(this);
+        connect(watcher, &QFutureWatcher<ResultadoAlgoritmo>::finished, this, [this, watcher, i]() {
+            resultadosActuales[i] = watcher->result();
+            actualizarFilaResultado(i, resultadosActuales[i]);
+            watcher->deleteLater();
+            if (--algoritmosPendientes == 0) {
+                mostrarMejorAlgoritmo(resultadosActuales);
+                guardarResultados(resultadosActuales);
+                actualizarTablaModelo();
+                btnCalcular->setEnabled(true);
+            }
+        });
         
-        // Columna: Estado
-        QString estado = resultado.ejecutado ? "Completado" : "Error";
-        QTableWidgetItem *itemEstado = new QTableWidgetItem(estado);
-        if (resultado.ejecutado) {
-            itemEstado->setBackground(QColor(200, 255, 200)); 
-        } else {
-            itemEstado->setBackground(QColor(255, 200, 200)); 
+        // Trabajo del hilo: solo lee `carga` y devuelve su propio resultado
+        AlgoritmoMarcado tarea = tareas[i];
+        watcher->setFuture(QtConcurrent::run([tarea, carga, parametros, config]() {
+            ResultadoAlgoritmo resultado;
+            resultado.nombre = tarea.nombre;
+            try {
+                ResultadoComparacion comparacion = ejecutarComparacion(*carga, tarea.politica, parametros, config);
+                resultado.procesosEjecutados = std::move(comparacion.procesos);
+                resultado.metricas = comparacion.metricas;
+                resultado.tiempoEsperaPromedio = comparacion.metricas.espera.promedio;
+                resultado.desviacionCuotaPromedio = comparacion.desviacionCuotaPromedio;
+                resultado.utilizacionCPU = comparacion.utilizacionCPU;
+                resultado.throughput = comparacion.throughput;
+                resultado.dispositivos = std::move(comparacion.dispositivos);
+                resultado.cambiosContexto = comparacion.cambiosContexto;
+                resultado.ciclosCambio = comparacion.ciclosCambio;
+                resultado.ejecutado = comparacion.ejecutado;
+            } catch (...) {
+                resultado.ejecutado = false;
+            }
+            return resultado;
+        }));
+    }
+}
+
+void EstadisticasWindow::actualizarFilaResultado(int fila, const ResultadoAlgoritmo& resultado)
+{
+    // Columna: Algoritmo
+    QTableWidgetItem *itemAlgoritmo = new QTableWidgetItem(resultado.nombre);
+    tablaResultados->setItem(fila, 0, itemAlgoritmo);
+    
+    // Columna: Tiempo de Espera Promedio
+    QString tiempoTexto;
+    if (resultado.ejecutado) {
+        tiempoTexto = QString::number(resultado.tiempoEsperaPromedio, 'f', 2);
+    } else {
+        tiempoTexto = "Error";
+    }
+    QTableWidgetItem *itemTiempo = new QTableWidgetItem(tiempoTexto);
+    if (!resultado.ejecutado) {
+        itemTiempo->setBackground(QColor(255, 200, 200)); 
+    }
+    tablaResultados->setItem(fila, 1, itemTiempo);
+    
+    // Columna: Desviación de cuota (0 = reparto perfectamente justo)
+    QString desviacionTexto = !resultado.ejecutado ? "Error"
+        : resultado.procesosEjecutados.empty() ? "-"
+        : QString::number(resultado.desviacionCuotaPromedio * 100.0, 'f', 1) + " %";
+    tablaResultados->setItem(fila, 2, new QTableWidgetItem(desviacionTexto));
+    
+    // Columnas: Utilización de CPU, de cada dispositivo y throughput (procesos/ciclo)
+    QString utilizacionTexto = "Error", dispositivosTexto = "Error", throughputTexto = "Error";
+    if (resultado.ejecutado) {
+        utilizacionTexto = QString::number(resultado.utilizacionCPU * 100.0, 'f', 1) + " %";
+        QStringList dispositivos;
+        for (const EstadisticasDispositivo &d : resultado.dispositivos) {
+            dispositivos << QString("%1 %2 %").arg(d.nombre).arg(QString::number(d.utilizacion * 100.0, 'f', 1));
         }
-        tablaResultados->setItem(i, 2, itemEstado);
+        dispositivosTexto = dispositivos.isEmpty() ? "-" : dispositivos.join(", ");
+        throughputTexto = QString::number(resultado.throughput, 'f', 4);
     }
+    tablaResultados->setItem(fila, 3, new QTableWidgetItem(utilizacionTexto));
+    tablaResultados->setItem(fila, 4, new QTableWidgetItem(dispositivosTexto));
+    tablaResultados->setItem(fila, 5, new QTableWidgetItem(throughputTexto));
+    
+    // Columnas: Cambios de contexto y ciclos perdidos en ellos
+    tablaResultados->setItem(fila, 6, new QTableWidgetItem(
+        resultado.ejecutado ? QString::number(resultado.cambiosContexto) : "Error"));
+    tablaResultados->setItem(fila, 7, new QTableWidgetItem(
+        resultado.ejecutado ? QString::number(resultado.ciclosCambio) : "Error"));
+    
+    // Columnas: percentiles (ciclos) e índice de Jain (1 = todos reciben la misma fracción)
+    auto textoDistribucion = [&resultado](const ResumenDistribucion &d) {
+        return resultado.ejecutado
+            ? QString("%1 / %2 / %3 / %4").arg(d.p50).arg(d.p90).arg(d.p99).arg(d.maximo)
+            : QString("Error");
+    };
+    tablaResultados->setItem(fila, 8, new QTableWidgetItem(textoDistribucion(resultado.metricas.espera)));
+    tablaResultados->setItem(fila, 9, new QTableWidgetItem(textoDistribucion(resultado.metricas.turnaround)));
+    tablaResultados->setItem(fila, 10, new QTableWidgetItem(textoDistribucion(resultado.metricas.respuesta)));
+    tablaResultados->setItem(fila, 11, new QTableWidgetItem(
+        resultado.ejecutado ? QString::number(resultado.metricas.indiceJain, 'f', 4) : "Error"));
+    
+    // Columna: Estado
+    QString estado = resultado.ejecutado ? "Completado" : "Error";
+    QTableWidgetItem *itemEstado = new QTableWidgetItem(estado);
+    if (resultado.ejecutado) {
+        itemEstado->setBackground(QColor(200, 255, 200)); 
+    } else {
+        itemEstado->setBackground(QColor(255, 200, 200)); 
+    }
+    tablaResultados->setItem(fila, 12, itemEstado);
 }
 
 void EstadisticasWindow::mostrarMejorAlgoritmo(const std::vector<ResultadoAlgoritmo>& resultados)
@@ -408,6 +910,323 @@ void EstadisticasWindow::mostrarMejorAlgoritmo(const std::vector<ResultadoAlgori
     }
 }
 
+void EstadisticasWindow::onEjecutarBarrido()
+{
+    if (spinQuantumHasta->value() < spinQuantumDesde->value()) {
+        QMessageBox::warning(this, "Error", "El quantum final debe ser mayor o igual al inicial.");
+        return;
+    }
+    
+    // Costos de cambio de contexto: enteros >= 0 separados por coma
+    std::vector<int> costos;
+    for (const QString &parte : lineEditCostosCambio->text().split(',')) {
+        if (parte.trimmed().isEmpty()) continue;
+        bool ok = false;
+        int costo = parte.trimmed().toInt(&ok);
+        if (!ok || costo < 0) {
+            QMessageBox::warning(this, "Error",
+                                 QString("Costo de cambio de contexto inválido: '%1'").arg(parte.trimmed()));
+            return;
+        }
+        if (std::find(costos.begin(), costos.end(), costo) == costos.end()) costos.push_back(costo);
+    }
+    if (costos.empty()) costos.push_back(0);
+    
+    QFileInfo info(archivoSeleccionado);
+    if (!info.exists()) {
+        QMessageBox::warning(this, "Error",
+                           QString("El archivo seleccionado no existe:\n%1").arg(archivoSeleccionado));
+        return;
+    }
+    
+    QStringList erroresCarga;
+    auto procesos = cargarProcesosDesdeArchivo(archivoSeleccionado, &erroresCarga);
+    if (!erroresCarga.isEmpty()) {
+        QMessageBox::warning(this, "Errores en procesos.txt", erroresCarga.join("\n"));
+    }
+    if (procesos.empty()) {
+        QMessageBox::warning(this, "Error", "No se cargaron procesos o formato incorrecto.");
+        return;
+    }
+    
+    // El rango se lee aquí, en el hilo de la GUI, y se captura por valor
+    const int quantumDesde = spinQuantumDesde->value();
+    const int quantumHasta = spinQuantumHasta->value();
+    btnBarrido->setEnabled(false);
+    
+    auto *watcher = new QFutureWatcher<std::vector<PuntoBarrido>>(this);
+    connect(watcher, &QFutureWatcher<std::vector<PuntoBarrido>>::finished, this, [this, watcher, costos]() {
+        const std::vector<PuntoBarrido> puntos = watcher->result();
+        watcher->deleteLater();
+        btnBarrido->setEnabled(true);
+        if (puntos.empty()) {
+            QMessageBox::warning(this, "Error", "No se pudo ejecutar el barrido con los procesos cargados.");
+            return;
+        }
+        actualizarTablaBarrido(puntos, costos);
+    });
+    
+    // Las corridas son independientes: barridoQuantumRR las reparte entre
+    // todos los núcleos, fuera del hilo de la GUI
+    watcher->setFuture(QtConcurrent::run([procesos, quantumDesde, quantumHasta, costos]() {
+        return barridoQuantumRR(procesos, quantumDesde, quantumHasta, costos);
+    }));
+}
+
+void EstadisticasWindow::actualizarTablaBarrido(const std::vector<PuntoBarrido>& puntos,
+                                                const std::vector<int>& costos)
+{
+    tablaBarrido->setRowCount(puntos.size());
+    for (int i = 0; i < static_cast<int>(puntos.size()); ++i) {
+        const PuntoBarrido &p = puntos[i];
+        tablaBarrido->setItem(i, 0, new QTableWidgetItem(QString::number(p.quantum)));
+        tablaBarrido->setItem(i, 1, new QTableWidgetItem(QString::number(p.costoCambio)));
+        tablaBarrido->setItem(i, 2, new QTableWidgetItem(QString::number(p.esperaPromedio, 'f', 2)));
+        tablaBarrido->setItem(i, 3, new QTableWidgetItem(QString::number(p.turnaroundPromedio, 'f', 2)));
+        tablaBarrido->setItem(i, 4, new QTableWidgetItem(QString::number(p.cambiosContexto)));
+    }
+    
+    // Resaltar el quantum óptimo (menor espera) de cada costo de cambio
+    QStringList mejores;
+    for (int costo : costos) {
+        int mejor = mejorPuntoBarrido(puntos, costo);
+        if (mejor < 0) continue;
+        for (int c = 0; c < tablaBarrido->columnCount(); ++c) {
+            tablaBarrido->item(mejor, c)->setBackground(QColor(200, 255, 200));
+        }
+        mejores << QString("costo %1 → Q=%2 (espera %3)")
+                       .arg(costo)
+                       .arg(puntos[mejor].quantum)
+                       .arg(QString::number(puntos[mejor].esperaPromedio, 'f', 2));
+    }
+    labelMejorQuantum->setText("Mejor quantum: " + mejores.join("; "));
+    if (!mejores.isEmpty()) {
+        tablaBarrido->scrollToItem(tablaBarrido->item(mejorPuntoBarrido(puntos, costos.front()), 0));
+    }
+}
+
+void EstadisticasWindow::onEjecutarReplicas()
+{
+    const std::vector<AlgoritmoMarcado> marcados = algoritmosMarcados();
+    if (marcados.empty()) {
+        QMessageBox::warning(this, "Error", "Por favor seleccione al menos un algoritmo.");
+        return;
+    }
+    
+    QFileInfo info(archivoSeleccionado);
+    if (!info.exists()) {
+        QMessageBox::warning(this, "Error",
+                           QString("El archivo seleccionado no existe:\n%1").arg(archivoSeleccionado));
+        return;
+    }
+    
+    // Las réplicas perturban llegadas y ráfaga total: con procesos_es.txt se
+    // ignoran los perfiles de E/S
+    QStringList erroresCarga;
+    std::vector<Proceso> procesos = checkRafagasES->isChecked()
+        ? cargarProcesosES(archivoSeleccionado, &erroresCarga).procesos
+        : cargarProcesosDesdeArchivo(archivoSeleccionado, &erroresCarga);
+    if (!erroresCarga.isEmpty()) {
+        QMessageBox::warning(this, "Errores en procesos.txt", erroresCarga.join("\n"));
+    }
+    if (procesos.empty()) {
+        QMessageBox::warning(this, "Error", "No se cargaron procesos o formato incorrecto.");
+        return;
+    }
+    
+    ConfigReplicacion config;
+    config.replicas = spinReplicas->value();
+    config.semilla = static_cast<uint64_t>(spinSemillaReplicas->value());
+    config.variacionLlegada = spinVariacionLlegada->value() / 100.0;
+    config.variacionRafaga = spinVariacionRafaga->value() / 100.0;
+    config.distribucion = comboDistribucion->currentIndex() == 1 ? DistribucionPerturbacion::Uniforme
+                        : comboDistribucion->currentIndex() == 2 ? DistribucionPerturbacion::Exponencial
+                                                                 : DistribucionPerturbacion::Lognormal;
+    const double niveles[] = { 0.90, 0.95, 0.99 };
+    config.confianza = niveles[comboConfianza->currentIndex()];
+    
+    std::vector<Politica> politicas;
+    QStringList nombres;
+    for (const AlgoritmoMarcado &a : marcados) {
+        politicas.push_back(a.politica);
+        nombres << a.nombre;
+    }
+    
+    // Los parámetros se leen aquí, en el hilo de la GUI, y se capturan por valor
+    const ParametrosPolitica parametros = parametrosPolitica();
+    const ConfigSMP configSMP = configMotor();
+    btnReplicas->setEnabled(false);
+    
+    auto *watcher = new QFutureWatcher<std::vector<ResumenReplicacion>>(this);
+    connect(watcher, &QFutureWatcher<std::vector<ResumenReplicacion>>::finished, this, [this, watcher, nombres]() {
+        const std::vector<ResumenReplicacion> resumenes = watcher->result();
+        watcher->deleteLater();
+        btnReplicas->setEnabled(true);
+        if (resumenes.empty()) {
+            QMessageBox::warning(this, "Error", "No se pudieron ejecutar las réplicas con los procesos cargados.");
+            return;
+        }
+        actualizarTablaReplicas(resumenes, nombres);
+        guardarReplicas(resumenes, nombres);
+    });
+    
+    // Las réplicas son independientes: replicarPoliticas las reparte entre
+    // todos los núcleos, fuera del hilo de la GUI
+    watcher->setFuture(QtConcurrent::run([procesos, politicas, parametros, configSMP, config]() {
+        return replicarPoliticas(procesos, politicas, parametros, configSMP, config);
+    }));
+}
+
+void EstadisticasWindow::actualizarTablaReplicas(const std::vector<ResumenReplicacion>& resumenes,
+                                                 const QStringList& nombres)
+{
+    tablaReplicas->clear();
+    tablaReplicas->setRowCount(NUM_METRICAS_REPLICACION);
+    tablaReplicas->setColumnCount(static_cast<int>(resumenes.size()));
+    tablaReplicas->setHorizontalHeaderLabels(nombres);
+    QStringList filas;
+    for (int m = 0; m < NUM_METRICAS_REPLICACION; ++m) {
+        filas << nombreMetrica(static_cast<MetricaReplicacion>(m));
+    }
+    tablaReplicas->setVerticalHeaderLabels(filas);
+    
+    // "media ± semiancho"; sin réplicas válidas "-"
+    for (int c = 0; c < static_cast<int>(resumenes.size()); ++c) {
+        for (int m = 0; m < NUM_METRICAS_REPLICACION; ++m) {
+            const IntervaloConfianza &ic = resumenes[c].metricas[m];
+            const int decimales = std::fabs(ic.media) < 10.0 ? 4 : 2;
+            QString texto = resumenes[c].replicas > 0
+                ? QString("%1 ± %2").arg(QString::number(ic.media, 'f', decimales))
+                                    .arg(QString::number(ic.semiancho, 'f', decimales))
+                : QString("-");
+            tablaReplicas->setItem(m, c, new QTableWidgetItem(texto));
+        }
+    }
+}
+
+void EstadisticasWindow::guardarReplicas(const std::vector<ResumenReplicacion>& resumenes,
+                                         const QStringList& nombres)
+{
+    // resultados_replicas.txt: una fila por (algoritmo, métrica)
+    QFile file("resultados_replicas.txt");
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) return;
+    QTextStream out(&file);
+    out << "Algoritmo,Metrica,Replicas,Media,Desviacion,Inferior,Superior\n";
+    for (size_t i = 0; i < resumenes.size(); ++i) {
+        for (int m = 0; m < NUM_METRICAS_REPLICACION; ++m) {
+            const IntervaloConfianza &ic = resumenes[i].metricas[m];
+            out << nombres[static_cast<int>(i)] << ","
+                << nombreMetrica(static_cast<MetricaReplicacion>(m)) << ","
+                << resumenes[i].replicas << ","
+                << ic.media << "," << ic.desviacion << ","
+                << ic.inferior() << "," << ic.superior() << "\n";
+        }
+    }
+    file.close();
+}
+
+void EstadisticasWindow::onEstimarModelo()
+{
+    const std::vector<AlgoritmoMarcado> marcados = algoritmosMarcados();
+    if (marcados.empty()) {
+        QMessageBox::warning(this, "Error", "Por favor seleccione al menos un algoritmo.");
+        return;
+    }
+    
+    QFileInfo info(archivoSeleccionado);
+    if (!info.exists()) {
+        QMessageBox::warning(this, "Error",
+                           QString("El archivo seleccionado no existe:\n%1").arg(archivoSeleccionado));
+        return;
+    }
+    
+    // El modelo solo ve la CPU: con procesos_es.txt usa la ráfaga total
+    QStringList erroresCarga;
+    std::vector<Proceso> procesos = checkRafagasES->isChecked()
+        ? cargarProcesosES(archivoSeleccionado, &erroresCarga).procesos
+        : cargarProcesosDesdeArchivo(archivoSeleccionado, &erroresCarga);
+    if (!erroresCarga.isEmpty()) {
+        QMessageBox::warning(this, "Errores en procesos.txt", erroresCarga.join("\n"));
+    }
+    const CargaComparacion carga = prepararComparacion(procesos);
+    if (!carga.valida()) {
+        QMessageBox::warning(this, "Error", "No se cargaron procesos o formato incorrecto.");
+        return;
+    }
+    
+    std::vector<Politica> politicas;
+    nombresModelo.clear();
+    for (const AlgoritmoMarcado &a : marcados) {
+        politicas.push_back(a.politica);
+        nombresModelo << a.nombre;
+    }
+    estimacionesModelo = estimarPoliticas(carga.carga, politicas);
+    
+    const AjusteCarga ajuste = ajustarCarga(carga.carga);
+    if (!ajuste.valido()) {
+        labelAjuste->setText("Sin proceso de llegadas (todos llegan en el mismo ciclo): el modelo no aplica.");
+    } else {
+        QString texto = QString("λ = %1 procesos/ciclo · E[S] = %2 · CV llegadas = %3 · CV ráfagas = %4 · ρ = %5")
+                            .arg(QString::number(ajuste.tasaLlegada, 'g', 4))
+                            .arg(QString::number(ajuste.servicioMedio, 'f', 2))
+                            .arg(QString::number(ajuste.cvLlegadas, 'f', 2))
+                            .arg(QString::number(ajuste.cvServicio, 'f', 2))
+                            .arg(QString::number(ajuste.utilizacion, 'f', 3));
+        if (std::fabs(ajuste.cvLlegadas - 1.0) > 0.5) {
+            texto += " — llegadas lejos de Poisson: solo orden de magnitud";
+        }
+        if (spinCambioContexto->value() > 0 || spinCambioMismo->value() > 0) {
+            texto += " — el modelo no cobra cambios de contexto";
+        }
+        labelAjuste->setText(texto);
+    }
+    actualizarTablaModelo();
+}
+
+void EstadisticasWindow::actualizarTablaModelo()
+{
+    tablaModelo->setRowCount(static_cast<int>(estimacionesModelo.size()));
+    for (int i = 0; i < static_cast<int>(estimacionesModelo.size()); ++i) {
+        const EstimacionAnalitica &e = estimacionesModelo[i];
+        tablaModelo->setItem(i, 0, new QTableWidgetItem(nombresModelo[i]));
+        tablaModelo->setItem(i, 1, new QTableWidgetItem(e.modelo));
+        QString estimada = !e.aplicable ? "-" : !e.estable ? "∞ (ρ ≥ 1)" : QString::number(e.espera, 'f', 2);
+        tablaModelo->setItem(i, 2, new QTableWidgetItem(estimada));
+        
+        // Simulada: la fila de la última comparación con el mismo algoritmo y parámetros
+        const ResultadoAlgoritmo *simulado = nullptr;
+        if (algoritmosPendientes == 0) {
+            for (const ResultadoAlgoritmo &r : resultadosActuales) {
+                if (r.ejecutado && r.nombre == nombresModelo[i]) simulado = &r;
+            }
+        }
+        QString simuladaTexto = "-", diferenciaTexto = "-", estado;
+        QColor color(255, 255, 255);
+        if (simulado) {
+            simuladaTexto = QString::number(simulado->tiempoEsperaPromedio, 'f', 2);
+        }
+        if (!e.aplicable) {
+            estado = "Sin modelo";
+        } else if (!e.estable) {
+            estado = "Inestable";
+            color = QColor(255, 245, 200);
+        } else if (!simulado) {
+            estado = "Solo estimación";
+        } else {
+            diferenciaTexto = QString::number((simulado->tiempoEsperaPromedio - e.espera) /
+                                              std::max(e.espera, 1.0) * 100.0, 'f', 1) + " %";
+            const bool discrepa = discrepaDelModelo(e, simulado->tiempoEsperaPromedio);
+            estado = discrepa ? "Discrepa con la teoría" : "Coincide";
+            color = discrepa ? QColor(255, 200, 200) : QColor(200, 255, 200);
+        }
+        tablaModelo->setItem(i, 3, new QTableWidgetItem(simuladaTexto));
+        tablaModelo->setItem(i, 4, new QTableWidgetItem(diferenciaTexto));
+        QTableWidgetItem *itemEstado = new QTableWidgetItem(estado);
+        itemEstado->setBackground(color);
+        tablaModelo->setItem(i, 5, itemEstado);
+    }
+}
+
 void EstadisticasWindow::onAbrirResultadosEstadisticasClicked() {
     // 1) Ruta absoluta a build/
     QString rutaSalida = QDir::current().absoluteFilePath("resultados_estadisticas.txt");
@@ -10,6 +10,7 @@
 #include <QPushButton>
 #include <QGroupBox>
 #include <QLineEdit>
+#include <QComboBox>
 #include <QTextEdit>
 #include <QTableWidget>
 #include <QTableWidgetItem>
@@ -19,14 +20,29 @@
 #include <QFileInfo>
 #include <vector>
 #include "algoritmo.h"
+#include "barrido.h"
+#include "entradaSalida.h"
+#include "metricas.h"
+#include "comparacion.h"
+#include "replicacion.h"
+#include "modeloAnalitico.h"
 
 struct ResultadoAlgoritmo {
     QString nombre;
     double tiempoEsperaPromedio;
-    std::vector<Proceso> procesosEjecutados;
+    double desviacionCuotaPromedio; // Media de |desviación de cuota| (justicia)
+    double utilizacionCPU;          // Ciclos ocupados / makespan
+    double throughput;              // Procesos terminados / makespan
+    std::vector<EstadisticasDispositivo> dispositivos; // Solo con ráfagas de E/S
+    int cambiosContexto;            // Cambios a otro proceso (sin contar re-despachos)
+    long long ciclosCambio;         // Ciclos perdidos en cambios de contexto
+    MetricasEjecucion metricas;     // Percentiles de espera/turnaround/respuesta y Jain
+    std::vector<Proceso> procesosEjecutados; // Vacío en modo solo agregados
     bool ejecutado;
     
-    ResultadoAlgoritmo() : tiempoEsperaPromedio(0.0), ejecutado(false) {}
+    ResultadoAlgoritmo() : tiempoEsperaPromedio(0.0), desviacionCuotaPromedio(0.0),
+                           utilizacionCPU(0.0), throughput(0.0), cambiosContexto(0),
+                           ciclosCambio(0), ejecutado(false) {}
 };
 
 class EstadisticasWindow : public QMainWindow {
@@ -40,7 +56,16 @@ private slots:
     void onArchivoDefault();
     void onCalcularEstadisticas();
     void onAbrirResultadosEstadisticasClicked();
-    void onRoundRobinToggled(bool checked);
+    void onAlgoritmoConQuantumToggled(bool checked);
+    void onLotteryToggled(bool checked);
+    void onRRAdaptativoToggled(bool checked);
+    void onPreemptivePriorityToggled(bool checked);
+    void onMLFQToggled(bool checked);
+    void onCFSToggled(bool checked);
+    void onRafagasESToggled(bool checked);
+    void onEjecutarBarrido();
+    void onEjecutarReplicas();
+    void onEstimarModelo();
 
 private:
     // Controles de selección de archivo
@@ -54,13 +79,57 @@ private:
     QGroupBox *grupoAlgoritmos;
     QCheckBox *checkFIFO;
     QCheckBox *checkRoundRobin;
+    QCheckBox *checkRRAdaptativo;
     QCheckBox *checkSJF;
     QCheckBox *checkPriority;
     QCheckBox *checkSRT;
+    QCheckBox *checkPreemptivePriority;
+    QCheckBox *checkMLFQ;
+    QCheckBox *checkCFS;
+    QCheckBox *checkLottery;
+    QCheckBox *checkStride;
     
-    // Control de quantum para Round Robin
+    // Control de quantum para Round Robin, Lottery y Stride
     QLabel *labelQuantum;
     QSpinBox *spinQuantum;
+
+    // Percentil del restante para Round Robin adaptativo (50 = mediana)
+    QLabel *labelPercentil;
+    QSpinBox *spinPercentil;
+
+    // Semilla del sorteo de Lottery
+    QLabel *labelSemilla;
+    QSpinBox *spinSemilla;
+
+    // Control de aging para Preemptive Priority
+    QLabel *labelEnvejecimiento;
+    QSpinBox *spinEnvejecimiento;
+
+    // Controles de MLFQ (quantum por nivel y periodo de boost)
+    QLabel *labelQuantumsMLFQ;
+    QLineEdit *lineEditQuantumsMLFQ;
+    QLabel *labelBoost;
+    QSpinBox *spinBoost;
+
+    // Controles de CFS (latencia objetivo y granularidad mínima)
+    QLabel *labelLatencia;
+    QSpinBox *spinLatencia;
+    QLabel *labelGranularidad;
+    QSpinBox *spinGranularidad;
+
+    // Ráfagas CPU/E/S (procesos_es.txt) y orden de las colas de los dispositivos
+    QCheckBox *checkRafagasES;
+    QLabel *labelDisciplinaES;
+    QComboBox *comboDisciplinaES;
+
+    // Costo de cambio de contexto (entre procesos y al mismo proceso)
+    QLabel *labelCambioContexto;
+    QSpinBox *spinCambioContexto;
+    QLabel *labelCambioMismo;
+    QSpinBox *spinCambioMismo;
+
+    // Solo métricas agregadas: sin filas por proceso (cargas muy grandes)
+    QCheckBox *checkSoloAgregados;
     
     // Botón de cálculo
     QPushButton *btnCalcular;
@@ -70,6 +139,32 @@ private:
     QTableWidget *tablaResultados;
     QLabel *labelMejorAlgoritmo;
     
+    // Barrido de quantum de Round Robin (paralelo)
+    QGroupBox *grupoBarrido;
+    QSpinBox *spinQuantumDesde;
+    QSpinBox *spinQuantumHasta;
+    QLineEdit *lineEditCostosCambio;   // Costos de cambio de contexto ("0,1,2")
+    QPushButton *btnBarrido;
+    QTableWidget *tablaBarrido;
+    QLabel *labelMejorQuantum;
+    
+    // Réplicas Monte Carlo (carga perturbada, intervalos de confianza)
+    QGroupBox *grupoReplicas;
+    QSpinBox *spinReplicas;
+    QSpinBox *spinSemillaReplicas;
+    QSpinBox *spinVariacionLlegada;    // Coeficiente de variación en %
+    QSpinBox *spinVariacionRafaga;
+    QComboBox *comboDistribucion;
+    QComboBox *comboConfianza;
+    QPushButton *btnReplicas;
+    QTableWidget *tablaReplicas;       // Filas = métricas, columnas = algoritmos
+    
+    // Modelo analítico M/G/1: espera estimada junto a la simulada
+    QGroupBox *grupoModelo;
+    QPushButton *btnModelo;
+    QLabel *labelAjuste;               // λ, E[S], coeficientes de variación y ρ de la carga
+    QTableWidget *tablaModelo;
+    
     // Layout principal
     QVBoxLayout *layoutPrincipal;
 
@@ -79,9 +174,41 @@ private:
     // Métodos auxiliares
     void configurarInterfaz();
     void configurarTablaResultados();
-    void actualizarTablaResultados(const std::vector<ResultadoAlgoritmo>& resultados);
+    void actualizarFilaResultado(int fila, const ResultadoAlgoritmo& resultado);
     void mostrarMejorAlgoritmo(const std::vector<ResultadoAlgoritmo>& resultados);
-    std::vector<ResultadoAlgoritmo> ejecutarAlgoritmos(const std::vector<Proceso>& procesos);
+    void configurarBarrido();
+    void configurarReplicas();
+    void actualizarTablaReplicas(const std::vector<ResumenReplicacion>& resumenes, const QStringList& nombres);
+    void guardarReplicas(const std::vector<ResumenReplicacion>& resumenes, const QStringList& nombres);
+    void configurarModelo();
+    // Llena la columna simulada con los resultados de la última comparación
+    // (por nombre de algoritmo) si ya terminó
+    void actualizarTablaModelo();
+
+    // Algoritmos marcados y parámetros de los widgets (comparación y réplicas)
+    struct AlgoritmoMarcado {
+        QString nombre;
+        Politica politica;
+    };
+    std::vector<AlgoritmoMarcado> algoritmosMarcados() const;
+    ParametrosPolitica parametrosPolitica() const;
+    ConfigSMP configMotor() const;
+    void actualizarTablaBarrido(const std::vector<PuntoBarrido>& puntos, const std::vector<int>& costos);
+    void guardarResultados(const std::vector<ResultadoAlgoritmo>& resultados);
+    // Lanza los algoritmos marcados en hilos del QThreadPool global sobre una
+    // única CargaComparacion (validada e internada una vez); cada fila de la
+    // tabla se completa cuando termina su algoritmo. Con `cargaES` todas las
+    // políticas corren sobre simularConES (ráfagas CPU/E/S); ver
+    // ejecutarComparacion para el resto de los casos
+    void ejecutarAlgoritmos(const std::vector<Proceso>& procesos, const CargaES* cargaES = nullptr);
+
+    // Estado de la ejecución en curso (solo se toca desde el hilo de la GUI)
+    std::vector<ResultadoAlgoritmo> resultadosActuales;
+    int algoritmosPendientes = 0;
+    
+    // Última estimación del modelo analítico, por algoritmo marcado
+    std::vector<EstimacionAnalitica> estimacionesModelo;
+    QStringList nombresModelo;
 };
 
 #endif // ESTADISTICAS_H
\ No newline at end of file
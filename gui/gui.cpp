@@ -7,8 +7,9 @@
 #include "algoritmo.h"
 #include "synchronizer.h"
 #include "ganttwindow.h"     // Necesario para usar GanttWindow
-#include <QThread>           // Para QThread::msleep
-#include <QApplication>      // Para processEvents()
+#include "smp.h"
+#include "entradaSalida.h"
+#include "metricas.h"
 #include <QDesktopServices>
 #include <QUrl>
 #include <QTextStream>
@@ -17,6 +18,31 @@
 #include <QVBoxLayout>
 #include <QTextEdit>
 
+// Los loaders del núcleo no muestran diálogos: devuelven los errores y aquí
+// se presentan en un único QMessageBox::warning (si hay alguno).
+static void mostrarErroresCarga(QWidget *parent, const QString &titulo, const QStringList &errores) {
+    if (!errores.isEmpty()) {
+        QMessageBox::warning(parent, titulo, errores.join("\n"));
+    }
+}
+
+// Texto del comboAlgoritmo -> política del motor multicore
+static bool politicaDesdeTexto(const QString &algoritmo, Politica *politica) {
+    if (algoritmo.contains("FIFO", Qt::CaseInsensitive))                         *politica = Politica::FIFO;
+    else if (algoritmo.contains("Shortest Job First", Qt::CaseInsensitive))      *politica = Politica::SJF;
+    else if (algoritmo.contains("Priority Scheduling", Qt::CaseInsensitive))     *politica = Politica::Priority;
+    else if (algoritmo.contains("Shortest Remaining Time", Qt::CaseInsensitive)) *politica = Politica::SRT;
+    else if (algoritmo.contains("Preemptive Priority", Qt::CaseInsensitive))     *politica = Politica::PreemptivePriority;
+    else if (algoritmo.contains("MLFQ", Qt::CaseInsensitive))                    *politica = Politica::MLFQ;
+    else if (algoritmo.contains("CFS", Qt::CaseInsensitive))                     *politica = Politica::CFS;
+    else if (algoritmo.contains("Lottery", Qt::CaseInsensitive))                 *politica = Politica::Lottery;
+    else if (algoritmo.contains("Stride", Qt::CaseInsensitive))                  *politica = Politica::Stride;
+    else if (algoritmo.contains("Adaptativo", Qt::CaseInsensitive))              *politica = Politica::RoundRobinAdaptativo;
+    else if (algoritmo.contains("Round Robin", Qt::CaseInsensitive))             *politica = Politica::RoundRobin;
+    else return false;
+    return true;
+}
+
 // Constructor principal
 SimuladorGUI::SimuladorGUI(QWidget *parent)
     : QMainWindow(parent),
@@ -60,7 +86,15 @@ SimuladorGUI::SimuladorGUI(QWidget *parent)
         "Shortest Job First (SJF)",
         "Shortest Remaining Time (SRT)",
         "Round Robin",
-        "Priority Scheduling"
+        "Round Robin Adaptativo",
+        "Priority Scheduling",
+        "Preemptive Priority (Aging)",
+        "Multilevel Feedback Queue (MLFQ)",
+        "Completely Fair Scheduler (CFS)",
+        "Lottery Scheduling",
+        "Stride Scheduling",
+        "Earliest Deadline First (EDF)",
+        "Rate Monotonic (RMS)"
     });
 
     labelQuantum = new QLabel("Quantum:", this);
@@ -68,22 +102,183 @@ SimuladorGUI::SimuladorGUI(QWidget *parent)
     spinQuantum->setRange(1, 50);
     spinQuantum->setValue(4);
 
+    // Ciclos de espera por cada nivel de prioridad ganado (0 = sin aging)
+    labelEnvejecimiento = new QLabel("Envejecimiento (ciclos):", this);
+    spinEnvejecimiento  = new QSpinBox(this);
+    spinEnvejecimiento->setRange(0, 1000);
+    spinEnvejecimiento->setValue(5);
+    spinEnvejecimiento->setToolTip("Cada tantos ciclos de espera el proceso sube al siguiente valor de prioridad "
+                                   "presente en la carga (no resta 1 al valor); 0 = sin aging");
+
+    // MLFQ: un quantum por nivel y boost al nivel 0 cada N ciclos (0 = sin boost)
+    labelQuantumsMLFQ    = new QLabel("Quantums por nivel:", this);
+    lineEditQuantumsMLFQ = new QLineEdit("2,4,8", this);
+    labelBoost = new QLabel("Boost cada (ciclos):", this);
+    spinBoost  = new QSpinBox(this);
+    spinBoost->setRange(0, 10000);
+    spinBoost->setValue(50);
+
+    // CFS: periodo de reparto y slice mínimo en ciclos
+    labelLatencia = new QLabel("Latencia objetivo:", this);
+    spinLatencia  = new QSpinBox(this);
+    spinLatencia->setRange(1, 1000);
+    spinLatencia->setValue(6);
+    labelGranularidad = new QLabel("Granularidad mínima:", this);
+    spinGranularidad  = new QSpinBox(this);
+    spinGranularidad->setRange(1, 100);
+    spinGranularidad->setValue(1);
+
+    // Lottery: misma semilla = mismo sorteo (reproducible)
+    labelSemilla = new QLabel("Semilla:", this);
+    spinSemilla  = new QSpinBox(this);
+    spinSemilla->setRange(0, 1000000);
+    spinSemilla->setValue(1);
+
+    // RR adaptativo: el quantum de cada despacho es este percentil del tiempo
+    // restante en la cola ready (50 = mediana)
+    labelPercentil = new QLabel("Percentil del restante:", this);
+    spinPercentil  = new QSpinBox(this);
+    spinPercentil->setRange(1, 100);
+    spinPercentil->setValue(50);
+
     labelQuantum->setVisible(false);
     spinQuantum->setVisible(false);
+    labelPercentil->setVisible(false);
+    spinPercentil->setVisible(false);
+    labelSemilla->setVisible(false);
+    spinSemilla->setVisible(false);
+    labelLatencia->setVisible(false);
+    spinLatencia->setVisible(false);
+    labelGranularidad->setVisible(false);
+    spinGranularidad->setVisible(false);
+    labelEnvejecimiento->setVisible(false);
+    spinEnvejecimiento->setVisible(false);
+    labelQuantumsMLFQ->setVisible(false);
+    lineEditQuantumsMLFQ->setVisible(false);
+    labelBoost->setVisible(false);
+    spinBoost->setVisible(false);
 
     connect(comboAlgoritmo, &QComboBox::currentTextChanged, this, [=](const QString &text){
-        bool esRR = text.contains("Round Robin", Qt::CaseInsensitive);
-        labelQuantum->setVisible(esRR);
-        spinQuantum->setVisible(esRR);
+        bool esLottery = text.contains("Lottery", Qt::CaseInsensitive);
+        bool esAdaptativo = text.contains("Adaptativo", Qt::CaseInsensitive);
+        bool usaQuantum = (text.contains("Round Robin", Qt::CaseInsensitive) && !esAdaptativo) ||
+                          esLottery || text.contains("Stride", Qt::CaseInsensitive);
+        labelQuantum->setVisible(usaQuantum);
+        spinQuantum->setVisible(usaQuantum);
+        labelPercentil->setVisible(esAdaptativo);
+        spinPercentil->setVisible(esAdaptativo);
+        labelSemilla->setVisible(esLottery);
+        spinSemilla->setVisible(esLottery);
+        bool esAging = text.contains("Preemptive Priority", Qt::CaseInsensitive);
+        labelEnvejecimiento->setVisible(esAging);
+        spinEnvejecimiento->setVisible(esAging);
+        bool esMLFQ = text.contains("MLFQ", Qt::CaseInsensitive);
+        labelQuantumsMLFQ->setVisible(esMLFQ);
+        lineEditQuantumsMLFQ->setVisible(esMLFQ);
+        labelBoost->setVisible(esMLFQ);
+        spinBoost->setVisible(esMLFQ);
+        bool esCFS = text.contains("CFS", Qt::CaseInsensitive);
+        labelLatencia->setVisible(esCFS);
+        spinLatencia->setVisible(esCFS);
+        labelGranularidad->setVisible(esCFS);
+        spinGranularidad->setVisible(esCFS);
+
+        // EDF / RMS leen tareas periódicas: alterna el archivo por defecto
+        bool esTiempoReal = text.contains("(EDF)") || text.contains("(RMS)");
+        if (esTiempoReal && (archivoSeleccionado == "../data/procesos.txt" ||
+                             archivoSeleccionado == "../data/procesos_es.txt")) {
+            archivoSeleccionado = "../data/tareas_rt.txt";
+            lineEditArchivo->setText(archivoSeleccionado);
+        } else if (!esTiempoReal && archivoSeleccionado == "../data/tareas_rt.txt") {
+            archivoSeleccionado = checkRafagasES->isChecked() ? "../data/procesos_es.txt" : "../data/procesos.txt";
+            lineEditArchivo->setText(archivoSeleccionado);
+        }
     });
 
     QHBoxLayout *hQuantum = new QHBoxLayout();
     hQuantum->addWidget(labelQuantum);
     hQuantum->addWidget(spinQuantum);
+    hQuantum->addWidget(labelPercentil);
+    hQuantum->addWidget(spinPercentil);
+    hQuantum->addWidget(labelSemilla);
+    hQuantum->addWidget(spinSemilla);
+    hQuantum->addWidget(labelEnvejecimiento);
+    hQuantum->addWidget(spinEnvejecimiento);
+    hQuantum->addWidget(labelQuantumsMLFQ);
+    hQuantum->addWidget(lineEditQuantumsMLFQ);
+    hQuantum->addWidget(labelBoost);
+    hQuantum->addWidget(spinBoost);
+    hQuantum->addWidget(labelLatencia);
+    hQuantum->addWidget(spinLatencia);
+    hQuantum->addWidget(labelGranularidad);
+    hQuantum->addWidget(spinGranularidad);
+
+    // Multicore: con más de una CPU se usa el motor SMP (un carril por núcleo)
+    labelCPUs = new QLabel("CPUs:", this);
+    spinCPUs  = new QSpinBox(this);
+    spinCPUs->setRange(1, 64);
+    spinCPUs->setValue(1);
+    labelMigracion = new QLabel("Penalización migración (ciclos):", this);
+    spinMigracion  = new QSpinBox(this);
+    spinMigracion->setRange(0, 100);
+    spinMigracion->setValue(0);
+    checkRoboTrabajo = new QCheckBox("Robo de trabajo", this);
+    checkRoboTrabajo->setChecked(true);
+
+    QHBoxLayout *hCPUs = new QHBoxLayout();
+    hCPUs->addWidget(labelCPUs);
+    hCPUs->addWidget(spinCPUs);
+    hCPUs->addWidget(labelMigracion);
+    hCPUs->addWidget(spinMigracion);
+    hCPUs->addWidget(checkRoboTrabajo);
+
+    // Costo de cambio de contexto: con costo > 0 se usa el motor SMP, que lo
+    // cobra en cada despacho y lo pinta como bloque "CS" en el Gantt
+    labelCambioContexto = new QLabel("Cambio de contexto (ciclos):", this);
+    spinCambioContexto  = new QSpinBox(this);
+    spinCambioContexto->setRange(0, 100);
+    spinCambioContexto->setValue(0);
+    labelCambioMismo = new QLabel("Mismo proceso (ciclos):", this);
+    spinCambioMismo  = new QSpinBox(this);
+    spinCambioMismo->setRange(0, 100);
+    spinCambioMismo->setValue(0);
+
+    QHBoxLayout *hCambio = new QHBoxLayout();
+    hCambio->addWidget(labelCambioContexto);
+    hCambio->addWidget(spinCambioContexto);
+    hCambio->addWidget(labelCambioMismo);
+    hCambio->addWidget(spinCambioMismo);
+    hCambio->addStretch();
+
+    // Ráfagas CPU/E/S: cada dispositivo tiene su cola (FCFS o por prioridad)
+    checkRafagasES = new QCheckBox("Ráfagas de E/S", this);
+    labelDisciplinaES = new QLabel("Cola de E/S:", this);
+    comboDisciplinaES = new QComboBox(this);
+    comboDisciplinaES->addItems({ "FCFS", "Prioridad" });
+    labelDisciplinaES->setVisible(false);
+    comboDisciplinaES->setVisible(false);
+    hCPUs->addWidget(checkRafagasES);
+    hCPUs->addWidget(labelDisciplinaES);
+    hCPUs->addWidget(comboDisciplinaES);
+
+    connect(checkRafagasES, &QCheckBox::toggled, this, [=](bool checked) {
+        labelDisciplinaES->setVisible(checked);
+        comboDisciplinaES->setVisible(checked);
+        // Alterna el archivo por defecto entre procesos.txt y procesos_es.txt
+        if (checked && archivoSeleccionado == "../data/procesos.txt") {
+            archivoSeleccionado = "../data/procesos_es.txt";
+            lineEditArchivo->setText(archivoSeleccionado);
+        } else if (!checked && archivoSeleccionado == "../data/procesos_es.txt") {
+            archivoSeleccionado = "../data/procesos.txt";
+            lineEditArchivo->setText(archivoSeleccionado);
+        }
+    });
 
     vAlg->addWidget(lblAlg);
     vAlg->addWidget(comboAlgoritmo);
     vAlg->addLayout(hQuantum);
+    vAlg->addLayout(hCPUs);
+    vAlg->addLayout(hCambio);
 
     layout->addWidget(grupoAlgoritmo);
 
@@ -233,10 +428,14 @@ void SimuladorGUI::onSeleccionarArchivo() {
 }
 
 void SimuladorGUI::onArchivoDefault() {
-    archivoSeleccionado = "../data/procesos.txt";
+    QString algoritmo = comboAlgoritmo->currentText();
+    bool esTiempoReal = algoritmo.contains("(EDF)") || algoritmo.contains("(RMS)");
+    if (esTiempoReal)                       archivoSeleccionado = "../data/tareas_rt.txt";
+    else if (checkRafagasES->isChecked())   archivoSeleccionado = "../data/procesos_es.txt";
+    else                                    archivoSeleccionado = "../data/procesos.txt";
     lineEditArchivo->setText(archivoSeleccionado);
     QMessageBox::information(this, "Archivo por Defecto",
-                             "Se utilizará el archivo por defecto: ../data/procesos.txt");
+                             "Se utilizará el archivo por defecto: " + archivoSeleccionado);
 }
 
 // ---------------------
@@ -315,7 +514,9 @@ void SimuladorGUI::onArchivoDefaultSync() {
 // Slots: Mostrar contenido cargado (Simulación B)
 // ---------------------
 void SimuladorGUI::onVerProcesosSyncClicked() {
-    auto procesos = loadProcesos(procesosSyncRuta);
+    QStringList errores;
+    auto procesos = loadProcesos(procesosSyncRuta, &errores);
+    mostrarErroresCarga(this, "Errores en procesos.txt", errores);
     if (procesos.empty()) {
         QMessageBox::information(this, "Procesos Sync", "No hay procesos cargados.");
         return;
@@ -335,7 +536,9 @@ void SimuladorGUI::onVerProcesosSyncClicked() {
 }
 
 void SimuladorGUI::onVerRecursosSyncClicked() {
-    auto recursos = loadRecursos(recursosSyncRuta);
+    QStringList errores;
+    auto recursos = loadRecursos(recursosSyncRuta, &errores);
+    mostrarErroresCarga(this, "Errores en recursos.txt", errores);
     if (recursos.empty()) {
         QMessageBox::information(this, "Recursos Sync", "No hay recursos cargados.");
         return;
@@ -353,7 +556,9 @@ void SimuladorGUI::onVerRecursosSyncClicked() {
 }
 
 void SimuladorGUI::onVerAccionesSyncClicked() {
-    auto acciones = loadAcciones(accionesSyncRuta);
+    QStringList errores;
+    auto acciones = loadAcciones(accionesSyncRuta, &errores);
+    mostrarErroresCarga(this, "Errores en acciones.txt", errores);
     if (acciones.empty()) {
         QMessageBox::information(this, "Acciones Sync", "No hay acciones cargadas.");
         return;
@@ -413,8 +618,28 @@ void SimuladorGUI::onSimulacionAClicked() {
         return;
     }
 
-    // 2) Leer procesos
-    auto procesos = cargarProcesosDesdeArchivo(archivoSeleccionado);
+    // EDF / RMS: el archivo contiene tareas periódicas, no procesos
+    if (comboAlgoritmo->currentText().contains("(EDF)")) {
+        simularTareasPeriodicas(PoliticaTiempoReal::EDF);
+        return;
+    }
+    if (comboAlgoritmo->currentText().contains("(RMS)")) {
+        simularTareasPeriodicas(PoliticaTiempoReal::RMS);
+        return;
+    }
+
+    // 2) Leer procesos (con ráfagas de E/S, también sus perfiles y dispositivos)
+    QStringList erroresCarga;
+    const bool conES = checkRafagasES->isChecked();
+    CargaES cargaES;
+    std::vector<Proceso> procesos;
+    if (conES) {
+        cargaES = cargarProcesosES(archivoSeleccionado, &erroresCarga);
+        procesos = cargaES.procesos;
+    } else {
+        procesos = cargarProcesosDesdeArchivo(archivoSeleccionado, &erroresCarga);
+    }
+    mostrarErroresCarga(this, "Errores en procesos.txt", erroresCarga);
     if (procesos.empty()) {
         QMessageBox::warning(this, "Error", "No se cargaron procesos o formato incorrecto.");
         return;
@@ -427,6 +652,16 @@ void SimuladorGUI::onSimulacionAClicked() {
         QMessageBox::warning(this, "Error", "Quantum inválido. Debe ser un entero mayor que 0.");
         return;
     }
+    std::vector<int> quantumsMLFQ;
+    if (algoritmo.contains("MLFQ", Qt::CaseInsensitive)) {
+        QStringList erroresQuantum;
+        quantumsMLFQ = parsearQuantums(lineEditQuantumsMLFQ->text(), &erroresQuantum);
+        if (quantumsMLFQ.empty()) {
+            QMessageBox::warning(this, "Error", "Quantums de MLFQ inválidos. Use enteros > 0 separados por comas (ej. 2,4,8).\n\n" +
+                                 erroresQuantum.join("\n"));
+            return;
+        }
+    }
 
     // 4) Preparar el widget de Gantt
     if (ganttWidget) {
@@ -440,8 +675,53 @@ void SimuladorGUI::onSimulacionAClicked() {
     // 5) Invocar el algoritmo correspondiente
     std::vector<Proceso> ejecutados;
     std::vector<BloqueGantt> bloques;
-
-    if (algoritmo.contains("FIFO", Qt::CaseInsensitive)) {
+    const int numCPUs = spinCPUs->value();
+    ResultadoSMP resultadoSMP;
+    ResultadoES resultadoES;
+    const bool conCostoCambio = spinCambioContexto->value() > 0 || spinCambioMismo->value() > 0;
+    const bool usaMotor = numCPUs > 1 || conES || conCostoCambio;
+
+    if (usaMotor) {
+        Politica politica;
+        if (!politicaDesdeTexto(algoritmo, &politica)) {
+            QMessageBox::information(this, "Info", "Ese algoritmo aún no está implementado.");
+            return;
+        }
+        ParametrosPolitica parametros;
+        parametros.quantum = quantum;
+        parametros.envejecimiento = spinEnvejecimiento->value();
+        parametros.quantumPorNivel = quantumsMLFQ;
+        parametros.periodoBoost = spinBoost->value();
+        parametros.latenciaObjetivo = spinLatencia->value();
+        parametros.granularidadMinima = spinGranularidad->value();
+        parametros.semillaLoteria = static_cast<uint64_t>(spinSemilla->value());
+        parametros.percentilQuantum = spinPercentil->value();
+        ConfigSMP config;
+        config.numCPUs = numCPUs;
+        config.penalizacionMigracion = spinMigracion->value();
+        config.robarTrabajo = checkRoboTrabajo->isChecked();
+        config.costoCambioContexto = spinCambioContexto->value();
+        config.costoMismoProceso = spinCambioMismo->value();
+
+        if (conES) {
+            QStringList nombres;
+            const DisciplinaES disciplina = comboDisciplinaES->currentIndex() == 1
+                ? DisciplinaES::Prioridad : DisciplinaES::FCFS;
+            for (Dispositivo &d : cargaES.dispositivos) {
+                d.disciplina = disciplina;
+                nombres << d.nombre;
+            }
+            ganttWidget->configurarCPUs(numCPUs, nombres);
+            resultadoES = simularConES(procesos, cargaES.perfiles, cargaES.dispositivos,
+                                       politica, parametros, config, ganttWidget);
+            resultadoSMP = resultadoES.cpu;
+        } else {
+            ganttWidget->configurarCPUs(numCPUs);
+            resultadoSMP = simularMulticore(procesos, politica, parametros, config, ganttWidget);
+        }
+        ejecutados = resultadoSMP.procesos;
+    }
+    else if (algoritmo.contains("FIFO", Qt::CaseInsensitive)) {
         ejecutados = fifo(procesos, ganttWidget);
     }
     else if (algoritmo.contains("Shortest Job First", Qt::CaseInsensitive)) {
@@ -453,6 +733,24 @@ void SimuladorGUI::onSimulacionAClicked() {
     else if (algoritmo.contains("Shortest Remaining Time", Qt::CaseInsensitive)) {
         ejecutados = shortestRemainingTime(procesos, bloques, ganttWidget);
     }
+    else if (algoritmo.contains("Preemptive Priority", Qt::CaseInsensitive)) {
+        ejecutados = preemptivePriorityScheduling(procesos, spinEnvejecimiento->value(), bloques, ganttWidget);
+    }
+    else if (algoritmo.contains("MLFQ", Qt::CaseInsensitive)) {
+        ejecutados = multilevelFeedbackQueue(procesos, quantumsMLFQ, spinBoost->value(), bloques, ganttWidget);
+    }
+    else if (algoritmo.contains("CFS", Qt::CaseInsensitive)) {
+        ejecutados = completelyFairScheduler(procesos, spinLatencia->value(), spinGranularidad->value(), bloques, ganttWidget);
+    }
+    else if (algoritmo.contains("Lottery", Qt::CaseInsensitive)) {
+        ejecutados = lotteryScheduling(procesos, quantum, static_cast<uint64_t>(spinSemilla->value()), bloques, ganttWidget);
+    }
+    else if (algoritmo.contains("Stride", Qt::CaseInsensitive)) {
+        ejecutados = strideScheduling(procesos, quantum, bloques, ganttWidget);
+    }
+    else if (algoritmo.contains("Adaptativo", Qt::CaseInsensitive)) {
+        ejecutados = roundRobinAdaptativo(procesos, spinPercentil->value(), bloques, ganttWidget);
+    }
     else if (algoritmo.contains("Round Robin", Qt::CaseInsensitive)) {
         ejecutados = roundRobin(procesos, quantum, bloques, ganttWidget);
     }
@@ -467,13 +765,20 @@ void SimuladorGUI::onSimulacionAClicked() {
         QFile file(rutaSalida);
         if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
             QTextStream out(&file);
-            out << "PID,StartTime,CompletionTime,WaitingTime,TurnaroundTime\n";
-            for (const Proceso &p : ejecutados) {
+            // Cuota objetivo (justa ponderada por prioridad) vs. obtenida
+            std::vector<double> desviacion = calcularDesviacionCuota(ejecutados);
+            std::vector<CuotaProceso> cuotas = calcularCuotas(ejecutados);
+            out << "PID,StartTime,CompletionTime,WaitingTime,TurnaroundTime,ShareDeviation,TargetShare,AchievedShare\n";
+            for (size_t k = 0; k < ejecutados.size(); ++k) {
+                const Proceso &p = ejecutados[k];
                 out << p.pid << ","
                     << p.startTime << ","
                     << p.completionTime << ","
                     << p.waitingTime << ","
-                    << p.turnaroundTime << "\n";
+                    << p.turnaroundTime << ","
+                    << desviacion[k] << ","
+                    << cuotas[k].objetivo << ","
+                    << cuotas[k].obtenida << "\n";
             }
             file.close();
         } else {
@@ -489,11 +794,137 @@ void SimuladorGUI::onSimulacionAClicked() {
     }
     double promedio = calcularTiempoEsperaPromedio(procesos, ejecutados);
     resultado += "\nTiempo de espera promedio: " + QString::number(promedio, 'f', 2);
+    const MetricasEjecucion metricas = calcularMetricas(ejecutados);
+    resultado += QString("\nEspera p50/p90/p99/máx: %1 / %2 / %3 / %4")
+                     .arg(metricas.espera.p50).arg(metricas.espera.p90)
+                     .arg(metricas.espera.p99).arg(metricas.espera.maximo);
+    resultado += QString("\nRespuesta p90: %1, índice de Jain: %2")
+                     .arg(metricas.respuesta.p90)
+                     .arg(QString::number(metricas.indiceJain, 'f', 4));
+    if (usaMotor) {
+        resultado += QString("\nCambios de contexto: %1 (+%2 al mismo proceso), %3 ciclos perdidos")
+                         .arg(resultadoSMP.cambiosContexto)
+                         .arg(resultadoSMP.redespachos)
+                         .arg(resultadoSMP.ciclosCambio);
+    } else {
+        resultado += QString("\nCambios de contexto: %1 (sin costo)")
+                         .arg(contarCambiosContexto(ejecutados, bloques));
+    }
+    if (numCPUs > 1) {
+        resultado += QString("\n\nMulticore (%1 CPUs), makespan: %2").arg(numCPUs).arg(resultadoSMP.makespan);
+        for (size_t c = 0; c < resultadoSMP.cpus.size(); ++c) {
+            resultado += QString("\n  CPU %1: utilización %2 %, migraciones entrantes %3")
+                             .arg(c)
+                             .arg(QString::number(resultadoSMP.cpus[c].utilizacion * 100.0, 'f', 1))
+                             .arg(resultadoSMP.cpus[c].migracionesEntrantes);
+        }
+        resultado += QString("\nMigraciones: %1 (%2 ciclos de penalización)")
+                         .arg(resultadoSMP.migraciones).arg(resultadoSMP.ciclosMigracion);
+        resultado += "\nDesbalance de carga (máx/promedio - 1): " +
+                     QString::number(resultadoSMP.desbalanceCarga * 100.0, 'f', 1) + " %";
+    }
+    if (conES) {
+        resultado += "\n\nRáfagas de E/S, makespan: " + QString::number(resultadoSMP.makespan);
+        resultado += "\nUtilización de CPU: " + QString::number(resultadoES.utilizacionCPU * 100.0, 'f', 1) + " %";
+        resultado += "\nThroughput: " + QString::number(resultadoES.throughput, 'f', 4) + " procesos/ciclo";
+        for (const EstadisticasDispositivo &d : resultadoES.dispositivos) {
+            resultado += QString("\n  %1: utilización %2 %, %3 ráfagas, espera en cola %4")
+                             .arg(d.nombre)
+                             .arg(QString::number(d.utilizacion * 100.0, 'f', 1))
+                             .arg(d.atendidas)
+                             .arg(QString::number(d.esperaPromedio, 'f', 2));
+        }
+    }
 
     // 7) Mostrar cuadro de texto con métricas
     QMessageBox::information(this, "Resultado Simulación A", resultado);
 }
 
+// ---------------------
+// Simulación A con tareas periódicas (EDF / RMS), siempre en 1 CPU
+// ---------------------
+void SimuladorGUI::simularTareasPeriodicas(PoliticaTiempoReal politica) {
+    QStringList erroresCarga;
+    auto tareas = cargarTareasPeriodicas(archivoSeleccionado, &erroresCarga);
+    mostrarErroresCarga(this, "Errores en tareas periódicas", erroresCarga);
+    if (tareas.empty()) {
+        QMessageBox::warning(this, "Error",
+                             "No se cargaron tareas periódicas (formato: ID,Periodo,WCET[,Deadline[,Fase]]).");
+        return;
+    }
+    if (spinCPUs->value() > 1) {
+        QMessageBox::information(this, "Info", "EDF y RMS se simulan en una sola CPU.");
+    }
+
+    // Pre-chequeo analítico antes de simular
+    AnalisisTiempoReal analisis = analizarPlanificabilidad(tareas, politica);
+
+    if (ganttWidget) {
+        layout->removeWidget(ganttWidget);
+        delete ganttWidget;
+        ganttWidget = nullptr;
+    }
+    ganttWidget = new GanttWindow(this);
+    layout->addWidget(ganttWidget);
+
+    ResultadoTiempoReal resultadoRT = simularTiempoReal(tareas, politica, 0, ganttWidget);
+    if (resultadoRT.trabajos == 0) {
+        QMessageBox::warning(this, "Error",
+                             "No se pudo simular: tareas inválidas o hiperperiodo demasiado grande.");
+        return;
+    }
+
+    // ESCRIBIR resultados_simA.txt (una fila por tarea)
+    {
+        QFile file("resultados_simA.txt");
+        if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            QTextStream out(&file);
+            out << "Task,Jobs,MissedDeadlines,MaxLateness,AvgLateness,MaxResponse\n";
+            for (const auto& t : resultadoRT.tareas) {
+                out << t.id << ","
+                    << t.trabajos << ","
+                    << t.deadlinesPerdidos << ","
+                    << t.latenciaMaxima << ","
+                    << t.latenciaPromedio << ","
+                    << t.respuestaMaxima << "\n";
+            }
+            file.close();
+        } else {
+            QMessageBox::warning(this, "Error al escribir archivo",
+                                 "No se pudo crear 'resultados_simA.txt'.");
+        }
+    }
+
+    QString resultado = QString("%1 sobre %2 tareas\n\n")
+                            .arg(politica == PoliticaTiempoReal::EDF ? "EDF" : "RMS")
+                            .arg(tareas.size());
+    resultado += QString("Pre-chequeo: U = %1").arg(QString::number(analisis.utilizacion, 'f', 3));
+    if (politica == PoliticaTiempoReal::RMS) {
+        resultado += QString(" (cota Liu-Layland %1)").arg(QString::number(analisis.cotaLiuLayland, 'f', 3));
+    }
+    resultado += QString("\n  %1%2\n  %3\n")
+                     .arg(analisis.planificable ? "Planificable" : "No planificable")
+                     .arg(analisis.concluyente ? "" : " (no concluyente)")
+                     .arg(analisis.detalle);
+
+    resultado += QString("\nHorizonte: %1 ciclos, trabajos: %2, deadlines perdidos: %3")
+                     .arg(resultadoRT.horizonte).arg(resultadoRT.trabajos).arg(resultadoRT.deadlinesPerdidos);
+    resultado += "\nUtilización de CPU: " + QString::number(resultadoRT.utilizacionCPU * 100.0, 'f', 1) + " %\n";
+    for (const auto& t : resultadoRT.tareas) {
+        resultado += QString("\n  %1: %2 trabajos, %3 perdidos, latencia máx %4, respuesta máx %5")
+                         .arg(t.id).arg(t.trabajos).arg(t.deadlinesPerdidos)
+                         .arg(t.latenciaMaxima).arg(t.respuestaMaxima);
+    }
+
+    // Distribución de latencia (fin - deadline): <= 0 a tiempo, > 0 atrasado
+    resultado += "\n\nDistribución de latencia (ciclos: trabajos):";
+    for (const auto& par : resultadoRT.distribucionLatencia) {
+        resultado += QString("\n  %1: %2").arg(par.first).arg(par.second);
+    }
+
+    QMessageBox::information(this, "Resultado Simulación A", resultado);
+}
+
 // ---------------------
 // Slot: Simulación B (Mutex/Semáforo)
 // ---------------------
@@ -508,9 +939,13 @@ void SimuladorGUI::onSimulacionBClicked() {
     }
 
     // 2) Cargar los datos
-    auto procSync = loadProcesos(procesosSyncRuta);
-    auto recsSync = loadRecursos(recursosSyncRuta);
-    auto actsSync = loadAcciones(accionesSyncRuta);
+    QStringList erroresProc, erroresRecs, erroresActs;
+    auto procSync = loadProcesos(procesosSyncRuta, &erroresProc);
+    auto recsSync = loadRecursos(recursosSyncRuta, &erroresRecs);
+    auto actsSync = loadAcciones(accionesSyncRuta, &erroresActs);
+    mostrarErroresCarga(this, "Errores en procesos.txt", erroresProc);
+    mostrarErroresCarga(this, "Errores en recursos.txt", erroresRecs);
+    mostrarErroresCarga(this, "Errores en acciones.txt", erroresActs);
 
     if (procSync.empty()) {
         QMessageBox::warning(this, "Error", "No se cargaron procesos para Simulación B.");
@@ -537,14 +972,21 @@ void SimuladorGUI::onSimulacionBClicked() {
     // 4) Revisar el modo seleccionado (Mutex vs Semáforo)
     bool usarSemaforo = rbSemaforo->isChecked();
     std::vector<BloqueSync> timeline;
+    QStringList erroresValidacion;
     if (!usarSemaforo) {
-        timeline = simulateMutex(actsSync, recsSync, procSync, static_cast<GanttWindow*>(ganttWidget), this);
+        timeline = simulateMutex(actsSync, recsSync, procSync, ganttWidget, &erroresValidacion);
     } else {
-        timeline = simulateSyncSemaforo(actsSync, recsSync, procSync, static_cast<GanttWindow*>(ganttWidget), this);
+        timeline = simulateSyncSemaforo(actsSync, recsSync, procSync, ganttWidget, &erroresValidacion);
     }
 
+    if (!erroresValidacion.isEmpty()) {
+        QString mensajeCompleto = "Se encontraron los siguientes errores de validación:\n\n";
+        mensajeCompleto += erroresValidacion.join("\n");
+        mensajeCompleto += "\n\nLa simulación no puede continuar.";
+        QMessageBox::critical(this, "Error de Validación - Sincronizador", mensajeCompleto);
+        return;
+    }
     if (timeline.empty()) {
-        // La alerta ya se mostró automáticamente en las funciones de validación
         return;
     }
 }
@@ -15,8 +15,10 @@
 #include <QString>
 #include "algoritmo.h"   // Para bloques de Gantt y simulación B
 #include "ganttwindow.h"
+#include "tiempoReal.h"  // EDF / RMS sobre tareas periódicas
 #include <QRadioButton>    // Para los nuevos radio buttons
 #include <QButtonGroup>    // Para agrupar los dos radio buttons
+#include <QCheckBox>
 
 class SimuladorGUI : public QMainWindow {
     Q_OBJECT
@@ -60,6 +62,32 @@ private:
     QComboBox   *comboAlgoritmo;
     QLabel      *labelQuantum;
     QSpinBox    *spinQuantum;
+    QLabel      *labelEnvejecimiento;  // Aging de Preemptive Priority
+    QSpinBox    *spinEnvejecimiento;
+    QLabel      *labelQuantumsMLFQ;    // Quantum por nivel de MLFQ ("2,4,8")
+    QLineEdit   *lineEditQuantumsMLFQ;
+    QLabel      *labelBoost;           // Periodo de boost de MLFQ
+    QSpinBox    *spinBoost;
+    QLabel      *labelLatencia;        // Latencia objetivo de CFS
+    QSpinBox    *spinLatencia;
+    QLabel      *labelGranularidad;    // Granularidad mínima de CFS
+    QSpinBox    *spinGranularidad;
+    QLabel      *labelSemilla;         // Semilla del sorteo de Lottery
+    QSpinBox    *spinSemilla;
+    QLabel      *labelPercentil;       // RR adaptativo: percentil del restante (50 = mediana)
+    QSpinBox    *spinPercentil;
+    QLabel      *labelCPUs;            // Número de núcleos (multicore si > 1)
+    QSpinBox    *spinCPUs;
+    QLabel      *labelMigracion;       // Penalización de migración en ciclos
+    QSpinBox    *spinMigracion;
+    QCheckBox   *checkRoboTrabajo;     // Núcleos ociosos roban de la cola más cargada
+    QLabel      *labelCambioContexto;  // Costo de cambiar a otro proceso (ciclos)
+    QSpinBox    *spinCambioContexto;
+    QLabel      *labelCambioMismo;     // Costo de re-despachar al mismo proceso (ciclos)
+    QSpinBox    *spinCambioMismo;
+    QCheckBox   *checkRafagasES;       // Procesos con ráfagas CPU/E/S (procesos_es.txt)
+    QLabel      *labelDisciplinaES;    // Orden de las colas de los dispositivos
+    QComboBox   *comboDisciplinaES;
 
     QGroupBox   *grupoSimulacion;      // Botones “Simulación A” y “Simulación B”
     QPushButton *btnSimA;
@@ -102,6 +130,9 @@ private:
     QString procesosSyncRuta;         // Para Simulación B
     QString recursosSyncRuta;
     QString accionesSyncRuta;
+
+    // Simulación A con tareas periódicas (EDF / RMS) sobre archivoSeleccionado
+    void simularTareasPeriodicas(PoliticaTiempoReal politica);
 };
 
 #endif // SIMULADORGUI_H
\ No newline at end of file
@@ -3,31 +3,127 @@
 
 #include <QString>
 #include <vector>
+#include <cstdint>
 #include "proceso.h"
 #include "tipos.h"
-
-class GanttWindow;
+#include "observador.h"
+#include "carga.h"
+#include "politica.h"
 
 // ----- Algoritmos de Scheduling (Simulación A) -----
-std::vector<Proceso> fifo(const std::vector<Proceso>& procesos, GanttWindow* gantt = nullptr );
+std::vector<Proceso> fifo(const std::vector<Proceso>& procesos, ObservadorSimulacion* obs = nullptr );
 std::vector<Proceso> roundRobin(
     const std::vector<Proceso>& procesos,
     int quantum,
     std::vector<BloqueGantt>& bloques,
-    GanttWindow* gantt = nullptr
+    ObservadorSimulacion* obs = nullptr
+);
+// Round Robin adaptativo: en cada despacho el quantum es el percentil
+// `percentil` (50 = mediana) del tiempo restante de los procesos en la cola
+// ready, incluido el despachado; la distribución se mantiene incrementalmente
+std::vector<Proceso> roundRobinAdaptativo(
+    const std::vector<Proceso>& procesosOriginal,
+    int percentil,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs = nullptr
 );
-std::vector<Proceso> shortestJobFirst(const std::vector<Proceso>& procesos, GanttWindow* gantt = nullptr);
-std::vector<Proceso> priorityScheduling(const std::vector<Proceso>& procesos, GanttWindow* gantt = nullptr);
+std::vector<Proceso> shortestJobFirst(const std::vector<Proceso>& procesos, ObservadorSimulacion* obs = nullptr);
+std::vector<Proceso> priorityScheduling(const std::vector<Proceso>& procesos, ObservadorSimulacion* obs = nullptr);
 std::vector<Proceso> shortestRemainingTime(
     const std::vector<Proceso>& procesosOriginal,
     std::vector<BloqueGantt>& bloques,
-    GanttWindow* gantt = nullptr
+    ObservadorSimulacion* obs = nullptr
+);
+// Priority expropiativo: cada `envejecimiento` ciclos en espera la prioridad
+// sube un nivel (0 = sin aging). Los niveles son los rangos densos de las
+// prioridades presentes (rangosPrioridad), no sus valores: con prioridades
+// {1, 5, 9} un proceso de prioridad 9 alcanza a los de 5 tras un intervalo.
+// La velocidad del aging en valor depende así de qué prioridades hay en la carga
+std::vector<Proceso> preemptivePriorityScheduling(
+    const std::vector<Proceso>& procesosOriginal,
+    int envejecimiento,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs = nullptr
+);
+// MLFQ: un nivel por quantum en `quantumPorNivel`, degradación al agotar el
+// quantum y boost al nivel 0 cada `periodoBoost` ciclos (0 = sin boost)
+std::vector<Proceso> multilevelFeedbackQueue(
+    const std::vector<Proceso>& procesosOriginal,
+    const std::vector<int>& quantumPorNivel,
+    int periodoBoost,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs = nullptr
+);
+// CFS: vruntime ponderado por prioridad, slice según latencia objetivo y
+// granularidad mínima
+std::vector<Proceso> completelyFairScheduler(
+    const std::vector<Proceso>& procesosOriginal,
+    int latenciaObjetivo,
+    int granularidadMinima,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs = nullptr
 );
+// Stride: el de menor pase corre un quantum; el pase avanza en proporción
+// inversa a los tickets (pesoPorPrioridad)
+std::vector<Proceso> strideScheduling(
+    const std::vector<Proceso>& procesosOriginal,
+    int quantum,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs = nullptr
+);
+// Lottery: en cada quantum gana un boleto al azar entre los tickets
+// (pesoPorPrioridad) de los procesos listos; reproducible con `semilla`
+std::vector<Proceso> lotteryScheduling(
+    const std::vector<Proceso>& procesosOriginal,
+    int quantum,
+    uint64_t semilla,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs = nullptr
+);
+// Corre `politica` sobre una carga ya internada y validada (procesosValidos)
+// sin volver a copiar ni ordenar los procesos: varias políticas pueden
+// compartir la misma `carga`. Devuelve el orden del resultado como
+// permutación de ids, las métricas en columnas y la línea de tiempo
+// run-length (también en FIFO, SJF y Priority), sin copiar ningún Proceso
+// ni PID; expandirResultado (carga.h) da lo mismo que la función de la política
+ResultadoCompacto ejecutarPoliticaCompacta(
+    const CargaTrabajo& carga,
+    Politica politica,
+    const ParametrosPolitica& parametros,
+    ObservadorSimulacion* obs = nullptr
+);
+// ejecutarPoliticaCompacta expandido a un Proceso por id, con la línea de
+// tiempo agregada a `bloques` (sin los tramos ociosos)
+std::vector<Proceso> ejecutarPolitica(
+    const CargaTrabajo& carga,
+    Politica politica,
+    const ParametrosPolitica& parametros,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs = nullptr
+);
+// Peso de CPU de una prioridad (nice 0..19, tabla de Linux)
+int pesoPorPrioridad(int priority);
+// Fracción de CPU durante la estadía [llegada, fin) de un proceso
+struct CuotaProceso {
+    double objetivo = 0.0; // Reparto justo ponderado por peso (GPS)
+    double obtenida = 0.0; // burstTime / (fin - llegada)
+};
+// Cuota objetivo y obtenida de cada proceso, en el orden de `ejecucion`
+// (sirve para cualquier política)
+std::vector<CuotaProceso> calcularCuotas(const std::vector<Proceso>& ejecucion);
+// Desviación relativa de cada proceso respecto de su cuota justa ponderada,
+// en el orden de `ejecucion` (sirve para cualquier política)
+std::vector<double> calcularDesviacionCuota(const std::vector<Proceso>& ejecucion);
+// Cambios de contexto de una ejecución en una CPU sin costo de cambio: pares
+// consecutivos de `bloques` con PID distinto. FIFO, SJF y Priority no llenan
+// bloques y corren cada proceso de una vez: n - 1 cambios
+int contarCambiosContexto(const std::vector<Proceso>& ejecucion,
+                          const std::vector<BloqueGantt>& bloques);
+// Convierte "2,4,8" en quantums por nivel; vacío si hay algún valor inválido
+std::vector<int> parsearQuantums(const QString& texto, QStringList* errores = nullptr);
 double calcularTiempoEsperaPromedio(
     const std::vector<Proceso>& procesosOriginal,
     const std::vector<Proceso>& ejecucion
 );
 
-void delay(int milisegundos);
-
 #endif
\ No newline at end of file
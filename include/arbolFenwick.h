@@ -0,0 +1,69 @@
+#ifndef ARBOLFENWICK_H
+#define ARBOLFENWICK_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * Árbol de Fenwick (Binary Indexed Tree) sobre los tickets de cada id.
+ * - sumar(id, delta): O(log n)
+ * - buscar(r): id ganador del boleto r en [0, total()), O(log n) bajando por
+ *   potencias de dos (sin búsqueda binaria sobre prefijos)
+ * Un id con 0 tickets nunca gana. Los ids son los ids densos de CargaTrabajo.
+ */
+class arbolFenwick {
+public:
+    explicit arbolFenwick(size_t capacidadIds = 0)
+        : arbol(capacidadIds + 1, 0), valores(capacidadIds, 0), suma(0), mascaraAlta(1) {
+        while (mascaraAlta * 2 <= capacidadIds) mascaraAlta *= 2;
+    }
+
+    void sumar(uint32_t id, int64_t delta) {
+        if (id >= valores.size()) {
+            throw std::out_of_range("arbolFenwick: id fuera de rango");
+        }
+        if (valores[id] + delta < 0) {
+            throw std::runtime_error("arbolFenwick: tickets negativos");
+        }
+        valores[id] += delta;
+        suma += delta;
+        for (size_t k = static_cast<size_t>(id) + 1; k < arbol.size(); k += k & (~k + 1)) {
+            arbol[k] += delta;
+        }
+    }
+
+    // Fija los tickets de un id (0 = fuera del sorteo)
+    void asignar(uint32_t id, int64_t tickets) {
+        sumar(id, tickets - valor(id));
+    }
+
+    // Menor id cuya suma de prefijo supera r (r en [0, total()))
+    uint32_t buscar(int64_t r) const {
+        if (r < 0 || r >= suma) {
+            throw std::out_of_range("arbolFenwick: boleto fuera de rango");
+        }
+        size_t pos = 0;
+        for (size_t paso = mascaraAlta; paso > 0; paso /= 2) {
+            size_t siguiente = pos + paso;
+            if (siguiente < arbol.size() && arbol[siguiente] <= r) {
+                pos = siguiente;
+                r -= arbol[siguiente];
+            }
+        }
+        return static_cast<uint32_t>(pos); // Índice base 1 (pos + 1) -> id pos
+    }
+
+    int64_t valor(uint32_t id) const { return id < valores.size() ? valores[id] : 0; }
+    int64_t total() const { return suma; }
+    bool isEmpty() const { return suma == 0; }
+
+private:
+    std::vector<int64_t> arbol;   // Base 1: arbol[k] suma (k - lowbit(k), k]
+    std::vector<int64_t> valores; // Tickets actuales por id
+    int64_t suma;
+    size_t mascaraAlta;           // Mayor potencia de 2 <= capacidad
+};
+
+#endif // ARBOLFENWICK_H
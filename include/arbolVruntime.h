@@ -0,0 +1,86 @@
+#ifndef ARBOLVRUNTIME_H
+#define ARBOLVRUNTIME_H
+
+#include <vector>
+#include <set>
+#include <cstdint>
+#include <stdexcept>
+
+/**
+ * Conjunto ordenado de procesos ejecutables por vruntime (estilo CFS).
+ * Árbol rojo-negro (std::set) con el nodo más a la izquierda cacheado:
+ * - insert / erase por id: O(log n)
+ * - leftmost(): O(1) (el mínimo vruntime, siguiente a ejecutar)
+ * A igual vruntime sale primero el que se insertó antes (como en CFS, los
+ * empates se insertan a la derecha). Los ids son los ids densos de CargaTrabajo.
+ */
+class arbolVruntime {
+public:
+    struct Nodo {
+        int64_t  vruntime;
+        uint64_t secuencia; // Orden de inserción para desempatar
+        uint32_t id;
+        bool operator<(const Nodo &otro) const {
+            if (vruntime != otro.vruntime) return vruntime < otro.vruntime;
+            return secuencia < otro.secuencia;
+        }
+    };
+
+    explicit arbolVruntime(size_t capacidadIds = 0)
+        : handles(capacidadIds), presente(capacidadIds, false),
+          izquierdo(arbol.end()), contador(0) {}
+
+    void insert(uint32_t id, int64_t vruntime) {
+        if (contains(id)) {
+            throw std::runtime_error("arbolVruntime: id ya presente");
+        }
+        if (id >= presente.size()) {
+            handles.resize(static_cast<size_t>(id) + 1);
+            presente.resize(static_cast<size_t>(id) + 1, false);
+        }
+        auto it = arbol.insert(Nodo{vruntime, contador++, id}).first;
+        handles[id] = it;
+        presente[id] = true;
+        // Actualizar el caché solo si el nuevo nodo queda más a la izquierda
+        if (izquierdo == arbol.end() || *it < *izquierdo) {
+            izquierdo = it;
+        }
+    }
+
+    bool erase(uint32_t id) {
+        if (!contains(id)) return false;
+        auto it = handles[id];
+        if (it == izquierdo) {
+            izquierdo = std::next(it);
+        }
+        arbol.erase(it);
+        presente[id] = false;
+        return true;
+    }
+
+    const Nodo &leftmost() const { // Mínimo vruntime (sin eliminarlo)
+        if (izquierdo == arbol.end()) {
+            throw std::runtime_error("arbolVruntime: árbol vacío");
+        }
+        return *izquierdo;
+    }
+
+    Nodo popLeftmost() {
+        Nodo nodo = leftmost();
+        erase(nodo.id);
+        return nodo;
+    }
+
+    bool contains(uint32_t id) const { return id < presente.size() && presente[id]; }
+    bool isEmpty() const { return arbol.empty(); }
+    int size() const { return static_cast<int>(arbol.size()); }
+
+private:
+    std::set<Nodo> arbol;
+    std::vector<std::set<Nodo>::iterator> handles; // id -> nodo en el árbol
+    std::vector<bool> presente;
+    std::set<Nodo>::iterator izquierdo;            // Caché del nodo más a la izquierda
+    uint64_t contador;
+};
+
+#endif // ARBOLVRUNTIME_H
@@ -0,0 +1,36 @@
+#ifndef BARRIDO_H
+#define BARRIDO_H
+
+#include <vector>
+#include "proceso.h"
+
+// Un punto del barrido de Round Robin: métricas agregadas para un par
+// (quantum, costo de cambio de contexto)
+struct PuntoBarrido {
+    int quantum = 0;
+    int costoCambio = 0;
+    double esperaPromedio = 0.0;
+    double turnaroundPromedio = 0.0;
+    long long cambiosContexto = 0;
+};
+
+/**
+ * Evalúa Round Robin para cada quantum en [quantumMin, quantumMax] cruzado
+ * con cada costo de cambio de contexto de `costosCambio` (vacío = solo 0).
+ * Las corridas son independientes: se reparten entre `hilos` hilos (0 = todos
+ * los núcleos) y comparten la misma carga internada, de solo lectura.
+ * Un cambio de contexto ocurre cuando la CPU pasa a un proceso distinto del
+ * último que ejecutó y consume `costoCambio` ciclos sin avanzar a nadie.
+ * El resultado va ordenado por (costo, quantum).
+ */
+std::vector<PuntoBarrido> barridoQuantumRR(const std::vector<Proceso>& procesos,
+                                           int quantumMin,
+                                           int quantumMax,
+                                           const std::vector<int>& costosCambio = {},
+                                           int hilos = 0);
+
+// Índice del punto con menor espera promedio entre los de costo `costoCambio`
+// (a igualdad, el de menor quantum); -1 si no hay ninguno
+int mejorPuntoBarrido(const std::vector<PuntoBarrido>& puntos, int costoCambio);
+
+#endif // BARRIDO_H
@@ -0,0 +1,98 @@
+#ifndef CARGA_H
+#define CARGA_H
+
+#include <QString>
+#include <cstdint>
+#include <vector>
+#include "proceso.h"
+#include "lineaTiempo.h"
+#include "kernelsMetricas.h"
+
+/**
+ * Carga de trabajo "internada": cada proceso se identifica con un id denso
+ * (uint32_t, su índice en el vector de entrada) y sus datos se guardan en
+ * arreglos planos indexados por ese id. Los algoritmos trabajan solo con ids;
+ * el PID (QString) se usa únicamente al emitir resultados.
+ */
+struct CargaTrabajo {
+    std::vector<QString>  pids;          // id -> PID original
+    std::vector<int>      burstTime;     // id -> ráfaga
+    std::vector<int>      arrivalTime;   // id -> llegada
+    std::vector<int>      priority;      // id -> prioridad
+    std::vector<uint32_t> ordenLlegada;  // ids ordenados (estable) por arrivalTime
+
+    size_t size() const { return pids.size(); }
+    // Proceso `id` con sus datos de entrada y las métricas sin calcular
+    Proceso proceso(uint32_t id) const;
+};
+
+/**
+ * Interna un vector de procesos: id = posición en `procesos`. Se hace una
+ * sola vez por carga; las variantes de los algoritmos que reciben una
+ * CargaTrabajo la comparten (solo lectura) sin volver a copiar ni ordenar.
+ */
+CargaTrabajo internarProcesos(const std::vector<Proceso> &procesos);
+
+/**
+ * Prioridad de cada id comprimida a rangos densos (0 = la más urgente de la
+ * carga, mismo orden y empates que `priority`); `niveles` recibe la cantidad
+ * de prioridades distintas. Las colas por nivel se dimensionan así por las
+ * prioridades presentes y no por el valor máximo (que puede ser INT_MAX).
+ */
+std::vector<int> rangosPrioridad(const CargaTrabajo &carga, int *niveles = nullptr);
+
+/**
+ * Defensiva común de las entradas: no vacío, arrivalTime >= 0, burstTime > 0
+ * y priority >= 0. Reporta el primer problema por qDebug con el prefijo
+ * `funcion` y devuelve false.
+ */
+bool procesosValidos(const std::vector<Proceso> &procesos, const char *funcion);
+
+/**
+ * Resultado compacto de una política: el orden en que la política devuelve
+ * los procesos, como permutación de ids (índices de la entrada), sus
+ * métricas en columnas indexadas por id y la línea de tiempo run-length.
+ * No copia ningún Proceso ni QString (el PID está en carga.pids[id]): unos
+ * 20 bytes por proceso más 16 por tramo.
+ */
+struct ResultadoCompacto {
+    std::vector<uint32_t> orden;  // ids en el orden del resultado
+    std::vector<int> inicio;      // id -> startTime
+    std::vector<int> fin;         // id -> completionTime
+    std::vector<int> espera;      // id -> waitingTime
+    std::vector<int> turnaround;  // id -> turnaroundTime
+    ReduccionesMetricas reducciones; // Suma, mínimo y máximo de espera, turnaround y respuesta
+    LineaTiempo lineaTiempo;      // Tramos de ejecución y ociosos de la CPU
+
+    size_t size() const { return orden.size(); }
+};
+
+/**
+ * Llena `espera`, `turnaround` y `reducciones` de `resultado` a partir de
+ * `inicio` y `fin` con el kernel vectorizado de kernelsMetricas.h, en una
+ * sola pasada. `ciclosES` (opcional, por id) son ciclos fuera de la CPU que
+ * no cuentan como espera.
+ */
+void completarMetricas(const CargaTrabajo &carga, ResultadoCompacto &resultado,
+                       const std::vector<int> *ciclosES = nullptr);
+
+/**
+ * Resultado de las políticas expropiativas: orden estable por completionTime
+ * (a igual fin, orden del archivo) y métricas completas.
+ */
+ResultadoCompacto compactarPorTerminacion(const CargaTrabajo &carga,
+                                          std::vector<int> primeraEjecucion,
+                                          std::vector<int> ultimaEjecucion,
+                                          LineaTiempo lineaTiempo,
+                                          const std::vector<int> *ciclosES = nullptr);
+
+// Adaptador al formato clásico: un Proceso por id de `resultado.orden`
+std::vector<Proceso> expandirResultado(const CargaTrabajo &carga, const ResultadoCompacto &resultado);
+
+// compactarPorTerminacion expandido (motor de simularMulticore / simularConES)
+std::vector<Proceso> resultadosPorTerminacion(const CargaTrabajo &carga,
+                                              const std::vector<int> &primeraEjecucion,
+                                              const std::vector<int> &ultimaEjecucion,
+                                              const std::vector<int> *ciclosES = nullptr);
+
+#endif // CARGA_H
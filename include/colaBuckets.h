@@ -0,0 +1,63 @@
+#ifndef COLABUCKETS_H
+#define COLABUCKETS_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Cola de prioridad por buckets para prioridades enteras pequeñas
+ * (0 = más prioritario). Cada nivel es una cola FIFO intrusiva (listas
+ * doblemente enlazadas sobre arreglos indexados por id denso) y un bitmap de
+ * dos niveles marca los niveles no vacíos, así que:
+ * - pushBack / remove / cambio de nivel: O(1)
+ * - mejorNivel(): find-first-set sobre el bitmap (sin heap)
+ * - promoverTodos(): O(niveles); el nivel de cada id se corrige al leerlo
+ *   con una marca de época (quien se encoló antes del último promoverTodos
+ *   está en su destino)
+ * La usan Priority expropiativo (con aging) y MLFQ (boost con promoverTodos).
+ */
+class colaBuckets {
+public:
+    // Constructor: `niveles` prioridades posibles [0, niveles) y capacidad de ids
+    colaBuckets(int niveles, size_t capacidadIds);
+
+    void pushBack(uint32_t id, int nivel); // Encola al final de su nivel
+    bool remove(uint32_t id);              // Saca un id de cualquier posición
+    uint32_t popMejor();                   // Saca el frente del mejor nivel
+    uint32_t front(int nivel) const;       // Frente de un nivel no vacío
+    void promoverTodos(int destino);       // Une todos los niveles en `destino`
+    std::vector<uint32_t> enOrden() const; // Ids en el orden en que saldrían por popMejor
+
+    int mejorNivel() const;                // Nivel no vacío más prioritario o -1
+    bool contains(uint32_t id) const;
+    int nivelDe(uint32_t id) const;        // Nivel de un id encolado o -1
+    bool isEmpty() const { return total == 0; }
+    int size() const { return total; }
+    int niveles() const { return static_cast<int>(cabeza.size()); }
+
+private:
+    static constexpr int32_t NINGUNO = -1;
+
+    void marcar(int nivel);
+    void desmarcar(int nivel);
+    int nivelActual(uint32_t id) const;    // Nivel de un id encolado, con la época aplicada
+
+    // Listas intrusivas
+    std::vector<int32_t> cabeza;     // nivel -> primer id (o NINGUNO)
+    std::vector<int32_t> ultimo;     // nivel -> último id
+    std::vector<int32_t> siguiente;  // id -> siguiente en su nivel
+    std::vector<int32_t> anterior;   // id -> anterior en su nivel
+    std::vector<int32_t> nivelId;    // id -> nivel al encolarse (o NINGUNO)
+    std::vector<uint32_t> epocaId;   // id -> época en que se encoló
+    uint32_t epoca = 0;              // Cantidad de promoverTodos
+    int destinoPromocion = 0;        // Destino del último promoverTodos
+
+    // Bitmap de niveles no vacíos: bit k de bitmap[w] = nivel 64*w + k;
+    // bit w de resumen[r] = bitmap[64*r + w] != 0
+    std::vector<uint64_t> bitmap;
+    std::vector<uint64_t> resumen;
+    int total;
+};
+
+#endif // COLABUCKETS_H
@@ -0,0 +1,68 @@
+#ifndef COMPARACION_H
+#define COMPARACION_H
+
+#include <vector>
+#include "proceso.h"
+#include "carga.h"
+#include "politica.h"
+#include "metricas.h"
+#include "smp.h"
+#include "entradaSalida.h"
+
+/**
+ * Carga compartida por todas las políticas de una comparación: se valida, se
+ * interna y se ordena por llegada una sola vez. Con ráfagas de E/S lleva
+ * además los perfiles y los dispositivos. Es de solo lectura, así varios
+ * hilos pueden correr políticas sobre la misma CargaComparacion a la vez.
+ */
+struct CargaComparacion {
+    CargaTrabajo carga;
+    std::vector<PerfilES> perfiles;        // Vacío sin ráfagas de E/S
+    std::vector<Dispositivo> dispositivos;
+
+    bool valida() const { return carga.size() > 0; }
+    bool conES() const { return !perfiles.empty(); }
+};
+
+// Métricas de una política en la comparación
+struct ResultadoComparacion {
+    Politica politica = Politica::FIFO;
+    bool ejecutado = false;
+    std::vector<Proceso> procesos;            // Ordenados como los devuelve la política; vacío con soloAgregados
+    MetricasEjecucion metricas;
+    double utilizacionCPU = 0.0;              // Ciclos ocupados / (CPUs · makespan)
+    double throughput = 0.0;                  // Procesos terminados / makespan
+    double desviacionCuotaPromedio = 0.0;     // Media de |desviación de cuota|; necesita `procesos`
+    std::vector<EstadisticasDispositivo> dispositivos; // Solo con ráfagas de E/S
+    int cambiosContexto = 0;
+    long long ciclosCambio = 0;
+};
+
+// Valida e interna `procesos` una sola vez. Si hay algún proceso inválido lo
+// reporta por qDebug y devuelve una carga vacía (valida() == false)
+CargaComparacion prepararComparacion(const std::vector<Proceso>& procesos);
+// Igual, con los perfiles de ráfagas y los dispositivos de `cargaES`
+CargaComparacion prepararComparacion(const CargaES& cargaES);
+
+/**
+ * Corre `politica` sobre la carga compartida con su propio estado (colas y
+ * arreglos por id); nunca modifica `carga`.
+ * - Sin E/S, sin costo de cambio de contexto y con una CPU usa la función de
+ *   algoritmo.h de la política (ejecutarPolitica).
+ * - Si no, el motor de simularMulticore o simularConES.
+ * - Con config.soloAgregados las políticas del motor no arman `procesos`.
+ */
+ResultadoComparacion ejecutarComparacion(const CargaComparacion& carga,
+                                         Politica politica,
+                                         const ParametrosPolitica& parametros,
+                                         const ConfigSMP& config = ConfigSMP());
+
+// Todas las `politicas` sobre la misma carga, repartidas entre `hilos` hilos
+// (0 = todos los núcleos); el resultado va en el orden de `politicas`
+std::vector<ResultadoComparacion> compararPoliticas(const CargaComparacion& carga,
+                                                    const std::vector<Politica>& politicas,
+                                                    const ParametrosPolitica& parametros,
+                                                    const ConfigSMP& config = ConfigSMP(),
+                                                    int hilos = 0);
+
+#endif // COMPARACION_H
@@ -0,0 +1,99 @@
+#ifndef ENTRADASALIDA_H
+#define ENTRADASALIDA_H
+
+#include <QString>
+#include <QStringList>
+#include <vector>
+#include "proceso.h"
+#include "tipos.h"
+#include "observador.h"
+#include "politica.h"
+#include "smp.h"
+
+// Ráfaga de E/S: `duracion` ciclos en el dispositivo de índice `dispositivo`
+struct RafagaES {
+    int dispositivo;
+    int duracion;
+};
+
+// Alternancia CPU, E/S, CPU, ..., CPU de un proceso
+// (rafagasCPU.size() == rafagasES.size() + 1; sin E/S es una sola ráfaga)
+struct PerfilES {
+    std::vector<int> rafagasCPU;
+    std::vector<RafagaES> rafagasES;
+};
+
+// Orden de la cola de cada dispositivo
+enum class DisciplinaES {
+    FCFS,      // Orden de llegada al dispositivo
+    Prioridad  // Menor `priority` primero; a igual prioridad, FCFS
+};
+
+struct Dispositivo {
+    QString nombre;
+    DisciplinaES disciplina = DisciplinaES::FCFS;
+};
+
+// Métricas de un dispositivo
+struct EstadisticasDispositivo {
+    QString nombre;
+    long long ciclosOcupado = 0;
+    double utilizacion = 0.0;     // ciclosOcupado / makespan
+    long long atendidas = 0;      // Ráfagas de E/S servidas
+    double esperaPromedio = 0.0;  // Ciclos en la cola del dispositivo por ráfaga
+};
+
+struct ResultadoES {
+    ResultadoSMP cpu;                              // Procesos, bloques de CPU y métricas por núcleo
+    std::vector<BloqueGantt> bloquesES;            // BloqueGantt::cpu = índice del dispositivo
+    std::vector<EstadisticasDispositivo> dispositivos;
+    double utilizacionCPU = 0.0;                   // Ciclos de CPU ocupados / (CPUs · makespan)
+    double throughput = 0.0;                       // Procesos terminados / makespan
+};
+
+// Contenido de un archivo de procesos con ráfagas de E/S
+struct CargaES {
+    std::vector<Proceso> procesos;         // burstTime = suma de las ráfagas de CPU
+    std::vector<PerfilES> perfiles;        // Mismo orden que `procesos`
+    std::vector<Dispositivo> dispositivos; // En orden de primera aparición (FCFS)
+};
+
+/**
+ * Carga procesos con ráfagas de E/S desde <ruta>, con formato
+ * <PID>,<CPU>,<LLEGADA>,<PRIORIDAD>[,<DISPOSITIVO>:<E/S>,<CPU>]...
+ * Una línea de procesos.txt (sin E/S) es un proceso de una sola ráfaga.
+ * Si hay errores devuelve una carga vacía y, si `errores` no es nulo,
+ * agrega ahí un mensaje por cada línea inválida.
+ */
+CargaES cargarProcesosES(const QString &ruta, QStringList *errores = nullptr);
+
+/**
+ * Simulación A con alternancia de ráfagas CPU/E/S sobre el motor de
+ * simularMulticore: al terminar una ráfaga de CPU el proceso sale de la cola
+ * ready hacia la cola de su dispositivo y, al terminar la E/S, vuelve a la
+ * política como una llegada más. La política solo ve procesos en ráfaga de CPU.
+ * En los procesos devueltos waitingTime = turnaround - CPU - E/S (espera en
+ * la cola ready y en las de los dispositivos).
+ */
+ResultadoES simularConES(const std::vector<Proceso>& procesos,
+                         const std::vector<PerfilES>& perfiles,
+                         const std::vector<Dispositivo>& dispositivos,
+                         Politica politica,
+                         const ParametrosPolitica& parametros,
+                         const ConfigSMP& config,
+                         ObservadorSimulacion* obs = nullptr);
+// Igual, sobre una carga ya internada y validada (ver simularMulticore)
+ResultadoES simularConES(const CargaTrabajo& carga,
+                         const std::vector<PerfilES>& perfiles,
+                         const std::vector<Dispositivo>& dispositivos,
+                         Politica politica,
+                         const ParametrosPolitica& parametros,
+                         const ConfigSMP& config,
+                         ObservadorSimulacion* obs = nullptr);
+
+// Utilización de CPU y throughput de una ejecución sin E/S en una CPU
+void calcularUtilizacionYThroughput(const std::vector<Proceso>& ejecutados,
+                                    double *utilizacion,
+                                    double *throughput);
+
+#endif // ENTRADASALIDA_H
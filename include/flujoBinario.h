@@ -0,0 +1,162 @@
+#ifndef FLUJOBINARIO_H
+#define FLUJOBINARIO_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Serialización binaria compacta (puntos de control del motor, archivos):
+ * - enteros sin signo en varint (LEB128): 7 bits por byte, los chicos ocupan 1
+ * - enteros con signo en zigzag + varint (-1 -> 1, 1 -> 2, ...)
+ * - long double exacto como mantisa de 64 bits + exponente
+ * escritorBinario y lectorBinario exponen el mismo campo(x) / vector(v), así
+ * una sola lista de campos sirve para guardar y para restaurar.
+ */
+class escritorBinario {
+public:
+    void natural(uint64_t v) {
+        while (v >= 0x80) {
+            buffer.push_back(static_cast<uint8_t>(v) | 0x80);
+            v >>= 7;
+        }
+        buffer.push_back(static_cast<uint8_t>(v));
+    }
+
+    void entero(int64_t v) {
+        natural((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+    }
+
+    void real(long double v) {
+        int exponente = 0;
+        long double mantisa = std::frexp(v, &exponente); // |mantisa| en [0.5, 1) o 0
+        natural(mantisa < 0 ? 1 : 0);
+        natural(static_cast<uint64_t>(std::ldexp(std::fabs(mantisa), 64)));
+        entero(exponente);
+    }
+
+    // Largo + bytes crudos
+    void bytes(const std::vector<uint8_t>& datos) {
+        natural(datos.size());
+        buffer.insert(buffer.end(), datos.begin(), datos.end());
+    }
+
+    template <typename T>
+    void campo(const T& v) {
+        if constexpr (std::is_same<T, bool>::value) {
+            natural(v ? 1 : 0);
+        } else if constexpr (std::is_floating_point<T>::value) {
+            real(v);
+        } else if constexpr (std::is_signed<T>::value) {
+            entero(v);
+        } else {
+            natural(v);
+        }
+    }
+
+    template <typename T>
+    void vector(const std::vector<T>& v) {
+        natural(v.size());
+        for (const T& x : v) campo(x);
+    }
+
+    size_t size() const { return buffer.size(); }
+    const std::vector<uint8_t>& datos() const { return buffer; }
+    std::vector<uint8_t> liberar() { return std::move(buffer); }
+
+private:
+    std::vector<uint8_t> buffer;
+};
+
+/**
+ * Lee lo que escribió escritorBinario. Nunca lee fuera de rango: ante datos
+ * truncados, un varint demasiado largo o un valor que no entra en el tipo
+ * destino devuelve 0 y ok() pasa a false (lo que se lea después no vale).
+ */
+class lectorBinario {
+public:
+    lectorBinario(const uint8_t* datos, size_t largo) : datos(datos), largo(largo) {}
+    explicit lectorBinario(const std::vector<uint8_t>& datos) : lectorBinario(datos.data(), datos.size()) {}
+
+    uint64_t natural() {
+        uint64_t v = 0;
+        for (int desplazamiento = 0; desplazamiento < 64 && valido; desplazamiento += 7) {
+            if (pos >= largo) break;
+            const uint8_t b = datos[pos++];
+            v |= static_cast<uint64_t>(b & 0x7F) << desplazamiento;
+            if (!(b & 0x80)) return v;
+        }
+        valido = false;
+        return 0;
+    }
+
+    int64_t entero() {
+        const uint64_t z = natural();
+        return static_cast<int64_t>(z >> 1) ^ -static_cast<int64_t>(z & 1);
+    }
+
+    long double real() {
+        const bool negativo = natural() != 0;
+        const long double mantisa = std::ldexp(static_cast<long double>(natural()), -64);
+        const long double v = std::ldexp(mantisa, static_cast<int>(entero()));
+        return valido ? (negativo ? -v : v) : 0.0L;
+    }
+
+    void bytes(std::vector<uint8_t>& salida) {
+        const uint64_t n = natural();
+        if (n > restantes()) {
+            valido = false;
+            salida.clear();
+            return;
+        }
+        salida.assign(datos + pos, datos + pos + n);
+        pos += n;
+    }
+
+    template <typename T>
+    void campo(T& v) {
+        if constexpr (std::is_same<T, bool>::value) {
+            const uint64_t x = natural();
+            if (x > 1) valido = false;
+            v = x == 1;
+        } else if constexpr (std::is_floating_point<T>::value) {
+            v = static_cast<T>(real());
+        } else if constexpr (std::is_signed<T>::value) {
+            const int64_t x = entero();
+            v = static_cast<T>(x);
+            if (static_cast<int64_t>(v) != x) valido = false;
+        } else {
+            const uint64_t x = natural();
+            v = static_cast<T>(x);
+            if (static_cast<uint64_t>(v) != x) valido = false;
+        }
+    }
+
+    // Cada elemento ocupa al menos un byte: un largo imposible no reserva memoria
+    template <typename T>
+    void vector(std::vector<T>& v) {
+        const uint64_t n = natural();
+        if (n > restantes()) {
+            valido = false;
+            v.clear();
+            return;
+        }
+        v.resize(n);
+        for (T& x : v) campo(x);
+    }
+
+    bool ok() const { return valido; }
+    bool alFinal() const { return pos == largo; }
+    size_t restantes() const { return largo - pos; }
+
+private:
+    const uint8_t* datos;
+    size_t largo;
+    size_t pos = 0;
+    bool valido = true;
+};
+
+#endif // FLUJOBINARIO_H
@@ -11,14 +11,18 @@
 #include <QString>
 #include <QColor>
 #include <QLabel>
+#include <QStringList>
 #include <vector>
 #include "tipos.h" // Para que BloqueGantt esté disponible
+#include "observador.h"
 
 // Ajuste de tamaño: 40×40 píxeles por cada ciclo (ancho × alto)
 static const int ANCHO_BASE_UNIDAD = 40;  // ancho en px por cada ciclo
 static const int ALTO_UNIDAD       = 40;  // alto en px para cada bloque
 
-class GanttWindow : public QWidget {
+// La ventana de Gantt es el observador que usa la GUI para seguir las
+// simulaciones del núcleo; el delay de animación vive aquí, no en simcore.
+class GanttWindow : public QWidget, public ObservadorSimulacion {
     Q_OBJECT
 
 public:
@@ -31,6 +35,16 @@ public:
 
     void limpiarDiagrama();
 
+    /// Simulación multicore: un carril por núcleo (con 1 CPU se usa el carril único).
+    /// Con ráfagas de E/S se agrega debajo un carril por dispositivo.
+    void configurarCPUs(int numCPUs, const QStringList &dispositivos = QStringList());
+
+    /// Pinta el ciclo `ciclo` de `pid` en el carril del núcleo `cpu`,
+    /// rellenando con ciclos ociosos los huecos del carril. Sin carriles
+    /// (un solo CPU) se agrega al diagrama de un solo carril.
+    void agregarBloqueEnCPU(int cpu, const QString &pid, int ciclo,
+                            TipoBloque tipo = TipoBloque::Proceso);
+
     /// Pinta un bloque de sincronización (ACCESS vs WAIT) en el diagrama de Gantt.
     // Para la simulación B: ahora incluimos recurso y tipo de acción para mostrarlo
     void agregarBloqueSync(const QString &pid,
@@ -39,6 +53,16 @@ public:
                            int ciclo,
                            bool accessed);
 
+    // ----- ObservadorSimulacion -----
+    void cicloEjecutado(const QString &pid, int ciclo) override;
+    void tramoEjecutadoEnCPU(int cpu, const QString &pid, int inicio, int duracion) override;
+    void cambioDeContexto(int cpu, const QString &pid, int inicio, int duracion) override;
+    void tramoEntradaSalida(int dispositivo, const QString &pid, int inicio, int duracion) override;
+    void bloqueSync(const QString &pid,
+                    const QString &recurso,
+                    const QString &accion,
+                    int ciclo,
+                    bool accessed) override;
 
 private:
     // Etiqueta que mostrará “Ciclo: X”
@@ -62,11 +86,23 @@ private:
     // ScrollArea que envuelve a contenedorBloques y permite el scroll horizontal
     QScrollArea *scrollArea;
 
+    // Carriles por núcleo (vacío = modo de un solo CPU) y ciclos ya pintados en cada uno
+    std::vector<QHBoxLayout*> carriles;
+    std::vector<int> ciclosCarril;
+    int carrilesCPU = 0;  // Los carriles siguientes son de dispositivos de E/S
+
     // Temporizador que dispara cada “tick” para animar el diagrama (opcional en esta versión)
     QTimer *timer;
 
     // Retorna (o asigna si no existía) un color único para el PID dado.
     QColor colorParaPID(const QString &pid);
+
+    // Crea el QLabel de 40×40 de un ciclo de proceso (Simulación A).
+    QLabel *crearBloqueProceso(QWidget *padre, const QString &pid, int ciclo);
+
+    // Crea el QLabel de un ciclo perdido cargando el contexto de `pid`:
+    // gris oscuro con borde del color del proceso entrante.
+    QLabel *crearBloqueCambio(QWidget *padre, const QString &pid, int ciclo);
 };
 
 #endif // GANTTWINDOW_H
\ No newline at end of file
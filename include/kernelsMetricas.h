@@ -0,0 +1,77 @@
+#ifndef KERNELSMETRICAS_H
+#define KERNELSMETRICAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "proceso.h"
+
+/**
+ * Columnas (struct-of-arrays) de una ejecución: un arreglo plano por campo,
+ * sin QString, para que las pasadas de métricas lean memoria contigua y
+ * vectoricen. `ciclosES` (vacío = sin E/S) son ciclos fuera de la CPU que
+ * no cuentan como espera.
+ */
+struct ColumnasEjecucion {
+    std::vector<int> llegada;
+    std::vector<int> rafaga;
+    std::vector<int> inicio;
+    std::vector<int> fin;
+    std::vector<int> ciclosES;
+
+    size_t size() const { return llegada.size(); }
+};
+
+// Columnas de un resultado de cualquier política (ciclosES se deduce de
+// waitingTime, así la E/S ya descontada se conserva)
+ColumnasEjecucion columnasDe(const std::vector<Proceso>& ejecucion);
+
+// Reducción de una columna en la misma pasada que la calcula
+struct ReduccionColumna {
+    long long cantidad = 0;
+    long long suma = 0;          // Exacta (enteros de 64 bits)
+    double sumaCuadrados = 0.0;
+    int minimo = 0;              // 0 si la columna está vacía
+    int maximo = 0;
+
+    double promedio() const { return cantidad > 0 ? static_cast<double>(suma) / cantidad : 0.0; }
+    // Varianza poblacional (Σx²/n − media²), nunca negativa
+    double varianza() const;
+};
+
+struct ReduccionesMetricas {
+    ReduccionColumna turnaround;  // fin − llegada
+    ReduccionColumna espera;      // turnaround − ráfaga − ciclosES
+    ReduccionColumna respuesta;   // inicio − llegada
+};
+
+/**
+ * Kernel de métricas por proceso: turnaround, espera y respuesta salen
+ * juntos de una sola lectura de las columnas, con suma, suma de cuadrados,
+ * mínimo y máximo de cada una. Usa AVX2 (8 procesos por instrucción) si la
+ * CPU lo tiene y código escalar si no; `permitirSimd = false` fuerza el
+ * escalar. Ambos caminos dan las mismas columnas, sumas, mínimos y
+ * máximos, y acumulan la suma de cuadrados en el mismo orden por carril.
+ * - `ciclosES` e `inicio` pueden ser nulos (sin E/S / sin respuesta: su
+ *   reducción queda en 0).
+ * - Las columnas de salida son opcionales: con las tres nulas solo se
+ *   reduce, una pasada limitada por el ancho de banda de memoria.
+ */
+ReduccionesMetricas calcularMetricasColumnas(const int* llegada,
+                                             const int* rafaga,
+                                             const int* inicio,
+                                             const int* fin,
+                                             const int* ciclosES,
+                                             size_t n,
+                                             int* turnaround = nullptr,
+                                             int* espera = nullptr,
+                                             int* respuesta = nullptr,
+                                             bool permitirSimd = true);
+
+ReduccionesMetricas calcularMetricasColumnas(const ColumnasEjecucion& columnas,
+                                             bool permitirSimd = true);
+
+// true si calcularMetricasColumnas usa el camino AVX2 en esta CPU
+bool kernelsSimdDisponibles();
+
+#endif // KERNELSMETRICAS_H
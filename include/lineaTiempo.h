@@ -0,0 +1,85 @@
+#ifndef LINEATIEMPO_H
+#define LINEATIEMPO_H
+
+#include <cstdint>
+#include <vector>
+#include "tipos.h"
+
+struct CargaTrabajo;
+
+// Qué ocupó la CPU durante un tramo de la línea de tiempo
+enum class TipoTramo : uint8_t {
+    Ejecucion,      // El proceso `id` avanzó
+    Ocioso,         // Nadie listo (id = SIN_PROCESO)
+    CambioContexto  // Se cargaba el contexto de `id` sin avanzarlo
+};
+
+// Tramo run-length: `duracion` ciclos de `tipo` desde `inicio`
+struct Tramo {
+    static constexpr uint32_t SIN_PROCESO = UINT32_MAX;
+
+    uint32_t id;     // Id denso de CargaTrabajo (el PID está en carga.pids[id])
+    int inicio;
+    int duracion;
+    TipoTramo tipo;
+
+    int fin() const { return inicio + duracion; }
+    bool operator==(const Tramo& otro) const {
+        return id == otro.id && inicio == otro.inicio && duracion == otro.duracion && tipo == otro.tipo;
+    }
+    bool operator!=(const Tramo& otro) const { return !(*this == otro); }
+};
+
+/**
+ * Línea de tiempo de una CPU: tramos contiguos desde el ciclo 0, sin huecos
+ * (los ociosos son tramos explícitos). Es lo que emite cada política para
+ * graficar, comparar, guardar o consultar una corrida sin repetirla.
+ */
+struct LineaTiempo {
+    std::vector<Tramo> tramos;
+
+    // Agregan un tramo que empieza en `inicio` >= fin(); el hueco que quede
+    // antes se completa con un tramo ocioso
+    void ejecutar(uint32_t id, int inicio, int duracion) { agregar(id, inicio, duracion, TipoTramo::Ejecucion); }
+    void cambioContexto(uint32_t id, int inicio, int duracion) {
+        agregar(id, inicio, duracion, TipoTramo::CambioContexto);
+    }
+
+    int fin() const { return tramos.empty() ? 0 : tramos.back().fin(); }
+    size_t size() const { return tramos.size(); }
+    bool operator==(const LineaTiempo& otra) const { return tramos == otra.tramos; }
+    bool operator!=(const LineaTiempo& otra) const { return tramos != otra.tramos; }
+
+    // Índice del tramo que cubre `ciclo` (búsqueda binaria); -1 si está fuera
+    int tramoEn(int ciclo) const;
+    // Pares consecutivos de tramos de ejecución (sin contar los ociosos) de
+    // procesos distintos: los cambios de contexto de contarCambiosContexto
+    int cambiosDeProceso() const;
+
+private:
+    void agregar(uint32_t id, int inicio, int duracion, TipoTramo tipo);
+};
+
+/**
+ * Forma compacta para corridas largas: como los tramos son contiguos, el
+ * inicio no se guarda; cada tramo es un varint con (duración << 2 | tipo)
+ * y, si no es ocioso, el id en zigzag como diferencia con el id del último
+ * tramo no ocioso (flujoBinario.h). Un tramo típico ocupa 2-3 bytes.
+ */
+std::vector<uint8_t> codificarLineaTiempo(const LineaTiempo& linea);
+// false (y `linea` vacía) si los datos están truncados o dañados, o si algún
+// id no es menor que `numProcesos`
+bool decodificarLineaTiempo(const std::vector<uint8_t>& datos, size_t numProcesos, LineaTiempo* linea);
+
+// Bloques de Gantt de `linea` en el núcleo `cpu` (sin los ociosos); se
+// agregan al final de `bloques`
+void agregarBloques(const CargaTrabajo& carga, const LineaTiempo& linea,
+                    std::vector<BloqueGantt>& bloques, int cpu = 0);
+
+// Una línea de tiempo por núcleo a partir de los bloques de simularMulticore
+// o simularConES; los bloques de un PID que no está en `carga` se ignoran
+std::vector<LineaTiempo> lineasDesdeBloques(const CargaTrabajo& carga,
+                                            const std::vector<BloqueGantt>& bloques,
+                                            int numCPUs);
+
+#endif // LINEATIEMPO_H
@@ -0,0 +1,105 @@
+#ifndef METRICAS_H
+#define METRICAS_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "proceso.h"
+#include "carga.h"
+#include "flujoBinario.h"
+#include "kernelsMetricas.h"
+
+/**
+ * Histograma de memoria fija al estilo HDR: los valores < 256 tienen una
+ * cubeta propia (exactos) y cada potencia de 2 superior se divide en 128
+ * sub-cubetas, así el error relativo de un percentil es < 1 % para cualquier
+ * valor no negativo de 64 bits. registrar() es O(1); percentil() recorre las cubetas.
+ */
+class histogramaLatencia {
+public:
+    static constexpr int BITS_SUBCUBETA = 7;
+    static constexpr int SUBCUBETAS = 1 << BITS_SUBCUBETA;        // 128
+    static constexpr int EXACTOS = 2 * SUBCUBETAS;                // 0..255 sin error
+    static constexpr int NUM_CUBETAS = EXACTOS + (62 - BITS_SUBCUBETA) * SUBCUBETAS;
+
+    histogramaLatencia() { cuentas.fill(0); }
+
+    // Valores negativos se registran como 0
+    void registrar(int64_t valor);
+
+    // Menor valor v tal que al menos p % de los registros es <= v (con la
+    // precisión de su cubeta, nunca mayor que maximo()); 0 si está vacío
+    int64_t percentil(double p) const;
+
+    uint64_t cantidad() const { return total; }
+    int64_t maximo() const { return total > 0 ? mayor : 0; }
+    double promedio() const { return total > 0 ? static_cast<double>(suma) / total : 0.0; }
+
+    // Punto de control: solo las cubetas no vacías, como (salto de índice, cuenta)
+    void guardar(escritorBinario& salida) const;
+    bool restaurar(lectorBinario& entrada);
+
+private:
+    static int indice(int64_t valor);
+    static int64_t limiteSuperior(int indice);
+
+    std::array<uint64_t, NUM_CUBETAS> cuentas;
+    uint64_t total = 0;
+    long double suma = 0.0L;
+    int64_t mayor = 0;
+};
+
+// Resumen de una distribución (ciclos)
+struct ResumenDistribucion {
+    double promedio = 0.0;
+    int64_t p50 = 0;
+    int64_t p90 = 0;
+    int64_t p99 = 0;
+    int64_t maximo = 0;
+};
+
+// Métricas agregadas de una ejecución, sin filas por proceso
+struct MetricasEjecucion {
+    long long procesos = 0;
+    ResumenDistribucion espera;      // waitingTime
+    ResumenDistribucion turnaround;  // completionTime - arrivalTime
+    ResumenDistribucion respuesta;   // startTime - arrivalTime
+    int64_t makespan = 0;            // Fin del último proceso
+    double throughput = 0.0;         // procesos / makespan
+    double indiceJain = 0.0;         // (Σx)² / (n·Σx²) con x = burst / turnaround; 1 = justo
+};
+
+/**
+ * Acumula las métricas de una ejecución en una sola pasada y con memoria fija
+ * (tres histogramas), sin guardar los procesos: sirve para 10M+ procesos.
+ */
+class AcumuladorMetricas {
+public:
+    void agregar(const Proceso& p);
+    // Variante para motores que no materializan Proceso; `ciclosES` son
+    // ciclos fuera de la CPU que no cuentan como espera
+    void agregar(int64_t llegada, int64_t inicio, int64_t fin, int64_t rafaga, int64_t ciclosES = 0);
+    MetricasEjecucion resultado() const;
+
+    // Punto de control del motor (ver puntoControl.h)
+    void guardar(escritorBinario& salida) const;
+    bool restaurar(lectorBinario& entrada);
+
+private:
+    histogramaLatencia espera, turnaround, respuesta;
+    long long procesos = 0;
+    int64_t makespan = 0;
+    long double sumaCuota = 0.0L, sumaCuota2 = 0.0L;
+};
+
+// Una pasada sobre el resultado de cualquier política
+MetricasEjecucion calcularMetricas(const std::vector<Proceso>& ejecucion);
+// Igual sobre un resultado compacto (columnas por id), sin expandirlo; el
+// promedio y el máximo salen de `resultado.reducciones`
+MetricasEjecucion calcularMetricas(const CargaTrabajo& carga, const ResultadoCompacto& resultado);
+
+// Reemplaza promedio y máximo de espera, turnaround y respuesta por los del
+// kernel de columnas (sumas enteras exactas); los percentiles no cambian
+void aplicarReducciones(MetricasEjecucion& metricas, const ReduccionesMetricas& reducciones);
+
+#endif // METRICAS_H
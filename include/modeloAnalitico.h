@@ -0,0 +1,60 @@
+#ifndef MODELOANALITICO_H
+#define MODELOANALITICO_H
+
+#include <QString>
+#include <vector>
+#include "carga.h"
+#include "politica.h"
+
+// Llegadas y servicio de una carga, ajustados para los modelos M/G/1
+struct AjusteCarga {
+    long long procesos = 0;
+    double tasaLlegada = 0.0;        // λ: (n − 1) / (última llegada − primera)
+    double cvLlegadas = 0.0;         // Coeficiente de variación de las interllegadas (1 = Poisson)
+    double servicioMedio = 0.0;      // E[S], con S = burstTime
+    double servicioCuadrado = 0.0;   // E[S²]
+    double cvServicio = 0.0;
+    double utilizacion = 0.0;        // ρ = λ·E[S]
+
+    // Hace falta al menos dos llegadas en instantes distintos
+    bool valido() const { return procesos >= 2 && tasaLlegada > 0.0; }
+};
+
+// Una pasada por las columnas de `carga`
+AjusteCarga ajustarCarga(const CargaTrabajo& carga);
+
+// Espera promedio que predice la teoría de colas para una política
+struct EstimacionAnalitica {
+    Politica politica = Politica::FIFO;
+    bool aplicable = false;   // La política tiene modelo y el ajuste es válido
+    bool estable = false;     // ρ < 1 (y cada clase con carga acumulada < 1); si no, la espera no tiene cota
+    double espera = 0.0;      // E[W] = E[turnaround] − E[S], como waitingTime
+    double turnaround = 0.0;
+    QString modelo;           // Fórmula usada, p. ej. "M/G/1 FCFS (Pollaczek-Khinchine)"
+};
+
+/**
+ * Estimación M/G/1 (una CPU, llegadas de Poisson con tasa λ, servicio con
+ * la distribución empírica de las ráfagas), en milisegundos aun con
+ * millones de procesos:
+ * - FIFO: Pollaczek-Khinchine, E[W] = λ·E[S²] / (2(1 − ρ)).
+ * - SJF y Priority: prioridades no expropiativas de Cobham, una clase por
+ *   ráfaga (SJF) o por prioridad, menor = antes.
+ * - Preemptive Priority: prioridades expropiativas con reanudación, sin aging.
+ * - Round Robin (también el adaptativo): processor sharing, su límite con
+ *   quantum → 0: E[W] = ρ·E[S] / (1 − ρ).
+ * El resto de las políticas (y un ajuste inválido) quedan con `aplicable =
+ * false`. No modela el costo de cambio de contexto ni la E/S; con
+ * interllegadas lejos de cvLlegadas = 1 es solo un orden de magnitud.
+ */
+EstimacionAnalitica estimarEspera(const CargaTrabajo& carga, const AjusteCarga& ajuste, Politica politica);
+
+// Una estimación por política, en el orden de `politicas`, con un solo ajuste
+std::vector<EstimacionAnalitica> estimarPoliticas(const CargaTrabajo& carga,
+                                                  const std::vector<Politica>& politicas);
+
+// true si la simulación se aparta de la teoría más que `tolerancia` (relativa
+// a la estimación, con un piso de un ciclo); false si no hay estimación finita
+bool discrepaDelModelo(const EstimacionAnalitica& estimacion, double esperaSimulada, double tolerancia = 0.25);
+
+#endif // MODELOANALITICO_H
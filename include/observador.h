@@ -0,0 +1,51 @@
+#ifndef OBSERVADOR_H
+#define OBSERVADOR_H
+
+#include <QString>
+
+/**
+ * Interfaz opcional para seguir el progreso de una simulación.
+ * El núcleo (simcore) no conoce ninguna ventana: la GUI implementa esta
+ * interfaz (ver GanttWindow) y los modos batch simplemente pasan nullptr.
+ * Todos los métodos tienen implementación vacía por defecto, así cada
+ * observador sobrescribe solo lo que le interesa.
+ */
+class ObservadorSimulacion {
+public:
+    virtual ~ObservadorSimulacion() = default;
+
+    // Simulación A: el proceso `pid` ocupó la CPU durante el ciclo `ciclo`
+    virtual void cicloEjecutado(const QString &pid, int ciclo) {}
+
+    // Simulación A: `pid` ocupó la CPU en [inicio, inicio + duracion).
+    // Los algoritmos event-driven reportan tramos completos; por defecto se
+    // expanden ciclo a ciclo para los observadores que animan por ciclo.
+    virtual void tramoEjecutado(const QString &pid, int inicio, int duracion) {
+        for (int ciclo = inicio; ciclo < inicio + duracion; ++ciclo) {
+            cicloEjecutado(pid, ciclo);
+        }
+    }
+
+    // Simulación A multicore: `pid` ocupó el núcleo `cpu` en
+    // [inicio, inicio + duracion). Por defecto se trata como un único carril.
+    virtual void tramoEjecutadoEnCPU(int cpu, const QString &pid, int inicio, int duracion) {
+        tramoEjecutado(pid, inicio, duracion);
+    }
+
+    // Simulación A con costo de cambio de contexto: el núcleo `cpu` cargó el
+    // contexto de `pid` en [inicio, inicio + duracion) sin ejecutarlo
+    virtual void cambioDeContexto(int cpu, const QString &pid, int inicio, int duracion) {}
+
+    // Simulación A con E/S: `pid` ocupó el dispositivo `dispositivo` en
+    // [inicio, inicio + duracion). Se reporta al comenzar la ráfaga de E/S.
+    virtual void tramoEntradaSalida(int dispositivo, const QString &pid, int inicio, int duracion) {}
+
+    // Simulación B: bloque ACCESS (accessed = true) o WAIT de `pid` sobre `recurso`
+    virtual void bloqueSync(const QString &pid,
+                            const QString &recurso,
+                            const QString &accion, // "READ" o "WRITE"
+                            int ciclo,
+                            bool accessed) {}
+};
+
+#endif // OBSERVADOR_H
@@ -0,0 +1,77 @@
+#ifndef PERCENTILDINAMICO_H
+#define PERCENTILDINAMICO_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include "priorityQueue.h"
+
+/**
+ * Percentil de las claves de un conjunto dinámico de ids (p. ej. el tiempo
+ * restante de los procesos en la cola ready), mantenido con dos heaps indexados:
+ * - `bajos`: max-heap con las k = ceil(percentil·n / 100) claves menores (al menos 1)
+ * - `altos`: min-heap con el resto
+ * El percentil es el tope de `bajos`, en O(1); insertar y quitar cuestan O(log n).
+ * Los ids son los ids densos de CargaTrabajo.
+ */
+class percentilDinamico {
+public:
+    explicit percentilDinamico(int percentil = 50, size_t capacidadIds = 0)
+        : bajos(capacidadIds), altos(capacidadIds), percentil(percentil) {
+        if (percentil < 1 || percentil > 100) {
+            throw std::out_of_range("percentilDinamico: percentil fuera de [1, 100]");
+        }
+    }
+
+    void insertar(uint32_t id, int64_t clave) {
+        if (bajos.isEmpty() || clave <= bajos.top().clave) {
+            bajos.insertNewValue(id, clave);
+        } else {
+            altos.insertNewValue(id, clave);
+        }
+        rebalancear();
+    }
+
+    // Quita un id presente; false si no estaba
+    bool quitar(uint32_t id) {
+        if (!bajos.deleteValue(id) && !altos.deleteValue(id)) return false;
+        rebalancear();
+        return true;
+    }
+
+    // Clave en el percentil pedido (la k-ésima menor)
+    int64_t valor() const {
+        if (bajos.isEmpty()) {
+            throw std::runtime_error("percentilDinamico: conjunto vacío");
+        }
+        return bajos.top().clave;
+    }
+
+    bool contains(uint32_t id) const { return bajos.contains(id) || altos.contains(id); }
+    size_t size() const { return static_cast<size_t>(bajos.size() + altos.size()); }
+    bool isEmpty() const { return bajos.isEmpty() && altos.isEmpty(); }
+
+private:
+    // Deja exactamente k claves en `bajos` moviendo topes entre los heaps
+    void rebalancear() {
+        const size_t n = size();
+        size_t k = (static_cast<size_t>(percentil) * n + 99) / 100;
+        if (k == 0 && n > 0) k = 1;
+        while (static_cast<size_t>(bajos.size()) > k) {
+            auto e = bajos.pop();
+            altos.insertNewValue(e.id, e.clave);
+        }
+        while (static_cast<size_t>(bajos.size()) < k && !altos.isEmpty()) {
+            auto e = altos.pop();
+            bajos.insertNewValue(e.id, e.clave);
+        }
+    }
+
+    priorityQueue<int64_t, std::greater<int64_t>> bajos;
+    priorityQueue<int64_t> altos;
+    int percentil;
+};
+
+#endif // PERCENTILDINAMICO_H
@@ -0,0 +1,83 @@
+#ifndef PLANIFICADOR_H
+#define PLANIFICADOR_H
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include "carga.h"
+#include "politica.h"
+#include "smp.h"
+
+// Qué ocurrió en un evento de planificación
+enum class TipoEvento : uint8_t {
+    Llegada,         // `id` entró a la cola de `cpu`
+    Despacho,        // `cpu` tomó a `id` (de su cola o robado de otra)
+    Ejecucion,       // `id` avanzó `duracion` ciclos en `cpu` desde `tiempo`
+    CambioContexto,  // `cpu` cargó el contexto de `id` durante `duracion` ciclos
+    Expropiacion,    // `id` volvió a la cola de `cpu` por un proceso más urgente
+    Terminacion      // `id` terminó en `cpu` en `tiempo`
+};
+
+struct EventoSimulacion {
+    TipoEvento tipo;
+    uint32_t id;      // Id denso de CargaTrabajo (el PID está en carga.pids[id])
+    int cpu;
+    int tiempo;
+    int duracion;     // Solo en Ejecucion y CambioContexto; 0 en el resto
+};
+
+/**
+ * Planificador incremental (pull) sobre el motor de simularMulticore: cada
+ * siguiente() avanza la simulación lo justo para entregar el próximo evento,
+ * así el consumidor (el Gantt, un archivo, un AcumuladorMetricas) procesa la
+ * corrida a medida que ocurre y puede dejarla cuando quiera, por ejemplo al
+ * pasar un horizonte de tiempo:
+ *
+ *     Planificador sim = crearPlanificador(carga, Politica::RoundRobin, parametros, config);
+ *     while (auto ev = sim.siguiente()) {
+ *         if (ev->tiempo >= horizonte) break;
+ *         ...
+ *     }
+ *
+ * No guarda bloques ni procesos: la memoria es la del estado del motor
+ * (colas y arreglos por id) más los eventos de un instante. Los tramos
+ * (Ejecucion, CambioContexto) se entregan al cerrarse, con su inicio en
+ * `tiempo`; son los mismos bloques que daría simularMulticore. `carga` debe
+ * vivir mientras se use el planificador.
+ */
+class Planificador {
+public:
+    Planificador(Planificador&& otro) noexcept;
+    Planificador& operator=(Planificador&& otro) noexcept;
+    ~Planificador();
+
+    // Próximo evento; vacío al terminar (o si el motor rechazó la entrada)
+    std::optional<EventoSimulacion> siguiente();
+
+    bool valido() const;     // false si la carga o la configuración son inválidas
+    bool terminado() const;  // Ya se entregaron todos los eventos
+    int tiempo() const;      // Ciclo hasta el que avanzó el motor
+
+    // Con la corrida terminada: métricas, makespan, CPUs y contadores (sin
+    // procesos ni bloques). Vacío mientras queden eventos
+    ResultadoSMP resultado();
+
+private:
+    struct Estado;
+    explicit Planificador(std::unique_ptr<Estado> estado);
+    friend Planificador crearPlanificador(const CargaTrabajo& carga,
+                                          Politica politica,
+                                          const ParametrosPolitica& parametros,
+                                          const ConfigSMP& config);
+
+    std::unique_ptr<Estado> estado;
+};
+
+// Políticas y validaciones de simularMulticore;
+// `config.soloAgregados` se ignora: el planificador nunca acumula bloques
+Planificador crearPlanificador(const CargaTrabajo& carga,
+                               Politica politica,
+                               const ParametrosPolitica& parametros,
+                               const ConfigSMP& config);
+
+#endif // PLANIFICADOR_H
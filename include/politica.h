@@ -0,0 +1,53 @@
+#ifndef POLITICA_H
+#define POLITICA_H
+
+#include <QString>
+#include <vector>
+#include <cstdint>
+
+// Políticas de planificación de Simulación A, para los motores que eligen la
+// política en tiempo de ejecución (multicore, comparación, etc.)
+enum class Politica {
+    FIFO,
+    SJF,
+    SRT,
+    RoundRobin,
+    Priority,
+    PreemptivePriority,
+    MLFQ,
+    CFS,
+    Lottery,
+    Stride,
+    RoundRobinAdaptativo
+};
+
+// Parámetros de todas las políticas; cada una lee solo los suyos
+struct ParametrosPolitica {
+    int quantum = 4;                            // Round Robin, Lottery y Stride
+    int envejecimiento = 0;                     // Preemptive Priority (0 = sin aging)
+    std::vector<int> quantumPorNivel{2, 4, 8};  // MLFQ
+    int periodoBoost = 0;                       // MLFQ (0 = sin boost)
+    int latenciaObjetivo = 6;                   // CFS
+    int granularidadMinima = 1;                 // CFS
+    uint64_t semillaLoteria = 1;                // Lottery
+    int percentilQuantum = 50;                  // Round Robin adaptativo (50 = mediana)
+};
+
+inline QString nombrePolitica(Politica politica) {
+    switch (politica) {
+    case Politica::FIFO:               return "First In First Out (FIFO)";
+    case Politica::SJF:                return "Shortest Job First (SJF)";
+    case Politica::SRT:                return "Shortest Remaining Time (SRT)";
+    case Politica::RoundRobin:         return "Round Robin";
+    case Politica::Priority:           return "Priority Scheduling";
+    case Politica::PreemptivePriority: return "Preemptive Priority (Aging)";
+    case Politica::MLFQ:               return "Multilevel Feedback Queue (MLFQ)";
+    case Politica::CFS:                return "Completely Fair Scheduler (CFS)";
+    case Politica::Lottery:            return "Lottery Scheduling";
+    case Politica::Stride:             return "Stride Scheduling";
+    case Politica::RoundRobinAdaptativo: return "Round Robin Adaptativo";
+    }
+    return QString();
+}
+
+#endif // POLITICA_H
@@ -0,0 +1,52 @@
+#ifndef POOLHILOS_H
+#define POOLHILOS_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Ejecuta tarea(0), ..., tarea(numTareas - 1) sobre `hilos` std::thread
+ * (0 = std::thread::hardware_concurrency()). Cada hilo toma el siguiente
+ * índice libre de un contador atómico, así las tareas largas no dejan hilos
+ * ociosos. Bloquea hasta que terminan todas; si alguna lanza, se relanza la
+ * primera excepción después de unir los hilos.
+ * Las tareas deben escribir solo en su propia posición de salida.
+ */
+inline void ejecutarEnParalelo(size_t numTareas, int hilos,
+                               const std::function<void(size_t)> &tarea) {
+    if (numTareas == 0) return;
+    size_t numHilos = hilos > 0 ? static_cast<size_t>(hilos)
+                                : std::max(1u, std::thread::hardware_concurrency());
+    numHilos = std::min(numHilos, numTareas);
+
+    std::atomic<size_t> siguiente(0);
+    std::exception_ptr error;
+    std::mutex mutexError;
+
+    auto trabajador = [&]() {
+        size_t k;
+        while ((k = siguiente.fetch_add(1)) < numTareas) {
+            try {
+                tarea(k);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutexError);
+                if (!error) error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(numHilos - 1);
+    for (size_t h = 1; h < numHilos; ++h) pool.emplace_back(trabajador);
+    trabajador(); // El hilo llamador también trabaja
+    for (std::thread &t : pool) t.join();
+
+    if (error) std::rethrow_exception(error);
+}
+
+#endif // POOLHILOS_H
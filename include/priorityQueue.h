@@ -2,42 +2,185 @@
 #define PRIORITYQUEUE_H
 
 #include <vector>
-#include <string>
+#include <cstdint>
+#include <functional>
+#include <iostream>
 #include <stdexcept>
-#include "proceso.h"
-
-using namespace std;
 
+/**
+ * Cola de prioridad indexada (heap d-ario) sobre entradas compactas (clave, id).
+ * - `Clave`: tipo de la clave (restante, prioridad, deadline, vruntime...).
+ * - `Comparador`: comp(a, b) == true si `a` debe salir antes que `b`
+ *   (std::less -> min-heap). A igual clave sale primero el id menor.
+ * - `Aridad`: hijos por nodo (2 = binario; 4 u 8 mejoran la localidad de caché).
+ * Los ids son los ids densos de CargaTrabajo: un índice id -> posición en el
+ * heap permite deleteValue / decreaseKey / increaseKey en O(log n).
+ */
+template <typename Clave = int,
+          typename Comparador = std::less<Clave>,
+          unsigned Aridad = 2>
 class priorityQueue {
+    static_assert(Aridad >= 2, "priorityQueue: la aridad debe ser al menos 2");
+
 public:
-    // Constructor y destructor
-    priorityQueue();
-    ~priorityQueue();
+    struct Entrada {
+        Clave    clave;
+        uint32_t id;
+    };
+
+    // Constructor: `capacidadIds` reserva el índice de posiciones (opcional)
+    explicit priorityQueue(size_t capacidadIds = 0, const Comparador &comparador = Comparador())
+        : posicion(capacidadIds, NO_ESTA), comp(comparador) {}
+
     // Métodos principales
-    void insertNewValue(const Proceso& proceso); //Ayuda a insertar un nuevo proceso
-    Proceso pop(); //Elimina el proceso con mayor prioridad
-    Proceso top(); //Ayuda a encontrar el proceso con más prioridad
-    bool deleteValue(const QString& pid); //Nos ayuda a eliminar un proceso en base a su ID
-    bool isEmpty(); //Verifica si la queue está vacía
-    int size(); //Obtienen el tamañao
-    void printQueue();//Será de ayuda para debuguear el proceso
-    void clear();//Limpia la queue
+    void insertNewValue(uint32_t id, const Clave &clave) { //Inserta un id con su clave
+        if (contains(id)) {
+            throw std::runtime_error("priorityQueue: id ya presente en la cola");
+        }
+        if (id >= posicion.size()) {
+            posicion.resize(static_cast<size_t>(id) + 1, NO_ESTA);
+        }
+        heap.push_back({clave, id});
+        posicion[id] = static_cast<int>(heap.size() - 1);
+        goUpFrom(static_cast<int>(heap.size() - 1));
+    }
+
+    Entrada pop() { //Elimina y retorna la entrada con más prioridad
+        Entrada item = top();
+        removeAt(0);
+        return item;
+    }
+
+    const Entrada &top() const { //Entrada con más prioridad (sin eliminarla)
+        if (heap.empty()) {
+            throw std::runtime_error("Priority queue está vacía");
+        }
+        return heap[0];
+    }
+
+    bool deleteValue(uint32_t id) { //Elimina un id en O(log n) usando el índice
+        if (!contains(id)) return false;
+        removeAt(posicion[id]);
+        return true;
+    }
+
+    // Cambian la clave de un id presente; false si el id no está en la cola.
+    // decreaseKey acerca el id al tope (según Comparador), increaseKey lo aleja,
+    // pero ambos reubican en cualquier dirección por robustez.
+    bool decreaseKey(uint32_t id, const Clave &nueva) { return updateKey(id, nueva); }
+    bool increaseKey(uint32_t id, const Clave &nueva) { return updateKey(id, nueva); }
+
+    bool contains(uint32_t id) const {
+        return id < posicion.size() && posicion[id] != NO_ESTA;
+    }
+    const Clave &keyOf(uint32_t id) const { //Clave actual de un id presente
+        if (!contains(id)) {
+            throw std::runtime_error("priorityQueue: id no presente en la cola");
+        }
+        return heap[posicion[id]].clave;
+    }
+
+    bool isEmpty() const { return heap.empty(); } //Verifica si la queue está vacía
+    int size() const { return static_cast<int>(heap.size()); } //Obtiene el tamaño
+    // Entradas en orden de heap (no de prioridad). Como los empates se rompen
+    // por id, reinsertarlas en cualquier orden da la misma secuencia de pop()
+    const std::vector<Entrada> &entradas() const { return heap; }
+
+    void clear() { //Limpia la queue
+        for (const Entrada &e : heap) posicion[e.id] = NO_ESTA;
+        heap.clear();
+    }
+
+    void printQueue() const { //Será de ayuda para debuguear
+        std::cout << "Priority Queue (heap " << Aridad << "-ario): ";
+        for (const Entrada &e : heap) {
+            std::cout << "[" << e.id << ",K:" << e.clave << "] ";
+        }
+        std::cout << std::endl;
+    }
 
 private:
+    static constexpr int NO_ESTA = -1;
+
     // Métodos para manejo del heap
-    int getParent(int index); // Obtener índice del padre
-    int getLeftChild(int index); // Obtener índice del hijo izquierdo
-    int getRightChild(int index); // Obtener índice del hijo derecho
-    bool hasParent(int index);// Verificar si un nodo tiene padre
-    bool hasLeftChild(int index);// Verificar si tiene hijo izquierdo
-    bool hasRightChild(int index);  // Verificar si tiene hijo derecho
-    void swap(int index1, int index2); // Intercambiar dos elementos
-    void goUp();// Reorganizar hacia arriba (último elemento)
-    void goDown();// Reorganizar hacia abajo (desde raíz)
-    void goUpFrom(int index);// Reorganizar hacia arriba desde índice específico
-    void goDownFrom(int index);// Reorganizar hacia abajo desde índice específico
-    
-    vector<Proceso> heap;// Vector que representa el heap
+    static int getParent(int index) { return index == 0 ? -1 : (index - 1) / static_cast<int>(Aridad); }
+    static int getFirstChild(int index) { return static_cast<int>(Aridad) * index + 1; }
+
+    // Orden total: primero la clave según Comparador, luego el id menor
+    bool before(const Entrada &a, const Entrada &b) const {
+        if (comp(a.clave, b.clave)) return true;
+        if (comp(b.clave, a.clave)) return false;
+        return a.id < b.id;
+    }
+
+    void place(int index, const Entrada &e) {
+        heap[index] = e;
+        posicion[e.id] = index;
+    }
+
+    // Reorganizar hacia arriba desde un índice (hueco que sube, sin swaps completos)
+    void goUpFrom(int index) {
+        Entrada e = heap[index];
+        while (index > 0) {
+            int parent = getParent(index);
+            if (!before(e, heap[parent])) break;
+            place(index, heap[parent]);
+            index = parent;
+        }
+        place(index, e);
+    }
+
+    // Reorganizar hacia abajo desde un índice
+    void goDownFrom(int index) {
+        const int n = static_cast<int>(heap.size());
+        Entrada e = heap[index];
+        while (true) {
+            int first = getFirstChild(index);
+            if (first >= n) break;
+            int last = first + static_cast<int>(Aridad);
+            if (last > n) last = n;
+            int best = first;
+            for (int c = first + 1; c < last; ++c) {
+                if (before(heap[c], heap[best])) best = c;
+            }
+            if (!before(heap[best], e)) break;
+            place(index, heap[best]);
+            index = best;
+        }
+        place(index, e);
+    }
+
+    void removeAt(int index) {
+        posicion[heap[index].id] = NO_ESTA;
+        Entrada ultimo = heap.back();
+        heap.pop_back();
+        if (index < static_cast<int>(heap.size())) {
+            place(index, ultimo);
+            // Intentar subir primero; si no se movió, bajar
+            goUpFrom(index);
+            goDownFrom(posicion[ultimo.id]);
+        }
+    }
+
+    bool updateKey(uint32_t id, const Clave &nueva) {
+        if (!contains(id)) return false;
+        int index = posicion[id];
+        heap[index].clave = nueva;
+        goUpFrom(index);
+        goDownFrom(posicion[id]);
+        return true;
+    }
+
+    std::vector<Entrada> heap;     // Vector que representa el heap
+    std::vector<int>     posicion; // id -> índice en heap (o NO_ESTA)
+    Comparador           comp;
 };
 
-#endif // PRIORITYQUEUE_H
\ No newline at end of file
+// Variantes d-arias con mejor comportamiento de caché en colas grandes
+template <typename Clave = int, typename Comparador = std::less<Clave>>
+using priorityQueue4 = priorityQueue<Clave, Comparador, 4>;
+
+template <typename Clave = int, typename Comparador = std::less<Clave>>
+using priorityQueue8 = priorityQueue<Clave, Comparador, 8>;
+
+#endif // PRIORITYQUEUE_H
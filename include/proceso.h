@@ -2,6 +2,7 @@
 #define PROCESO_H
 
 #include <QString>
+#include <QStringList>
 #include <vector>
 
 struct Proceso {
@@ -15,6 +16,11 @@ struct Proceso {
     int turnaroundTime;
 };
 
-std::vector<Proceso> cargarProcesosDesdeArchivo(const QString &ruta);
+/**
+ * Carga procesos desde <ruta> (formato <PID>,<BT>,<AT>,<Priority>).
+ * Si hay errores devuelve un vector vacío y, si `errores` no es nulo,
+ * agrega ahí un mensaje por cada línea inválida.
+ */
+std::vector<Proceso> cargarProcesosDesdeArchivo(const QString &ruta, QStringList *errores = nullptr);
 
 #endif
@@ -0,0 +1,137 @@
+#ifndef PUNTOCONTROL_H
+#define PUNTOCONTROL_H
+
+#include <QFile>
+#include <QString>
+#include <QStringList>
+#include <cstdint>
+#include <vector>
+#include "carga.h"
+#include "politica.h"
+#include "smp.h"
+
+/**
+ * Punto de control del motor de simularMulticore, tomado entre dos eventos:
+ * reloj, colas ready, tiempo restante y estado de cada proceso y núcleo,
+ * contadores y métricas acumuladas, serializados en varints (flujoBinario.h).
+ * De los bloques de Gantt ya cerrados cada punto lleva solo el delta: los
+ * cerrados desde el punto anterior de la misma corrida (o desde su inicio),
+ * así concatenar `bloquesNuevos` de los puntos 0..k rehace la línea de tiempo
+ * hasta el punto k sin que cada punto crezca con la corrida. Con
+ * ConfigSMP::soloAgregados no hay bloques y el delta queda vacío.
+ */
+struct PuntoControl {
+    int tiempo = 0;                         // Ciclo del motor
+    long long eventos = 0;                  // Eventos (pasos del motor) ya procesados
+    size_t bloquesPrevios = 0;              // Bloques cerrados hasta aquí en la línea de tiempo completa
+    std::vector<BloqueGantt> bloquesNuevos; // Cerrados desde el punto anterior
+    std::vector<uint8_t> datos;             // Estado serializado
+};
+
+/**
+ * Recibe cada punto de control en cuanto se toma, sin esperar al final de la
+ * corrida: lo que ya se entregó sobrevive aunque la simulación no termine.
+ */
+class SumideroPuntosControl {
+public:
+    virtual ~SumideroPuntosControl() = default;
+    virtual void puntoTomado(const PuntoControl& punto) = 0;
+};
+
+/**
+ * Sumidero que agrega cada punto al archivo `ruta` (mismo formato que
+ * guardarPuntosControl) y hace flush: tras una caída, cargarPuntosControl
+ * recupera todos los puntos escritos por completo. Al abrir trunca el
+ * archivo y escribe la cabecera; los errores van a `errores` y dejan ok() en
+ * false (los puntos siguientes se descartan).
+ */
+class ArchivoPuntosControl : public SumideroPuntosControl {
+public:
+    explicit ArchivoPuntosControl(const QString& ruta, QStringList* errores = nullptr);
+    bool ok() const { return valido; }
+    void puntoTomado(const PuntoControl& punto) override;
+
+private:
+    QFile archivo;
+    QStringList* errores;
+    bool valido = false;
+};
+
+// simularConPuntosControl, reanudarSimulacion y simularVentana viven en
+// smp.cpp: usan el motor de simularMulticore (sin ráfagas de E/S)
+
+/**
+ * simularMulticore entregando a `sumidero` un punto de control cada
+ * `cadaEventos` eventos (llegadas, fines de ráfaga, de quantum o de cambio de
+ * contexto). El resultado es idéntico al de simularMulticore.
+ */
+ResultadoSMP simularConPuntosControl(const CargaTrabajo& carga,
+                                     Politica politica,
+                                     const ParametrosPolitica& parametros,
+                                     const ConfigSMP& config,
+                                     long long cadaEventos,
+                                     SumideroPuntosControl* sumidero,
+                                     ObservadorSimulacion* obs = nullptr);
+
+// Igual, acumulando los puntos en `puntos`
+ResultadoSMP simularConPuntosControl(const CargaTrabajo& carga,
+                                     Politica politica,
+                                     const ParametrosPolitica& parametros,
+                                     const ConfigSMP& config,
+                                     long long cadaEventos,
+                                     std::vector<PuntoControl>* puntos,
+                                     ObservadorSimulacion* obs = nullptr);
+
+/**
+ * Sigue la simulación desde `punto`, que debe ser de la misma carga, política
+ * y número de CPUs (si no, lo reporta por qDebug y devuelve un resultado
+ * vacío). `procesos`, `metricas` y los contadores salen completos, como si la
+ * corrida no se hubiera cortado; `bloques` trae solo los que se cierran
+ * después del punto: la línea de tiempo completa es
+ * original.bloques[0, bloquesPrevios) seguida de estos. El resto de
+ * `parametros` y `config` (quantum, costos, ...) puede cambiar y rige desde el
+ * siguiente despacho. Con `cadaEventos` > 0 sigue guardando puntos en `puntos`
+ * (el primero trae como delta los bloques cerrados desde `punto`).
+ */
+ResultadoSMP reanudarSimulacion(const CargaTrabajo& carga,
+                                Politica politica,
+                                const ParametrosPolitica& parametros,
+                                const ConfigSMP& config,
+                                const PuntoControl& punto,
+                                long long cadaEventos = 0,
+                                std::vector<PuntoControl>* puntos = nullptr,
+                                ObservadorSimulacion* obs = nullptr);
+
+// Igual, entregando los puntos nuevos a `sumidero` en cuanto se toman
+ResultadoSMP reanudarSimulacion(const CargaTrabajo& carga,
+                                Politica politica,
+                                const ParametrosPolitica& parametros,
+                                const ConfigSMP& config,
+                                const PuntoControl& punto,
+                                long long cadaEventos,
+                                SumideroPuntosControl* sumidero,
+                                ObservadorSimulacion* obs = nullptr);
+
+/**
+ * Salto al ciclo `desde`: restaura el último de `puntos` con tiempo <= desde
+ * (o arranca de cero si no hay) y simula solo hasta `hasta`. Devuelve los
+ * bloques de Gantt de [desde, hasta) recortados a la ventana, ordenados por
+ * inicio y núcleo: los mismos de la corrida completa.
+ */
+std::vector<BloqueGantt> simularVentana(const CargaTrabajo& carga,
+                                        Politica politica,
+                                        const ParametrosPolitica& parametros,
+                                        const ConfigSMP& config,
+                                        const std::vector<PuntoControl>& puntos,
+                                        int desde,
+                                        int hasta);
+
+// Archivo binario con una secuencia de puntos de control (reanudar tras una caída)
+bool guardarPuntosControl(const QString& ruta, const std::vector<PuntoControl>& puntos,
+                          QStringList* errores = nullptr);
+// Vacío si el archivo no existe o no es de puntos de control. Un último punto
+// a medio escribir (caída durante ArchivoPuntosControl) se descarta y se
+// reporta en `errores`: se devuelven los completos anteriores
+std::vector<PuntoControl> cargarPuntosControl(const QString& ruta, QStringList* errores = nullptr);
+
+#endif // PUNTOCONTROL_H
@@ -0,0 +1,93 @@
+#ifndef REPLICACION_H
+#define REPLICACION_H
+
+#include <QString>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "proceso.h"
+#include "politica.h"
+#include "smp.h"
+
+// Distribución del factor (media 1) que multiplica cada interllegada y cada ráfaga
+enum class DistribucionPerturbacion {
+    Uniforme,    // [1 - v·√3, 1 + v·√3] recortado en 0; coeficiente de variación v
+    Lognormal,   // Siempre positivo; coeficiente de variación v
+    Exponencial  // Coeficiente de variación 1 (llegadas de Poisson); v > 0 solo lo activa
+};
+
+// Modo Monte Carlo: R réplicas de la carga perturbada
+struct ConfigReplicacion {
+    int replicas = 30;
+    uint64_t semilla = 1;            // Semilla maestra: cada réplica deriva la suya (semillaReplica)
+    double variacionLlegada = 0.2;   // Coeficiente de variación de las interllegadas (0 = sin perturbar)
+    double variacionRafaga = 0.2;    // Coeficiente de variación de las ráfagas (0 = sin perturbar)
+    DistribucionPerturbacion distribucion = DistribucionPerturbacion::Lognormal;
+    double confianza = 0.95;         // Nivel de los intervalos, en (0, 1)
+    int hilos = 0;                   // 0 = todos los núcleos
+};
+
+// Métricas que se resumen por réplica (una por MetricasEjecucion/ResultadoComparacion)
+enum class MetricaReplicacion {
+    EsperaPromedio, EsperaP50, EsperaP90, EsperaP99, EsperaMaxima,
+    TurnaroundPromedio, TurnaroundP90, TurnaroundP99,
+    RespuestaPromedio, RespuestaP90, RespuestaP99,
+    Makespan, Throughput, UtilizacionCPU, IndiceJain, DesviacionCuota,
+    CambiosContexto, CiclosCambio
+};
+constexpr int NUM_METRICAS_REPLICACION = 18;
+
+QString nombreMetrica(MetricaReplicacion metrica);
+
+// Media entre réplicas con su intervalo t de Student
+struct IntervaloConfianza {
+    double media = 0.0;
+    double desviacion = 0.0;  // Desvío estándar muestral entre réplicas
+    double semiancho = 0.0;   // t(confianza, R - 1) · desviacion / √R
+    double inferior() const { return media - semiancho; }
+    double superior() const { return media + semiancho; }
+};
+
+struct ResumenReplicacion {
+    Politica politica = Politica::FIFO;
+    int replicas = 0;         // Réplicas en que la política corrió (ver ejecutarComparacion)
+    std::array<IntervaloConfianza, NUM_METRICAS_REPLICACION> metricas;
+
+    const IntervaloConfianza& metrica(MetricaReplicacion m) const { return metricas[static_cast<int>(m)]; }
+};
+
+// Semilla de la réplica `replica` (splitmix64 sobre la maestra): no depende
+// del hilo ni del orden en que corran las réplicas
+uint64_t semillaReplica(uint64_t semilla, int replica);
+
+/**
+ * Réplica `replica` de `procesos`: cada interllegada (en orden de llegada) y
+ * cada ráfaga se multiplican por un factor de `config.distribucion`. Las
+ * ráfagas quedan >= 1 y las llegadas simultáneas siguen siéndolo. Misma
+ * (semilla, réplica) -> mismos procesos.
+ */
+std::vector<Proceso> perturbarProcesos(const std::vector<Proceso>& procesos,
+                                       const ConfigReplicacion& config,
+                                       int replica);
+
+/**
+ * Corre `config.replicas` réplicas independientes, repartidas entre
+ * `config.hilos` hilos. En cada réplica todas las `politicas` ven la misma
+ * carga perturbada (números aleatorios comunes: las diferencias entre
+ * políticas no se mezclan con las de la carga), y Lottery sortea con su
+ * propia semilla derivada. El resumen se reduce en orden de réplica, así el
+ * resultado es idéntico con cualquier número de hilos. Va en el orden de
+ * `politicas`; vacío si la entrada o la configuración son inválidas.
+ */
+std::vector<ResumenReplicacion> replicarPoliticas(const std::vector<Proceso>& procesos,
+                                                  const std::vector<Politica>& politicas,
+                                                  const ParametrosPolitica& parametros,
+                                                  const ConfigSMP& configMotor,
+                                                  const ConfigReplicacion& config);
+
+// Cuantil p de la t de Student con `gradosLibertad` grados de libertad
+// (exacto con 1 y 2; expansión de Cornish-Fisher desde 3: error < 1 % con 3
+// grados de libertad y < 0.3 % desde 4, para p <= 0.995)
+double cuantilStudent(double p, int gradosLibertad);
+
+#endif // REPLICACION_H
@@ -0,0 +1,73 @@
+#ifndef SMP_H
+#define SMP_H
+
+#include <vector>
+#include "proceso.h"
+#include "tipos.h"
+#include "observador.h"
+#include "politica.h"
+#include "metricas.h"
+#include "carga.h"
+
+// Configuración de la simulación multicore (SMP)
+struct ConfigSMP {
+    int numCPUs = 1;
+    int penalizacionMigracion = 0; // Ciclos extra al correr en otro núcleo (caché fría)
+    bool robarTrabajo = true;      // Un núcleo ocioso roba de la cola más cargada
+    int costoCambioContexto = 0;   // Ciclos al cargar un proceso distinto del último del núcleo
+    int costoMismoProceso = 0;     // Ciclos al volver a despachar al mismo proceso (fin de quantum)
+    bool soloAgregados = false;    // Sin filas por proceso ni bloques: solo ResultadoSMP::metricas
+};
+
+// Métricas de un núcleo
+struct EstadisticasCPU {
+    long long ciclosOcupado = 0;
+    double utilizacion = 0.0;      // ciclosOcupado / makespan
+    int migracionesEntrantes = 0;  // Procesos robados por este núcleo
+};
+
+struct ResultadoSMP {
+    std::vector<Proceso> procesos;      // Ordenados por completionTime (vacío con soloAgregados)
+    std::vector<BloqueGantt> bloques;   // Con el núcleo en BloqueGantt::cpu
+    std::vector<EstadisticasCPU> cpus;
+    int migraciones = 0;
+    long long ciclosMigracion = 0;      // Total de ciclos de penalización
+    int cambiosContexto = 0;            // Despachos de un proceso distinto del último del núcleo
+    int redespachos = 0;                // Despachos del mismo proceso que acababa de salir
+    long long ciclosCambio = 0;         // Ciclos de CPU perdidos en cambios de contexto
+    int makespan = 0;                   // Fin del último proceso
+    double desbalanceCarga = 0.0;       // max(ocupado) / promedio(ocupado) - 1
+    MetricasEjecucion metricas;         // Percentiles y Jain, acumulados al terminar cada proceso
+};
+
+/**
+ * Simulación A con `config.numCPUs` núcleos, cada uno con su propia cola
+ * ready (heap indexado con la clave de la política). Las llegadas van al
+ * núcleo menos cargado; un núcleo ocioso con la cola vacía roba el siguiente
+ * proceso de la cola más larga. Con un solo núcleo reproduce exactamente las
+ * funciones de algoritmo.h. En Lottery cada núcleo sortea entre los tickets
+ * de su propia cola (un arbolFenwick por núcleo), con un único generador
+ * sembrado con `semillaLoteria`.
+ * Cada despacho cobra `costoCambioContexto` (otro proceso) o
+ * `costoMismoProceso` (el mismo, p. ej. RR sin rivales) ciclos en los que el
+ * núcleo no avanza a nadie; el primer despacho de cada núcleo es gratis. Esos
+ * tramos van en `bloques` con TipoBloque::CambioContexto. En Round Robin con
+ * costoMismoProceso = 0 da las mismas métricas que barridoQuantumRR.
+ * Con `config.soloAgregados` no se arman `procesos` ni `bloques`: la memoria
+ * extra queda en los arreglos por id y los histogramas de `metricas`.
+ */
+ResultadoSMP simularMulticore(const std::vector<Proceso>& procesos,
+                              Politica politica,
+                              const ParametrosPolitica& parametros,
+                              const ConfigSMP& config,
+                              ObservadorSimulacion* obs = nullptr);
+
+// Igual, sobre una carga ya internada y validada (procesosValidos), para
+// correr varias políticas sin volver a copiar, validar ni ordenar los procesos
+ResultadoSMP simularMulticore(const CargaTrabajo& carga,
+                              Politica politica,
+                              const ParametrosPolitica& parametros,
+                              const ConfigSMP& config,
+                              ObservadorSimulacion* obs = nullptr);
+
+#endif // SMP_H
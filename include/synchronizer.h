@@ -3,11 +3,10 @@
 
 #include "proceso.h"
 #include <QString>
+#include <QStringList>
 #include <vector>
 #include "tipos.h" // Para usar BloqueSync
-
-class GanttWindow;
-class QWidget;
+#include "observador.h"
 
 /** Tipo de acción: lectura o escritura */
 enum class ActionType { READ, WRITE };
@@ -40,48 +39,52 @@ struct BloqueSync {
  * Carga procesos desde un archivo (usando Proceso definido en proceso.h).
  * - Formato de cada línea en <ruta>:
  *     <PID>,<BT>,<AT>,<Priority>
+ * Los loaders no muestran diálogos: si hay errores devuelven un vector vacío
+ * y agregan los mensajes a `errores` (si no es nulo).
  */
-std::vector<Proceso> loadProcesos(const QString &ruta);
+std::vector<Proceso> loadProcesos(const QString &ruta, QStringList *errores = nullptr);
 
 /**
  * Carga recursos desde un archivo:
  * - Formato de cada línea:
  *     <NOMBRE>,<COUNT>
  */
-std::vector<Recurso> loadRecursos(const QString &ruta);
+std::vector<Recurso> loadRecursos(const QString &ruta, QStringList *errores = nullptr);
 
 /**
  * Carga acciones desde un archivo:
  * - Formato de cada línea:
  *     <PID>,<ACTION>,<RECURSO>,<CICLO>
  */
-std::vector<Accion> loadAcciones(const QString &ruta);
+std::vector<Accion> loadAcciones(const QString &ruta, QStringList *errores = nullptr);
 
 /**
  * Simula la sección B (mutex/semáforo) y devuelve bloques WAIT/ACCESS.
  * - `acciones` debe estar ordenado por cycle ascendente.
  * - `recursos` proporciona el contador inicial de cada recurso.
+ * - Si la validación de acciones falla devuelve un vector vacío y deja los
+ *   mensajes en `errores`.
  */
 std::vector<BloqueSync> simulateSync(
     const std::vector<Accion> &acciones,
     const std::vector<Proceso> &procesos,
     std::vector<Recurso> &recursosVec,
     bool isMutex = false,
-    GanttWindow *gantt = nullptr,
-    QWidget *parent = nullptr);
+    ObservadorSimulacion *obs = nullptr,
+    QStringList *errores = nullptr);
 
 std::vector<BloqueSync> simulateMutex(
     const std::vector<Accion> &acciones,
     std::vector<Recurso> &recursosVec,
     const std::vector<Proceso> &procesos,
-    GanttWindow *gantt = nullptr,
-    QWidget *parent = nullptr);
+    ObservadorSimulacion *obs = nullptr,
+    QStringList *errores = nullptr);
 
 std::vector<BloqueSync> simulateSyncSemaforo(
     const std::vector<Accion> &acciones,
     std::vector<Recurso> &recursosVec,
     const std::vector<Proceso> &procesos,
-    GanttWindow *gantt = nullptr,
-    QWidget *parent = nullptr);
+    ObservadorSimulacion *obs = nullptr,
+    QStringList *errores = nullptr);
 
 #endif // SYNCHRONIZER_H
\ No newline at end of file
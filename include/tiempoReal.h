@@ -0,0 +1,92 @@
+#ifndef TIEMPOREAL_H
+#define TIEMPOREAL_H
+
+#include <QString>
+#include <QStringList>
+#include <map>
+#include <vector>
+#include "tipos.h"
+#include "observador.h"
+
+// Tarea periódica: libera un trabajo de `wcet` ciclos en fase, fase + periodo,
+// fase + 2·periodo, ... y cada trabajo vence `deadline` ciclos después de su
+// liberación
+struct TareaPeriodica {
+    QString id;
+    int periodo;
+    int wcet;      // Peor tiempo de ejecución (ciclos de CPU por trabajo)
+    int deadline;  // Relativo a la liberación
+    int fase = 0;  // Primera liberación
+};
+
+enum class PoliticaTiempoReal {
+    EDF, // Earliest Deadline First: gana el trabajo con deadline absoluto más cercano
+    RMS  // Rate Monotonic: prioridad fija, menor periodo = mayor prioridad
+};
+
+// Métricas de una tarea a lo largo de la simulación
+struct EstadisticasTarea {
+    QString id;
+    long long trabajos = 0;
+    long long deadlinesPerdidos = 0;
+    long long latenciaMaxima = 0;    // max(fin - deadline absoluto); <= 0 si nunca se atrasó
+    double latenciaPromedio = 0.0;
+    long long respuestaMaxima = 0;   // max(fin - liberación)
+};
+
+struct ResultadoTiempoReal {
+    std::vector<BloqueGantt> bloques;         // Un bloque por tramo de cada trabajo (pid = id de la tarea)
+    std::vector<EstadisticasTarea> tareas;    // En el orden de entrada
+    long long trabajos = 0;
+    long long deadlinesPerdidos = 0;
+    std::map<long long, long long> distribucionLatencia; // latencia (fin - deadline) -> trabajos
+    long long horizonte = 0;                  // Última liberación considerada (exclusiva)
+    long long fin = 0;                        // Fin del último trabajo
+    long long ciclosOcupado = 0;
+    double utilizacionCPU = 0.0;              // ciclosOcupado / max(horizonte, fin)
+};
+
+// Resultado del análisis previo (sin simular)
+struct AnalisisTiempoReal {
+    double utilizacion = 0.0;                 // Σ wcet / periodo
+    double cotaLiuLayland = 0.0;              // n (2^(1/n) - 1)
+    bool planificable = false;
+    bool concluyente = true;                  // false: solo la simulación lo decide
+    std::vector<long long> tiempoRespuesta;   // RMS: peor respuesta por tarea (RTA), -1 si no aplica
+    QString detalle;
+};
+
+/**
+ * Carga tareas periódicas desde <ruta> con formato
+ * <ID>,<Periodo>,<WCET>[,<Deadline>[,<Fase>]] (Deadline por defecto = Periodo).
+ * Si hay errores devuelve un vector vacío y, si `errores` no es nulo,
+ * agrega ahí un mensaje por cada línea inválida.
+ */
+std::vector<TareaPeriodica> cargarTareasPeriodicas(const QString &ruta, QStringList *errores = nullptr);
+
+// Hiperperiodo (mcm de los periodos) + mayor fase; 0 si supera `limite`
+long long calcularHiperperiodo(const std::vector<TareaPeriodica>& tareas, long long limite);
+
+/**
+ * Pre-chequeo rápido de planificabilidad:
+ * - EDF: U <= 1 es exacto con deadline >= periodo; con deadlines menores,
+ *   densidad Σ wcet / min(deadline, periodo) <= 1 es suficiente y U > 1 lo descarta.
+ * - RMS: cota de Liu-Layland (suficiente) y análisis de tiempo de respuesta
+ *   R = C + Σ ceil(R / Tj)·Cj (exacto con deadline <= periodo y fases 0).
+ */
+AnalisisTiempoReal analizarPlanificabilidad(const std::vector<TareaPeriodica>& tareas,
+                                            PoliticaTiempoReal politica);
+
+/**
+ * Simula EDF o RMS expropiativo en una CPU. Los trabajos se generan de forma
+ * perezosa (heap de próximas liberaciones, un trabajo pendiente por tarea
+ * en el heap ready), sin materializar todas las liberaciones del hiperperiodo.
+ * Se liberan trabajos hasta `horizonte` (0 = hiperperiodo + mayor fase) y
+ * luego se terminan los pendientes; un trabajo atrasado sigue ejecutando.
+ */
+ResultadoTiempoReal simularTiempoReal(const std::vector<TareaPeriodica>& tareas,
+                                      PoliticaTiempoReal politica,
+                                      long long horizonte = 0,
+                                      ObservadorSimulacion* obs = nullptr);
+
+#endif // TIEMPOREAL_H
@@ -3,11 +3,19 @@
 
 #include <QString>
 
+// Qué ocupó la CPU durante un bloque de Gantt
+enum class TipoBloque {
+    Proceso,        // `pid` ejecutó
+    CambioContexto  // La CPU cargaba el contexto de `pid` sin avanzarlo
+};
+
 // Estructura compartida para Bloques de Gantt (Simulación A)
 struct BloqueGantt {
     QString pid;
     int inicio;
     int duracion;
+    int cpu = 0; // Núcleo que lo ejecutó (simulación multicore)
+    TipoBloque tipo = TipoBloque::Proceso;
 };
 
 #endif // TIPOS_H
\ No newline at end of file
@@ -2,430 +2,1232 @@
 #include <QDebug>
 #include <algorithm>
 #include <queue>
-#include <map>
+#include <random>
+#include "carga.h"
+#include "colaBuckets.h"
+#include "arbolVruntime.h"
+#include "arbolFenwick.h"
 #include "priorityQueue.h"
-#include "ganttwindow.h"
-#include <QThread>
-#include <QApplication>
+#include "percentilDinamico.h"
+#include "kernelsMetricas.h"
 
-// Función de delay
-void delay(int milisegundos) {
-    QThread::msleep(milisegundos);
-    QApplication::processEvents(); // Procesar eventos de la GUI
+// Adaptador de las funciones públicas con Gantt: expande el resultado y
+// agrega a `bloques` los tramos de su línea de tiempo
+static std::vector<Proceso> adaptarResultado(const CargaTrabajo& carga, const ResultadoCompacto& resultado,
+                                             std::vector<BloqueGantt>& bloques) {
+    agregarBloques(carga, resultado.lineaTiempo, bloques);
+    return expandirResultado(carga, resultado);
 }
 
 // ---------------------
 // First In First Out
 // ---------------------
-std::vector<Proceso> fifo(const std::vector<Proceso>& procesos, GanttWindow* gantt) {
+static ResultadoCompacto fifo(const CargaTrabajo& carga, ObservadorSimulacion* obs) {
     // --- Programación defensiva ---
-    if (procesos.empty()) {
-        qDebug() << "fifo: vector de procesos vacío. Abortando.";
+    if (carga.size() == 0) {
+        qDebug() << "fifo: carga vacía. Abortando.";
         return {};
     }
-    for (const auto& p : procesos) {
-        if (p.arrivalTime < 0) {
-            qDebug() << "fifo: arrivalTime inválido en PID" << p.pid << ":" << p.arrivalTime;
-            return {};
-        }
-        if (p.burstTime <= 0) {
-            qDebug() << "fifo: burstTime inválido en PID" << p.pid << ":" << p.burstTime;
-            return {};
-        }
-        if (p.priority < 0) {
-            qDebug() << "fifo: priority inválido en PID" << p.pid << ":" << p.priority;
-            return {};
-        }
-    }
     // --- Fin defensiva ---
 
-    std::vector<Proceso> resultado = procesos;
-    std::sort(resultado.begin(), resultado.end(), [](const Proceso& a, const Proceso& b) {
-        return a.arrivalTime < b.arrivalTime;
-    });
+    const size_t n = carga.size();
+    ResultadoCompacto resultado;
+    resultado.orden = carga.ordenLlegada;
+    resultado.inicio.resize(n);
+    resultado.fin.resize(n);
 
     int tiempo = 0;
-    for (auto& p : resultado) {
-        if (tiempo < p.arrivalTime)
-            tiempo = p.arrivalTime;
-        p.startTime = tiempo;
-        // En este bucle graficamos al proceso actual en todos los ciclos que ocupa
-        for (int ciclo = 0; ciclo < p.burstTime; ciclo++) {
-            if (gantt) {
-                gantt->agregarBloqueEnTiempoReal(p.pid, tiempo + ciclo);
-                delay(300); // Delay de 300 ms
-            }
+    for (uint32_t id : carga.ordenLlegada) {
+        if (tiempo < carga.arrivalTime[id])
+            tiempo = carga.arrivalTime[id];
+        // Graficamos al proceso actual en todos los ciclos que ocupa
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[id], tiempo, carga.burstTime[id]);
         }
-        p.completionTime = tiempo + p.burstTime;
-        p.waitingTime = p.startTime - p.arrivalTime;
-        p.turnaroundTime = p.completionTime - p.arrivalTime;
-        tiempo = p.completionTime;
+        resultado.lineaTiempo.ejecutar(id, tiempo, carga.burstTime[id]);
+        resultado.inicio[id] = tiempo;
+        tiempo += carga.burstTime[id];
+        resultado.fin[id] = tiempo;
     }
+    completarMetricas(carga, resultado);
     return resultado;
 }
 
+std::vector<Proceso> fifo(const std::vector<Proceso>& procesos, ObservadorSimulacion* obs) {
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesos, "fifo")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesos);
+    return expandirResultado(carga, fifo(carga, obs));
+}
+
 // ---------------------
 // Round Robin
 // ---------------------
-std::vector<Proceso> roundRobin(const std::vector<Proceso>& procesosOriginal, int quantum, std::vector<BloqueGantt>& bloques,
-GanttWindow* gantt) {
+static ResultadoCompacto roundRobin(const CargaTrabajo& carga, int quantum, ObservadorSimulacion* obs) {
     // --- Programación defensiva ---
-    if (procesosOriginal.empty()) {
-        qDebug() << "roundRobin: vector de procesos vacío. Abortando.";
+    if (carga.size() == 0) {
+        qDebug() << "roundRobin: carga vacía. Abortando.";
         return {};
     }
     if (quantum <= 0) {
         qDebug() << "roundRobin: quantum inválido:" << quantum;
         return {};
     }
-    for (const auto& p : procesosOriginal) {
-        if (p.arrivalTime < 0) {
-            qDebug() << "roundRobin: arrivalTime inválido en PID" << p.pid << ":" << p.arrivalTime;
-            return {};
-        }
-        if (p.burstTime <= 0) {
-            qDebug() << "roundRobin: burstTime inválido en PID" << p.pid << ":" << p.burstTime;
-            return {};
-        }
-        if (p.priority < 0) {
-            qDebug() << "roundRobin: priority inválido en PID" << p.pid << ":" << p.priority;
-            return {};
-        }
-    }
     // --- Fin defensiva ---
 
-    std::vector<Proceso> resultado;
-    std::vector<Proceso> procesos = procesosOriginal;
-    std::sort(procesos.begin(), procesos.end(), [](const Proceso& a, const Proceso& b) {
-        return a.arrivalTime < b.arrivalTime;
-    });
-
-    std::queue<Proceso> cola;
-    std::map<QString, int> tiempoRestante;
-    std::map<QString, int> primeraEjecucion;
-    std::map<QString, int> ultimaEjecucion;
-
-    for (const auto& p : procesos)
-        tiempoRestante[p.pid] = p.burstTime;
+    // Estado por proceso en arreglos planos indexados por id denso
+    const size_t n = carga.size();
+    std::vector<int> tiempoRestante(carga.burstTime);
+    std::vector<int> primeraEjecucion(n, -1);
+    std::vector<int> ultimaEjecucion(n, 0);
+    LineaTiempo linea;
+    std::queue<uint32_t> cola;
 
     int tiempo = 0;
     size_t i = 0;
 
-    while (!cola.empty() || i < procesos.size()) {
+    while (!cola.empty() || i < n) {
         // Encolar nuevos procesos que han llegado
-        while (i < procesos.size() && procesos[i].arrivalTime <= tiempo) {
-            cola.push(procesos[i]);
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            cola.push(carga.ordenLlegada[i]);
             i++;
         }
+        // CPU ociosa: saltar directamente a la siguiente llegada
         if (cola.empty()) {
-            tiempo++;
+            tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
             continue;
         }
 
-        Proceso actual = cola.front();
+        uint32_t actual = cola.front();
         cola.pop();
-        if (primeraEjecucion.find(actual.pid) == primeraEjecucion.end())
-            primeraEjecucion[actual.pid] = tiempo;
-
-        int ejecutar = std::min(quantum, tiempoRestante[actual.pid]);
-        for (int ciclo = 0; ciclo < ejecutar; ciclo++) {
-            if (gantt) {
-                gantt->agregarBloqueEnTiempoReal(actual.pid, tiempo + ciclo);
-                delay(300);
-            }
+        if (primeraEjecucion[actual] < 0)
+            primeraEjecucion[actual] = tiempo;
+
+        int ejecutar = std::min(quantum, tiempoRestante[actual]);
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[actual], tiempo, ejecutar);
         }
-        bloques.push_back({actual.pid, tiempo, ejecutar});
-        tiempoRestante[actual.pid] -= ejecutar;
+        linea.ejecutar(actual, tiempo, ejecutar);
+        tiempoRestante[actual] -= ejecutar;
         tiempo += ejecutar;
-        ultimaEjecucion[actual.pid] = tiempo;
-        resultado.push_back(actual);
+        ultimaEjecucion[actual] = tiempo;
 
         // Encolar recién llegados durante la ejecución
-        while (i < procesos.size() && procesos[i].arrivalTime <= tiempo) {
-            cola.push(procesos[i]);
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            cola.push(carga.ordenLlegada[i]);
             i++;
         }
-        if (tiempoRestante[actual.pid] > 0)
+        if (tiempoRestante[actual] > 0)
             cola.push(actual);
     }
 
-    // Calcular métricas finales
-    std::vector<Proceso> final;
-    for (auto p : procesosOriginal) {
-        p.startTime = primeraEjecucion[p.pid];
-        p.completionTime = ultimaEjecucion[p.pid];
-        p.turnaroundTime = p.completionTime - p.arrivalTime;
-        p.waitingTime = p.turnaroundTime - p.burstTime;
-        final.push_back(p);
-    }
-    return final;
+    // Resultado en el orden de la entrada, sin tocar ningún PID
+    ResultadoCompacto resultado;
+    resultado.orden.resize(n);
+    for (uint32_t id = 0; id < n; ++id) resultado.orden[id] = id;
+    resultado.inicio = std::move(primeraEjecucion);
+    resultado.fin = std::move(ultimaEjecucion);
+    resultado.lineaTiempo = std::move(linea);
+    completarMetricas(carga, resultado);
+    return resultado;
+}
+
+std::vector<Proceso> roundRobin(const std::vector<Proceso>& procesosOriginal, int quantum, std::vector<BloqueGantt>& bloques,
+                                ObservadorSimulacion* obs) {
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesosOriginal, "roundRobin")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesosOriginal);
+    return adaptarResultado(carga, roundRobin(carga, quantum, obs), bloques);
 }
 
 // ---------------------
-// Shortest Job First
+// Round Robin adaptativo
+// Como roundRobin, pero el quantum de cada despacho sale del percentil del
+// tiempo restante en la cola ready (dos heaps indexados, O(log n) por evento)
 // ---------------------
-std::vector<Proceso> shortestJobFirst(const std::vector<Proceso>& procesos, GanttWindow* gantt) {
+static ResultadoCompacto roundRobinAdaptativo(const CargaTrabajo& carga, int percentil,
+                                              ObservadorSimulacion* obs) {
     // --- Programación defensiva ---
-    if (procesos.empty()) {
-        qDebug() << "shortestJobFirst: vector de procesos vacío. Abortando.";
+    if (carga.size() == 0) {
+        qDebug() << "roundRobinAdaptativo: carga vacía. Abortando.";
         return {};
     }
-    for (const auto& p : procesos) {
-        if (p.arrivalTime < 0) {
-            qDebug() << "shortestJobFirst: arrivalTime inválido en PID" << p.pid << ":" << p.arrivalTime;
-            return {};
+    if (percentil < 1 || percentil > 100) {
+        qDebug() << "roundRobinAdaptativo: percentil inválido:" << percentil;
+        return {};
+    }
+    // --- Fin defensiva ---
+
+    const size_t n = carga.size();
+    std::vector<int> tiempoRestante(carga.burstTime);
+    std::vector<int> primeraEjecucion(n, -1);
+    std::vector<int> ultimaEjecucion(n, 0);
+    LineaTiempo linea;
+    std::queue<uint32_t> cola;
+    percentilDinamico restantes(percentil, n); // Tiempo restante de quienes están en `cola`
+
+    auto encolar = [&](uint32_t id) {
+        cola.push(id);
+        restantes.insertar(id, tiempoRestante[id]);
+    };
+
+    int tiempo = 0;
+    size_t i = 0;
+
+    while (!cola.empty() || i < n) {
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            encolar(carga.ordenLlegada[i]);
+            i++;
         }
-        if (p.burstTime <= 0) {
-            qDebug() << "shortestJobFirst: burstTime inválido en PID" << p.pid << ":" << p.burstTime;
-            return {};
+        // CPU ociosa: saltar directamente a la siguiente llegada
+        if (cola.empty()) {
+            tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
+            continue;
         }
-        if (p.priority < 0) {
-            qDebug() << "shortestJobFirst: priority inválido en PID" << p.pid << ":" << p.priority;
-            return {};
+
+        // El quantum se fija antes de sacar al actual de la distribución
+        const int quantum = static_cast<int>(restantes.valor());
+        uint32_t actual = cola.front();
+        cola.pop();
+        restantes.quitar(actual);
+        if (primeraEjecucion[actual] < 0)
+            primeraEjecucion[actual] = tiempo;
+
+        int ejecutar = std::min(quantum, tiempoRestante[actual]);
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[actual], tiempo, ejecutar);
         }
+        linea.ejecutar(actual, tiempo, ejecutar);
+        tiempoRestante[actual] -= ejecutar;
+        tiempo += ejecutar;
+        ultimaEjecucion[actual] = tiempo;
+
+        // Recién llegados primero, luego el actual con su nuevo restante
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            encolar(carga.ordenLlegada[i]);
+            i++;
+        }
+        if (tiempoRestante[actual] > 0)
+            encolar(actual);
     }
+
+    return compactarPorTerminacion(carga, std::move(primeraEjecucion), std::move(ultimaEjecucion), std::move(linea));
+}
+
+std::vector<Proceso> roundRobinAdaptativo(const std::vector<Proceso>& procesosOriginal, int percentil,
+                                          std::vector<BloqueGantt>& bloques, ObservadorSimulacion* obs) {
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesosOriginal, "roundRobinAdaptativo")) return {};
     // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesosOriginal);
+    return adaptarResultado(carga, roundRobinAdaptativo(carga, percentil, obs), bloques);
+}
 
-    std::vector<Proceso> ejecucion = procesos;
+// ---------------------
+// Núcleo no expropiativo (SJF y Priority)
+// Event-driven: en cada terminación se elige, entre los procesos que YA
+// llegaron, el de menor `clave` usando un heap ready; si no hay ninguno
+// listo se salta directo a la siguiente llegada. O(n log n).
+// ---------------------
+static ResultadoCompacto planificarNoExpropiativo(
+    const CargaTrabajo& carga,
+    const std::vector<int>& clave,
+    ObservadorSimulacion* obs)
+{
+    const size_t n = carga.size();
+    // (clave, llegada): a igual clave se respeta el orden de llegada
+    priorityQueue<std::pair<int, int>> colaReady(n);
+
+    ResultadoCompacto ejecucion;
+    ejecucion.orden.reserve(n);
+    ejecucion.inicio.resize(n);
+    ejecucion.fin.resize(n);
     int tiempo = 0;
+    size_t i = 0;
 
-    // Orden inicial por burstTime
-    std::sort(ejecucion.begin(), ejecucion.end(), [](const Proceso& a, const Proceso& b) {
-        return a.burstTime < b.burstTime;
-    });
-    for (auto& p : ejecucion) {
-        p.startTime = tiempo;
-        // En este bucle graficamos al proceso actual en todos los ciclos que ocupa
-        for (int ciclo = 0; ciclo < p.burstTime; ciclo++) {
-            if (gantt) {
-                gantt->agregarBloqueEnTiempoReal(p.pid, tiempo + ciclo);
-                delay(300);
-            }
+    while (i < n || !colaReady.isEmpty()) {
+        // Encolar todos los que ya llegaron
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            uint32_t id = carga.ordenLlegada[i];
+            colaReady.insertNewValue(id, {clave[id], carga.arrivalTime[id]});
+            i++;
+        }
+        // CPU ociosa: saltar a la siguiente llegada
+        if (colaReady.isEmpty()) {
+            tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
+            continue;
+        }
+
+        uint32_t id = colaReady.pop().id;
+        // Graficamos al proceso actual en todos los ciclos que ocupa
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[id], tiempo, carga.burstTime[id]);
         }
-        p.completionTime = tiempo + p.burstTime;
-        p.waitingTime = p.startTime - p.arrivalTime;
-        p.turnaroundTime = p.completionTime - p.arrivalTime;
-        tiempo = p.completionTime;
+        ejecucion.orden.push_back(id);
+        ejecucion.lineaTiempo.ejecutar(id, tiempo, carga.burstTime[id]);
+        ejecucion.inicio[id] = tiempo;
+        tiempo += carga.burstTime[id];
+        ejecucion.fin[id] = tiempo;
     }
+    completarMetricas(carga, ejecucion);
     return ejecucion;
 }
 
 // ---------------------
-// Priority Scheduling 
+// Shortest Job First (no expropiativo, respeta arrivalTime)
 // ---------------------
-std::vector<Proceso> priorityScheduling(const std::vector<Proceso>& procesos, GanttWindow* gantt) {
+static ResultadoCompacto shortestJobFirst(const CargaTrabajo& carga, ObservadorSimulacion* obs) {
     // --- Programación defensiva ---
-    if (procesos.empty()) {
-        qDebug() << "priorityScheduling: vector de procesos vacío. Abortando.";
+    if (carga.size() == 0) {
+        qDebug() << "shortestJobFirst: carga vacía. Abortando.";
         return {};
     }
-    for (const auto& p : procesos) {
-        if (p.arrivalTime < 0) {
-            qDebug() << "priorityScheduling: arrivalTime inválido en PID" << p.pid << ":" << p.arrivalTime;
-            return {};
+    // --- Fin defensiva ---
+
+    // Clave de selección: burstTime (a igual ráfaga, el que llegó antes)
+    return planificarNoExpropiativo(carga, carga.burstTime, obs);
+}
+
+std::vector<Proceso> shortestJobFirst(const std::vector<Proceso>& procesos, ObservadorSimulacion* obs) {
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesos, "shortestJobFirst")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesos);
+    return expandirResultado(carga, shortestJobFirst(carga, obs));
+}
+
+// ---------------------
+// Priority Scheduling (no expropiativo, respeta arrivalTime)
+// ---------------------
+static ResultadoCompacto priorityScheduling(const CargaTrabajo& carga, ObservadorSimulacion* obs) {
+    // --- Programación defensiva ---
+    if (carga.size() == 0) {
+        qDebug() << "priorityScheduling: carga vacía. Abortando.";
+        return {};
+    }
+    // --- Fin defensiva ---
+
+    // Clave de selección: priority (menor número = prioridad más alta)
+    return planificarNoExpropiativo(carga, carga.priority, obs);
+}
+
+std::vector<Proceso> priorityScheduling(const std::vector<Proceso>& procesos, ObservadorSimulacion* obs) {
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesos, "priorityScheduling")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesos);
+    return expandirResultado(carga, priorityScheduling(carga, obs));
+}
+
+// -----------------------------------
+// Shortest Remaining Time (SRT) – preemptive
+// Event-driven: el reloj salta de evento en evento (llegada o terminación)
+// en lugar de avanzar ciclo a ciclo; la preempción solo puede ocurrir en una
+// llegada, así que los BloqueGantt resultantes son los mismos.
+// -----------------------------------
+static ResultadoCompacto shortestRemainingTime(
+    const CargaTrabajo& carga,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (carga.size() == 0) {
+        qDebug() << "shortestRemainingTime: carga vacía. Abortando.";
+        return {};
+    }
+    // --- Fin defensiva ---
+
+    // 1) Carga ya internada: ids densos y orden de llegada
+    const size_t n = carga.size();
+
+    // 2) Estado en arreglos planos indexados por id
+    std::vector<int> tiempoRestante(carga.burstTime);
+    std::vector<int> primeraEjecucion(n, -1);
+    std::vector<int> ultimaEjecucion(n, 0);
+    LineaTiempo linea;
+
+    // 3) Cola mínima indexada de entradas compactas (restante, id); a igual
+    //    restante gana el id menor (orden del archivo)
+    priorityQueue<int> colaReady(n);
+
+    int tiempo = 0;
+    size_t i = 0;
+    uint32_t actual = 0;
+    bool hayActual = false;
+    int tickActual = 0;
+
+    while (i < n || !colaReady.isEmpty() || hayActual) {
+        // 4) Encolar todos los que llegan en 'tiempo'
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            uint32_t id = carga.ordenLlegada[i];
+            colaReady.insertNewValue(id, tiempoRestante[id]);
+            i++;
         }
-        if (p.burstTime <= 0) {
-            qDebug() << "priorityScheduling: burstTime inválido en PID" << p.pid << ":" << p.burstTime;
-            return {};
+
+        // 5) Preempción: si hay actual y aparece uno con remaining menor
+        if (hayActual && !colaReady.isEmpty() &&
+            colaReady.top().clave < tiempoRestante[actual]) {
+            // Guardar bloque de Gantt
+            if (tickActual > 0) {
+                linea.ejecutar(actual, tiempo - tickActual, tickActual);
+            }
+            // Reencolar con lo que le queda de ráfaga
+            colaReady.insertNewValue(actual, tiempoRestante[actual]);
+            hayActual = false;
+            tickActual = 0;
         }
-        if (p.priority < 0) {
-            qDebug() << "priorityScheduling: priority inválido en PID" << p.pid << ":" << p.priority;
-            return {};
+
+        // 6) Si no hay actual y cola no está vacía, tomar uno nuevo (O(log n),
+        //    sin buscar el PID en el vector de procesos)
+        if (!hayActual && !colaReady.isEmpty()) {
+            actual = colaReady.pop().id;
+            if (primeraEjecucion[actual] < 0) {
+                primeraEjecucion[actual] = tiempo;
+            }
+            hayActual = true;
+            tickActual = 0;
+        }
+
+        // 7) Si no hay actual y no hay cola pero quedan por llegar, saltar
+        if (!hayActual) {
+            if (i < n) {
+                tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
+                continue;
+            } else {
+                break;
+            }
+        }
+
+        // 8) Ejecutar hasta el siguiente evento: la terminación del actual o la
+        //    próxima llegada (única forma de que cambie el tope de colaReady).
+        //    Así el costo depende del número de eventos y no de las ráfagas.
+        int avance = tiempoRestante[actual];
+        if (i < n && carga.arrivalTime[carga.ordenLlegada[i]] - tiempo < avance) {
+            avance = carga.arrivalTime[carga.ordenLlegada[i]] - tiempo;
+        }
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[actual], tiempo, avance);
         }
+        tiempo += avance;
+        tickActual += avance;
+        tiempoRestante[actual] -= avance;
+
+        // 9) Si termina, cerrar bloque y registrar fin
+        if (tiempoRestante[actual] == 0) {
+            ultimaEjecucion[actual] = tiempo;
+            linea.ejecutar(actual, tiempo - tickActual, tickActual);
+            hayActual = false;
+            tickActual = 0;
+        }
+    }
+
+    // 10) Resultado ordenado por completionTime
+    return compactarPorTerminacion(carga, std::move(primeraEjecucion), std::move(ultimaEjecucion), std::move(linea));
+}
+
+std::vector<Proceso> shortestRemainingTime(
+    const std::vector<Proceso>& procesosOriginal,
+    std::vector<BloqueGantt>& bloques, ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesosOriginal, "shortestRemainingTime")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesosOriginal);
+    return adaptarResultado(carga, shortestRemainingTime(carga, obs), bloques);
+}
+
+// -----------------------------------
+// Preemptive Priority con aging
+// Cola ready = colaBuckets (un FIFO por prioridad + bitmap), así elegir la
+// mejor prioridad es un find-first-set. Los niveles son las prioridades
+// presentes comprimidas a rangos densos (rangosPrioridad), así una prioridad
+// enorme no dimensiona la cola. Cada `envejecimiento` ciclos de espera un
+// proceso sube un nivel (al rango anterior, mínimo 0); esos vencimientos son
+// eventos en un heap indexado junto con llegadas y terminaciones. El proceso
+// en CPU conserva su prioridad efectiva y vuelve a la base si es expropiado.
+// envejecimiento <= 0 desactiva el aging.
+// -----------------------------------
+static ResultadoCompacto preemptivePriorityScheduling(
+    const CargaTrabajo& carga,
+    int envejecimiento,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (carga.size() == 0) {
+        qDebug() << "preemptivePriorityScheduling: carga vacía. Abortando.";
+        return {};
     }
     // --- Fin defensiva ---
 
-    std::vector<Proceso> ejecucion = procesos;
+    const size_t n = carga.size();
+    const bool conAging = envejecimiento > 0;
+
+    std::vector<int> tiempoRestante(carga.burstTime);
+    std::vector<int> primeraEjecucion(n, -1);
+    std::vector<int> ultimaEjecucion(n, 0);
+    LineaTiempo linea;
+    // Un bucket por valor de prioridad presente en la carga
+    int niveles = 0;
+    const std::vector<int> base = rangosPrioridad(carga, &niveles);
+    std::vector<int> efectiva(base);
+    colaBuckets colaReady(niveles, n);
+    // Próximo vencimiento de aging de cada proceso en espera
+    priorityQueue<int> vencimientos(n);
+
+    // Pasa `id` a la cola ready con su prioridad efectiva actual
+    auto encolar = [&](uint32_t id, int ahora) {
+        colaReady.pushBack(id, efectiva[id]);
+        if (conAging && efectiva[id] > 0) {
+            vencimientos.insertNewValue(id, ahora + envejecimiento);
+        }
+    };
+
     int tiempo = 0;
+    size_t i = 0;
+    uint32_t actual = 0;
+    bool hayActual = false;
+    int tickActual = 0;
 
-    // 2) Orden inicial por priority (menor número = prioridad más alta)
-    std::sort(ejecucion.begin(), ejecucion.end(), [](const Proceso& a, const Proceso& b) {
-        return a.priority < b.priority;
-    });
+    while (i < n || !colaReady.isEmpty() || hayActual) {
+        // Llegadas en 'tiempo'
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            encolar(carga.ordenLlegada[i], tiempo);
+            i++;
+        }
 
-    // 3) Recorremos en ese orden
-    for (auto& p : ejecucion) {
-        p.startTime = tiempo;
-        // En este bucle graficamos al proceso actual en todos los ciclos que ocupa
-        for (int ciclo = 0; ciclo < p.burstTime; ++ciclo) {
-            if (gantt) {
-                gantt->agregarBloqueEnTiempoReal(p.pid, tiempo + ciclo);
-                delay(300);
+        // Aging: cada vencimiento sube un nivel al final de su nuevo bucket
+        while (!vencimientos.isEmpty() && vencimientos.top().clave <= tiempo) {
+            auto venc = vencimientos.pop();
+            colaReady.remove(venc.id);
+            efectiva[venc.id]--;
+            colaReady.pushBack(venc.id, efectiva[venc.id]);
+            if (efectiva[venc.id] > 0) {
+                vencimientos.insertNewValue(venc.id, venc.clave + envejecimiento);
             }
         }
-        p.completionTime = tiempo + p.burstTime;
-        p.waitingTime = p.startTime - p.arrivalTime;
-        p.turnaroundTime = p.completionTime - p.arrivalTime;
-        tiempo = p.completionTime;
+
+        // Preempción solo si hay alguien estrictamente más prioritario
+        if (hayActual && !colaReady.isEmpty() &&
+            colaReady.mejorNivel() < efectiva[actual]) {
+            if (tickActual > 0) {
+                linea.ejecutar(actual, tiempo - tickActual, tickActual);
+            }
+            efectiva[actual] = base[actual];
+            encolar(actual, tiempo);
+            hayActual = false;
+            tickActual = 0;
+        }
+
+        // Despacho: frente del bucket más prioritario
+        if (!hayActual && !colaReady.isEmpty()) {
+            actual = colaReady.popMejor();
+            vencimientos.deleteValue(actual);
+            if (primeraEjecucion[actual] < 0) {
+                primeraEjecucion[actual] = tiempo;
+            }
+            hayActual = true;
+            tickActual = 0;
+        }
+
+        // CPU ociosa: saltar a la siguiente llegada
+        if (!hayActual) {
+            if (i < n) {
+                tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
+                continue;
+            } else {
+                break;
+            }
+        }
+
+        // Ejecutar hasta el siguiente evento: terminación, llegada o aging
+        int avance = tiempoRestante[actual];
+        if (i < n && carga.arrivalTime[carga.ordenLlegada[i]] - tiempo < avance) {
+            avance = carga.arrivalTime[carga.ordenLlegada[i]] - tiempo;
+        }
+        if (!vencimientos.isEmpty() && vencimientos.top().clave - tiempo < avance) {
+            avance = vencimientos.top().clave - tiempo;
+        }
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[actual], tiempo, avance);
+        }
+        tiempo += avance;
+        tickActual += avance;
+        tiempoRestante[actual] -= avance;
+
+        if (tiempoRestante[actual] == 0) {
+            ultimaEjecucion[actual] = tiempo;
+            linea.ejecutar(actual, tiempo - tickActual, tickActual);
+            hayActual = false;
+            tickActual = 0;
+        }
     }
-    return ejecucion;
+
+    return compactarPorTerminacion(carga, std::move(primeraEjecucion), std::move(ultimaEjecucion), std::move(linea));
+}
+
+std::vector<Proceso> preemptivePriorityScheduling(
+    const std::vector<Proceso>& procesosOriginal,
+    int envejecimiento,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesosOriginal, "preemptivePriorityScheduling")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesosOriginal);
+    return adaptarResultado(carga, preemptivePriorityScheduling(carga, envejecimiento, obs), bloques);
 }
 
 // -----------------------------------
-// Shortest Remaining Time (SRT) – preemptive
+// Multilevel Feedback Queue (MLFQ)
+// - Un nivel por quantum en `quantumPorNivel` (nivel 0 = más prioritario).
+// - Los procesos llegan al nivel 0; agotar el quantum sin terminar los baja un
+//   nivel (el último nivel es Round Robin con su quantum).
+// - Una llegada a un nivel mejor expropia al actual, que vuelve al final de
+//   su mismo nivel.
+// - Cada `periodoBoost` ciclos todos suben al nivel 0 (0 = sin boost); el
+//   proceso en CPU sigue corriendo con un quantum de nivel 0 nuevo.
+// Elegir el siguiente y degradar son O(1) gracias a colaBuckets; el boost es
+// O(niveles): los niveles se invalidan por época en vez de reescribirse.
 // -----------------------------------
-std::vector<Proceso> shortestRemainingTime(
-    const std::vector<Proceso>& procesosOriginal,
-    std::vector<BloqueGantt>& bloques, GanttWindow* gantt)
+static ResultadoCompacto multilevelFeedbackQueue(
+    const CargaTrabajo& carga,
+    const std::vector<int>& quantumPorNivel,
+    int periodoBoost,
+    ObservadorSimulacion* obs)
 {
     // --- Programación defensiva ---
-    if (procesosOriginal.empty()) {
-        qDebug() << "shortestRemainingTime: vector de procesos vacío. Abortando.";
+    if (carga.size() == 0) {
+        qDebug() << "multilevelFeedbackQueue: carga vacía. Abortando.";
         return {};
     }
-    for (const auto& p : procesosOriginal) {
-        if (p.arrivalTime < 0) {
-            qDebug() << "shortestRemainingTime: arrivalTime inválido en PID" << p.pid << ":" << p.arrivalTime;
+    if (quantumPorNivel.empty()) {
+        qDebug() << "multilevelFeedbackQueue: se necesita al menos un nivel.";
+        return {};
+    }
+    for (int q : quantumPorNivel) {
+        if (q <= 0) {
+            qDebug() << "multilevelFeedbackQueue: quantum inválido:" << q;
             return {};
         }
-        if (p.burstTime <= 0) {
-            qDebug() << "shortestRemainingTime: burstTime inválido en PID" << p.pid << ":" << p.burstTime;
-            return {};
+    }
+    if (periodoBoost < 0) {
+        qDebug() << "multilevelFeedbackQueue: periodo de boost inválido:" << periodoBoost;
+        return {};
+    }
+    // --- Fin defensiva ---
+
+    const size_t n = carga.size();
+    const int niveles = static_cast<int>(quantumPorNivel.size());
+
+    std::vector<int> tiempoRestante(carga.burstTime);
+    std::vector<int> primeraEjecucion(n, -1);
+    std::vector<int> ultimaEjecucion(n, 0);
+    LineaTiempo linea;
+    // Nivel de cada id con la época de boost en que se fijó: un boost solo
+    // incrementa `epocaBoost` y los niveles de épocas anteriores se leen como 0
+    std::vector<int> nivel(n, 0);
+    std::vector<uint32_t> epocaNivel(n, 0);
+    uint32_t epocaBoost = 0;
+    auto nivelDe = [&](uint32_t id) { return epocaNivel[id] == epocaBoost ? nivel[id] : 0; };
+    auto fijarNivel = [&](uint32_t id, int valor) {
+        nivel[id] = valor;
+        epocaNivel[id] = epocaBoost;
+    };
+    colaBuckets colaReady(niveles, n);
+
+    int tiempo = 0;
+    int proximoBoost = periodoBoost > 0 ? periodoBoost : -1;
+    size_t i = 0;
+    uint32_t actual = 0;
+    bool hayActual = false;
+    int tickActual = 0;   // Ciclos del bloque de Gantt abierto
+    int usadoQuantum = 0; // Ciclos consumidos del quantum actual
+
+    // Cierra el bloque de Gantt abierto del proceso en CPU
+    auto cerrarBloque = [&]() {
+        if (tickActual > 0) {
+            linea.ejecutar(actual, tiempo - tickActual, tickActual);
         }
-        if (p.priority < 0) {
-            qDebug() << "shortestRemainingTime: priority inválido en PID" << p.pid << ":" << p.priority;
-            return {};
+        hayActual = false;
+        tickActual = 0;
+    };
+
+    while (i < n || !colaReady.isEmpty() || hayActual) {
+        // Llegadas en 'tiempo' al nivel 0
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            uint32_t id = carga.ordenLlegada[i];
+            fijarNivel(id, 0);
+            colaReady.pushBack(id, 0);
+            i++;
+        }
+
+        // Boost periódico: todos al nivel 0 (en orden de nivel) en un solo
+        // empalme, O(niveles); tras un hueco ocioso se saltan los boosts vencidos
+        if (proximoBoost >= 0 && proximoBoost <= tiempo) {
+            colaReady.promoverTodos(0);
+            epocaBoost++;
+            if (hayActual) {
+                usadoQuantum = 0;
+            }
+            proximoBoost += ((tiempo - proximoBoost) / periodoBoost + 1) * periodoBoost;
+        }
+
+        // Preempción por un nivel estrictamente mejor
+        if (hayActual && !colaReady.isEmpty() &&
+            colaReady.mejorNivel() < nivelDe(actual)) {
+            colaReady.pushBack(actual, nivelDe(actual));
+            cerrarBloque();
+        }
+
+        // Despacho O(1): frente del mejor nivel no vacío
+        if (!hayActual && !colaReady.isEmpty()) {
+            actual = colaReady.popMejor();
+            if (primeraEjecucion[actual] < 0) {
+                primeraEjecucion[actual] = tiempo;
+            }
+            hayActual = true;
+            tickActual = 0;
+            usadoQuantum = 0;
+        }
+
+        // CPU ociosa: saltar a la siguiente llegada (el boost no cambia nada
+        // con la cola vacía)
+        if (!hayActual) {
+            if (i < n) {
+                tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
+                continue;
+            } else {
+                break;
+            }
+        }
+
+        // Ejecutar hasta el siguiente evento: terminación, fin de quantum,
+        // llegada o boost
+        int avance = std::min(tiempoRestante[actual], quantumPorNivel[nivelDe(actual)] - usadoQuantum);
+        if (i < n && carga.arrivalTime[carga.ordenLlegada[i]] - tiempo < avance) {
+            avance = carga.arrivalTime[carga.ordenLlegada[i]] - tiempo;
+        }
+        if (proximoBoost >= 0 && proximoBoost - tiempo < avance) {
+            avance = proximoBoost - tiempo;
+        }
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[actual], tiempo, avance);
+        }
+        tiempo += avance;
+        tickActual += avance;
+        usadoQuantum += avance;
+        tiempoRestante[actual] -= avance;
+
+        if (tiempoRestante[actual] == 0) {
+            ultimaEjecucion[actual] = tiempo;
+            cerrarBloque();
+        } else if (usadoQuantum == quantumPorNivel[nivelDe(actual)]) {
+            // Agotó el quantum: degradar (el último nivel se queda igual)
+            if (nivelDe(actual) < niveles - 1) {
+                fijarNivel(actual, nivelDe(actual) + 1);
+            }
+            uint32_t degradado = actual;
+            cerrarBloque();
+            // Los que llegan en este mismo instante entran antes que él
+            while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+                uint32_t id = carga.ordenLlegada[i];
+                fijarNivel(id, 0);
+                colaReady.pushBack(id, 0);
+                i++;
+            }
+            colaReady.pushBack(degradado, nivelDe(degradado));
         }
     }
+
+    return compactarPorTerminacion(carga, std::move(primeraEjecucion), std::move(ultimaEjecucion), std::move(linea));
+}
+
+std::vector<Proceso> multilevelFeedbackQueue(
+    const std::vector<Proceso>& procesosOriginal,
+    const std::vector<int>& quantumPorNivel,
+    int periodoBoost,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesosOriginal, "multilevelFeedbackQueue")) return {};
     // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesosOriginal);
+    return adaptarResultado(carga, multilevelFeedbackQueue(carga, quantumPorNivel, periodoBoost, obs), bloques);
+}
 
-    // 1) Copiar y ordenar por arrivalTime
-    std::vector<Proceso> procesos = procesosOriginal;
-    std::sort(procesos.begin(), procesos.end(),
-              [](const Proceso& a, const Proceso& b) {
-                  return a.arrivalTime < b.arrivalTime;
-              });
+// -----------------------------------
+// Peso por prioridad (CFS): priority se interpreta como nice 0..19, con la
+// tabla de pesos de Linux (cada nivel ~1.25x menos CPU; nice 0 = 1024)
+// -----------------------------------
+int pesoPorPrioridad(int priority) {
+    static const int pesos[20] = {
+        1024, 820, 655, 526, 423, 335, 272, 215, 172, 137,
+        110,  87,  70,  56,  45,  36,  29,  23,  18,  15
+    };
+    if (priority < 0) priority = 0;
+    if (priority > 19) priority = 19;
+    return pesos[priority];
+}
 
-    // 2) Mapas de estado
-    std::map<QString,int> tiempoRestante;
-    std::map<QString,int> primeraEjecucion;
-    std::map<QString,int> ultimaEjecucion;
-    for (const auto& p : procesos) {
-        tiempoRestante[p.pid] = p.burstTime;
-    }
+// -----------------------------------
+// Núcleo por tiempo virtual (CFS y Stride)
+// - vruntime += ciclos * 1024 / peso (en unidades de 1/1024 de ciclo).
+// - Se ejecuta el de menor vruntime (leftmost del árbol, O(1)) durante
+//   calcularSlice(nEjecutables, peso, pesoTotal) ciclos.
+// - Las llegadas entran con el min_vruntime actual y esperan al fin del
+//   slice en curso (sin expropiación en la llegada).
+// -----------------------------------
+template <typename CalcularSlice>
+static ResultadoCompacto planificarPorVruntime(
+    const CargaTrabajo& carga,
+    CalcularSlice calcularSlice,
+    ObservadorSimulacion* obs)
+{
+    const int64_t ESCALA = 1024;      // Resolución del vruntime (1/1024 ciclo)
+    const int64_t PESO_NICE_0 = 1024;
+
+    const size_t n = carga.size();
+
+    std::vector<int> tiempoRestante(carga.burstTime);
+    std::vector<int> primeraEjecucion(n, -1);
+    std::vector<int> ultimaEjecucion(n, 0);
+    LineaTiempo linea;
+    std::vector<int64_t> peso(n);
+    std::vector<int64_t> vruntime(n, 0);
+    for (uint32_t id = 0; id < n; ++id) peso[id] = pesoPorPrioridad(carga.priority[id]);
 
-    // 3) Cola mínima: priorityQueue por burstTime
-    priorityQueue colaReady;
+    arbolVruntime ejecutables(n);
+    int64_t pesoTotal = 0;  // Suma de pesos ejecutables (incluye el actual)
+    int64_t minVruntime = 0;
 
     int tiempo = 0;
     size_t i = 0;
-    Proceso procesoActual;
+    uint32_t actual = 0;
     bool hayActual = false;
     int tickActual = 0;
+    int sliceRestante = 0;
 
-    while (i < procesos.size() || !colaReady.isEmpty() || hayActual) {
-        // 4) Encolar todos los que llegan en 'tiempo'
-        while (i < procesos.size() && procesos[i].arrivalTime <= tiempo) {
-            Proceso copia = procesos[i];
-            copia.burstTime = tiempoRestante[copia.pid];
-            colaReady.insertNewValue(copia);
+    while (i < n || !ejecutables.isEmpty() || hayActual) {
+        // Llegadas: entran con el mínimo actual (no acumulan crédito)
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            uint32_t id = carga.ordenLlegada[i];
+            vruntime[id] = minVruntime;
+            ejecutables.insert(id, vruntime[id]);
+            pesoTotal += peso[id];
             i++;
         }
 
-        // 5) Preempción: si hay actual y aparece uno con remaining menor
-        if (hayActual) {
-            if (!colaReady.isEmpty()) {
-                Proceso top = colaReady.top();
-                if (top.burstTime < tiempoRestante[procesoActual.pid]) {
-                    // Guardar bloque de Gantt
-                    if (tickActual > 0) {
-                        bloques.push_back({
-                            procesoActual.pid,
-                            tiempo - tickActual,
-                            tickActual
-                        });
-                    }
-                    // Reencolar si queda ráfaga
-                    int rem = tiempoRestante[procesoActual.pid];
-                    if (rem > 0) {
-                        Proceso preemp = procesoActual;
-                        preemp.burstTime = rem;
-                        colaReady.insertNewValue(preemp);
-                    }
-                    hayActual = false;
-                    tickActual = 0;
-                }
+        // Fin de slice: el actual vuelve al árbol y se elige de nuevo
+        if (hayActual && sliceRestante == 0) {
+            ejecutables.insert(actual, vruntime[actual]);
+            if (ejecutables.leftmost().id != actual) {
+                linea.ejecutar(actual, tiempo - tickActual, tickActual);
+                tickActual = 0;
             }
+            hayActual = false;
         }
 
-        // 6) Si no hay actual y cola no está vacía, tomar uno nuevo
-        if (!hayActual && !colaReady.isEmpty()) {
-            Proceso siguiente = colaReady.pop();
-            // Restaurar campos completos desde 'procesos'
-            for (auto& p : procesos) {
-                if (p.pid == siguiente.pid) {
-                    procesoActual = p;
-                    break;
-                }
-            }
-            if (primeraEjecucion.find(procesoActual.pid) == primeraEjecucion.end()) {
-                primeraEjecucion[procesoActual.pid] = tiempo;
+        // Pick-next: leftmost cacheado (O(1)) + borrado O(log n)
+        if (!hayActual && !ejecutables.isEmpty()) {
+            uint32_t siguiente = ejecutables.popLeftmost().id;
+            if (siguiente != actual) tickActual = 0;
+            actual = siguiente;
+            if (primeraEjecucion[actual] < 0) {
+                primeraEjecucion[actual] = tiempo;
             }
             hayActual = true;
-            tickActual = 0;
+            sliceRestante = calcularSlice(static_cast<int64_t>(ejecutables.size()) + 1,
+                                          peso[actual], pesoTotal);
         }
 
-        // 7) Si no hay actual y no hay cola pero quedan por llegar, saltar
+        // CPU ociosa: saltar a la siguiente llegada
         if (!hayActual) {
-            if (i < procesos.size()) {
-                tiempo = procesos[i].arrivalTime;
+            if (i < n) {
+                tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
                 continue;
             } else {
                 break;
             }
         }
 
-        // 8) Ejecutar un ciclo
-        if (gantt) {
-            gantt->agregarBloqueEnTiempoReal(procesoActual.pid, tiempo);
-            delay(300);
+        // Ejecutar hasta terminación, fin de slice o la próxima llegada
+        // (para ubicar al recién llegado con el min_vruntime de ese instante)
+        int avance = std::min(tiempoRestante[actual], sliceRestante);
+        if (i < n && carga.arrivalTime[carga.ordenLlegada[i]] - tiempo < avance) {
+            avance = carga.arrivalTime[carga.ordenLlegada[i]] - tiempo;
+        }
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[actual], tiempo, avance);
         }
-        tiempo++;
-        tickActual++;
-        tiempoRestante[procesoActual.pid]--;
+        tiempo += avance;
+        tickActual += avance;
+        sliceRestante -= avance;
+        tiempoRestante[actual] -= avance;
+        vruntime[actual] += avance * PESO_NICE_0 * ESCALA / peso[actual];
 
-        // 9) Si termina, cerrar bloque y registrar fin
-        if (tiempoRestante[procesoActual.pid] == 0) {
-            ultimaEjecucion[procesoActual.pid] = tiempo;
-            bloques.push_back({
-                procesoActual.pid,
-                tiempo - tickActual,
-                tickActual
-            });
+        // min_vruntime solo avanza: mínimo entre el actual y el leftmost
+        int64_t candidato = vruntime[actual];
+        if (!ejecutables.isEmpty() && ejecutables.leftmost().vruntime < candidato) {
+            candidato = ejecutables.leftmost().vruntime;
+        }
+        minVruntime = std::max(minVruntime, candidato);
+
+        if (tiempoRestante[actual] == 0) {
+            ultimaEjecucion[actual] = tiempo;
+            linea.ejecutar(actual, tiempo - tickActual, tickActual);
+            pesoTotal -= peso[actual];
             hayActual = false;
             tickActual = 0;
         }
     }
 
-    // 10) Construir vector final con todas las métricas
-    std::vector<Proceso> final;
-    for (auto p : procesosOriginal) {
-        p.startTime = primeraEjecucion[p.pid];
-        p.completionTime = ultimaEjecucion[p.pid];
-        p.turnaroundTime = p.completionTime - p.arrivalTime;
-        p.waitingTime = p.completionTime - p.burstTime - p.arrivalTime;
-        final.push_back(p);
+    return compactarPorTerminacion(carga, std::move(primeraEjecucion), std::move(ultimaEjecucion), std::move(linea));
+}
+
+// -----------------------------------
+// Completely Fair Scheduler (CFS)
+// Slice = periodo * peso / pesoTotal, con periodo = latenciaObjetivo o
+// n * granularidadMinima si hay demasiados procesos ejecutables.
+// -----------------------------------
+static ResultadoCompacto completelyFairScheduler(
+    const CargaTrabajo& carga,
+    int latenciaObjetivo,
+    int granularidadMinima,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (carga.size() == 0) {
+        qDebug() << "completelyFairScheduler: carga vacía. Abortando.";
+        return {};
     }
+    if (latenciaObjetivo <= 0 || granularidadMinima <= 0) {
+        qDebug() << "completelyFairScheduler: latencia/granularidad inválidas:" << latenciaObjetivo << granularidadMinima;
+        return {};
+    }
+    // --- Fin defensiva ---
 
-    // 11) Ordenar por completionTime para que el test reciba la secuencia correcta
-    std::sort(final.begin(), final.end(),
-              [](const Proceso &a, const Proceso &b) {
-                  return a.completionTime < b.completionTime;
-              });
+    auto slice = [latenciaObjetivo, granularidadMinima](int64_t nEjecutables, int64_t peso, int64_t pesoTotal) {
+        int64_t periodo = latenciaObjetivo;
+        if (nEjecutables * granularidadMinima > periodo) {
+            periodo = nEjecutables * granularidadMinima;
+        }
+        return static_cast<int>(std::max<int64_t>(1, periodo * peso / pesoTotal));
+    };
+    return planificarPorVruntime(carga, slice, obs);
+}
 
-    return final;
+std::vector<Proceso> completelyFairScheduler(
+    const std::vector<Proceso>& procesosOriginal,
+    int latenciaObjetivo,
+    int granularidadMinima,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesosOriginal, "completelyFairScheduler")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesosOriginal);
+    return adaptarResultado(carga, completelyFairScheduler(carga, latenciaObjetivo, granularidadMinima, obs), bloques);
+}
+
+// -----------------------------------
+// Stride Scheduling
+// Gemelo determinista de Lottery: cada proceso avanza su "pase" en
+// 2^20 / tickets por ciclo (tickets = pesoPorPrioridad) y corre el de menor
+// pase durante un quantum fijo. Es el núcleo de CFS con slice constante.
+// -----------------------------------
+static ResultadoCompacto strideScheduling(
+    const CargaTrabajo& carga,
+    int quantum,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (carga.size() == 0) {
+        qDebug() << "strideScheduling: carga vacía. Abortando.";
+        return {};
+    }
+    if (quantum <= 0) {
+        qDebug() << "strideScheduling: quantum inválido:" << quantum;
+        return {};
+    }
+    // --- Fin defensiva ---
+
+    auto slice = [quantum](int64_t, int64_t, int64_t) { return quantum; };
+    return planificarPorVruntime(carga, slice, obs);
+}
+
+std::vector<Proceso> strideScheduling(
+    const std::vector<Proceso>& procesosOriginal,
+    int quantum,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesosOriginal, "strideScheduling")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesosOriginal);
+    return adaptarResultado(carga, strideScheduling(carga, quantum, obs), bloques);
+}
+
+// -----------------------------------
+// Lottery Scheduling
+// En cada quantum se sortea un boleto entre los tickets de los procesos que
+// ya llegaron (tickets = pesoPorPrioridad). Los tickets viven en un árbol de
+// Fenwick: sorteo, alta y baja en O(log n). Las llegadas entran al sorteo
+// siguiente; con la misma `semilla` la ejecución es reproducible.
+// -----------------------------------
+static ResultadoCompacto lotteryScheduling(
+    const CargaTrabajo& carga,
+    int quantum,
+    uint64_t semilla,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (carga.size() == 0) {
+        qDebug() << "lotteryScheduling: carga vacía. Abortando.";
+        return {};
+    }
+    if (quantum <= 0) {
+        qDebug() << "lotteryScheduling: quantum inválido:" << quantum;
+        return {};
+    }
+    // --- Fin defensiva ---
+
+    const size_t n = carga.size();
+
+    std::vector<int> tiempoRestante(carga.burstTime);
+    std::vector<int> primeraEjecucion(n, -1);
+    std::vector<int> ultimaEjecucion(n, 0);
+    LineaTiempo linea;
+
+    arbolFenwick tickets(n);
+    std::mt19937_64 generador(semilla);
+
+    int tiempo = 0;
+    size_t i = 0;
+    size_t terminados = 0;
+    uint32_t actual = 0;
+    int tickActual = 0;
+
+    while (terminados < n) {
+        // Llegadas: sus tickets entran al sorteo
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            uint32_t id = carga.ordenLlegada[i];
+            tickets.asignar(id, pesoPorPrioridad(carga.priority[id]));
+            i++;
+        }
+
+        // CPU ociosa: saltar a la siguiente llegada
+        if (tickets.isEmpty()) {
+            tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
+            continue;
+        }
+
+        // Sorteo: boleto uniforme en [0, total) y descenso por el árbol
+        const uint64_t boleto = generador() % static_cast<uint64_t>(tickets.total());
+        uint32_t ganador = tickets.buscar(static_cast<int64_t>(boleto));
+        if (ganador != actual && tickActual > 0) {
+            linea.ejecutar(actual, tiempo - tickActual, tickActual);
+            tickActual = 0;
+        }
+        actual = ganador;
+        if (primeraEjecucion[actual] < 0) {
+            primeraEjecucion[actual] = tiempo;
+        }
+
+        int avance = std::min(quantum, tiempoRestante[actual]);
+        if (obs) {
+            obs->tramoEjecutado(carga.pids[actual], tiempo, avance);
+        }
+        tiempo += avance;
+        tickActual += avance;
+        tiempoRestante[actual] -= avance;
+
+        if (tiempoRestante[actual] == 0) {
+            ultimaEjecucion[actual] = tiempo;
+            linea.ejecutar(actual, tiempo - tickActual, tickActual);
+            tickActual = 0;
+            tickets.asignar(actual, 0);
+            terminados++;
+        }
+    }
+
+    return compactarPorTerminacion(carga, std::move(primeraEjecucion), std::move(ultimaEjecucion), std::move(linea));
+}
+
+std::vector<Proceso> lotteryScheduling(
+    const std::vector<Proceso>& procesosOriginal,
+    int quantum,
+    uint64_t semilla,
+    std::vector<BloqueGantt>& bloques,
+    ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesosOriginal, "lotteryScheduling")) return {};
+    // --- Fin defensiva ---
+    const CargaTrabajo carga = internarProcesos(procesosOriginal);
+    return adaptarResultado(carga, lotteryScheduling(carga, quantum, semilla, obs), bloques);
+}
+
+// -----------------------------------
+// Elección de la política en tiempo de ejecución sobre una carga ya
+// internada (comparación de algoritmos): cada política arma solo su propio
+// estado y comparte `carga`, de solo lectura
+// -----------------------------------
+ResultadoCompacto ejecutarPoliticaCompacta(const CargaTrabajo& carga,
+                                           Politica politica,
+                                           const ParametrosPolitica& parametros,
+                                           ObservadorSimulacion* obs)
+{
+    switch (politica) {
+    case Politica::FIFO:
+        return fifo(carga, obs);
+    case Politica::SJF:
+        return shortestJobFirst(carga, obs);
+    case Politica::SRT:
+        return shortestRemainingTime(carga, obs);
+    case Politica::RoundRobin:
+        return roundRobin(carga, parametros.quantum, obs);
+    case Politica::Priority:
+        return priorityScheduling(carga, obs);
+    case Politica::PreemptivePriority:
+        return preemptivePriorityScheduling(carga, parametros.envejecimiento, obs);
+    case Politica::MLFQ:
+        return multilevelFeedbackQueue(carga, parametros.quantumPorNivel, parametros.periodoBoost, obs);
+    case Politica::CFS:
+        return completelyFairScheduler(carga, parametros.latenciaObjetivo, parametros.granularidadMinima, obs);
+    case Politica::Lottery:
+        return lotteryScheduling(carga, parametros.quantum, parametros.semillaLoteria, obs);
+    case Politica::Stride:
+        return strideScheduling(carga, parametros.quantum, obs);
+    case Politica::RoundRobinAdaptativo:
+        return roundRobinAdaptativo(carga, parametros.percentilQuantum, obs);
+    }
+    return {};
+}
+
+std::vector<Proceso> ejecutarPolitica(const CargaTrabajo& carga,
+                                      Politica politica,
+                                      const ParametrosPolitica& parametros,
+                                      std::vector<BloqueGantt>& bloques,
+                                      ObservadorSimulacion* obs)
+{
+    return adaptarResultado(carga, ejecutarPoliticaCompacta(carga, politica, parametros, obs), bloques);
+}
+
+// -----------------------------------
+// Cuota objetivo vs. obtenida por proceso respecto del reparto justo
+// ponderado (GPS): mientras el proceso está en el sistema [llegada, fin)
+// debería recibir peso / pesoTotal(t) de la CPU. Se barre por eventos
+// acumulando S(t) = integral de 1/pesoTotal, así el ideal en ciclos es
+// peso * (S(fin) - S(llegada)). Ambas cuotas se expresan como fracción de
+// CPU durante la estadía (ciclos / (fin - llegada)).
+// -----------------------------------
+std::vector<CuotaProceso> calcularCuotas(const std::vector<Proceso>& ejecucion) {
+    const size_t n = ejecucion.size();
+    // Eventos (tiempo, índice, esLlegada); en un mismo instante da igual el
+    // orden porque S(t) no cambia dentro de un punto
+    struct Evento { int tiempo; uint32_t idx; bool llegada; };
+    std::vector<Evento> eventos;
+    eventos.reserve(2 * n);
+    for (uint32_t k = 0; k < n; ++k) {
+        eventos.push_back({ejecucion[k].arrivalTime, k, true});
+        eventos.push_back({ejecucion[k].completionTime, k, false});
+    }
+    std::sort(eventos.begin(), eventos.end(), [](const Evento& a, const Evento& b) {
+        return a.tiempo < b.tiempo;
+    });
+
+    // La llegada siempre precede al fin (burstTime > 0), así que S(llegada)
+    // ya está guardado cuando se procesa el fin
+    std::vector<double> sLlegada(n, 0.0);
+    std::vector<CuotaProceso> cuotas(n);
+    double s = 0.0;
+    int64_t pesoTotal = 0;
+    int tAnterior = eventos.empty() ? 0 : eventos.front().tiempo;
+    for (const Evento& e : eventos) {
+        if (pesoTotal > 0) {
+            s += static_cast<double>(e.tiempo - tAnterior) / static_cast<double>(pesoTotal);
+        }
+        tAnterior = e.tiempo;
+        const Proceso& p = ejecucion[e.idx];
+        const int w = pesoPorPrioridad(p.priority);
+        if (e.llegada) {
+            sLlegada[e.idx] = s;
+            pesoTotal += w;
+        } else {
+            pesoTotal -= w;
+            const double estadia = p.completionTime - p.arrivalTime;
+            if (estadia > 0) {
+                cuotas[e.idx].objetivo = w * (s - sLlegada[e.idx]) / estadia;
+                cuotas[e.idx].obtenida = p.burstTime / estadia;
+            }
+        }
+    }
+    return cuotas;
+}
+
+// -----------------------------------
+// Desviación de cuota: (obtenida - objetivo) / objetivo, en el orden de
+// `ejecucion`: > 0 recibió más que su cuota, < 0 menos, 0 = perfectamente justo.
+// -----------------------------------
+std::vector<double> calcularDesviacionCuota(const std::vector<Proceso>& ejecucion) {
+    std::vector<CuotaProceso> cuotas = calcularCuotas(ejecucion);
+    std::vector<double> desviacion(cuotas.size(), 0.0);
+    for (size_t k = 0; k < cuotas.size(); ++k) {
+        if (cuotas[k].objetivo > 0.0) {
+            desviacion[k] = (cuotas[k].obtenida - cuotas[k].objetivo) / cuotas[k].objetivo;
+        }
+    }
+    return desviacion;
+}
+
+// -----------------------------------
+// Quantums de MLFQ desde texto ("2,4,8")
+// -----------------------------------
+std::vector<int> parsearQuantums(const QString& texto, QStringList* errores) {
+    std::vector<int> quantums;
+    const QStringList partes = texto.split(',');
+    for (const QString& parte : partes) {
+        bool ok = false;
+        int q = parte.trimmed().toInt(&ok);
+        if (!ok || q <= 0) {
+            if (errores) {
+                errores->append(QString("Quantum inválido: \"%1\" (debe ser un entero > 0)").arg(parte.trimmed()));
+            }
+            return {};
+        }
+        quantums.push_back(q);
+    }
+    return quantums;
+}
+
+// -----------------------------------
+// Cambios de contexto
+// -----------------------------------
+int contarCambiosContexto(const std::vector<Proceso>& ejecucion,
+                          const std::vector<BloqueGantt>& bloques)
+{
+    if (bloques.empty()) {
+        return ejecucion.empty() ? 0 : static_cast<int>(ejecucion.size()) - 1;
+    }
+    int cambios = 0;
+    for (size_t k = 1; k < bloques.size(); ++k) {
+        if (bloques[k].pid != bloques[k - 1].pid) cambios++;
+    }
+    return cambios;
 }
 
 // -----------------------------------
 // Tiempo de espera promedio
 // -----------------------------------
 double calcularTiempoEsperaPromedio(
-    const std::vector<Proceso>& procesosOriginal,
+    const std::vector<Proceso>& /*procesosOriginal*/,
     const std::vector<Proceso>& ejecucion)
 {
-    double total = 0.0;
-    for (const auto& p : ejecucion) {
-        total += p.waitingTime;
-    }
-    return ejecucion.empty() ? 0.0 : total / ejecucion.size();
+    // Suma exacta de la espera con el kernel de columnas (la E/S ya descontada se conserva)
+    return calcularMetricasColumnas(columnasDe(ejecucion)).espera.promedio();
 }
\ No newline at end of file
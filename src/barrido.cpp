@@ -0,0 +1,121 @@
+#include "barrido.h"
+#include <QDebug>
+#include <algorithm>
+#include "carga.h"
+#include "poolHilos.h"
+
+namespace {
+
+// Round Robin solo con agregados (sin bloques ni vector de resultados) para
+// que cada punto del barrido sea barato. Con costo 0 da las mismas métricas
+// que roundRobin(); con cualquier costo, las de simularMulticore con Round
+// Robin en 1 CPU y ese costoCambioContexto (test_barrido_quantum lo compara).
+PuntoBarrido simularRR(const CargaTrabajo& carga, int quantum, int costo) {
+    const size_t n = carga.size();
+    std::vector<int> tiempoRestante(carga.burstTime);
+
+    // Cola circular: cada id está a lo sumo una vez, basta capacidad n
+    std::vector<uint32_t> cola(n);
+    size_t frente = 0, cantidad = 0;
+    auto push = [&](uint32_t id) { cola[(frente + cantidad++) % n] = id; };
+    auto pop = [&]() { uint32_t id = cola[frente]; frente = (frente + 1) % n; cantidad--; return id; };
+
+    const uint32_t NINGUNO = static_cast<uint32_t>(n);
+    uint32_t ultimo = NINGUNO;
+    long long tiempo = 0;
+    size_t i = 0;
+    long long sumaTurnaround = 0, sumaEspera = 0, cambios = 0;
+
+    auto encolarLlegadas = [&]() {
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            push(carga.ordenLlegada[i]);
+            i++;
+        }
+    };
+
+    while (cantidad > 0 || i < n) {
+        encolarLlegadas();
+        if (cantidad == 0) {
+            tiempo = carga.arrivalTime[carga.ordenLlegada[i]];
+            continue;
+        }
+
+        uint32_t actual = pop();
+        if (ultimo != NINGUNO && ultimo != actual) {
+            // Cambio de contexto: la CPU no avanza a nadie durante `costo`
+            cambios++;
+            tiempo += costo;
+        }
+        ultimo = actual;
+
+        int ejecutar = std::min(quantum, tiempoRestante[actual]);
+        tiempoRestante[actual] -= ejecutar;
+        tiempo += ejecutar;
+
+        encolarLlegadas();
+        if (tiempoRestante[actual] > 0) {
+            push(actual);
+        } else {
+            long long turnaround = tiempo - carga.arrivalTime[actual];
+            sumaTurnaround += turnaround;
+            sumaEspera += turnaround - carga.burstTime[actual];
+        }
+    }
+
+    PuntoBarrido punto;
+    punto.quantum = quantum;
+    punto.costoCambio = costo;
+    punto.esperaPromedio = static_cast<double>(sumaEspera) / n;
+    punto.turnaroundPromedio = static_cast<double>(sumaTurnaround) / n;
+    punto.cambiosContexto = cambios;
+    return punto;
+}
+
+} // namespace
+
+std::vector<PuntoBarrido> barridoQuantumRR(const std::vector<Proceso>& procesos,
+                                           int quantumMin,
+                                           int quantumMax,
+                                           const std::vector<int>& costosCambio,
+                                           int hilos)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesos, "barridoQuantumRR")) return {};
+    if (quantumMin <= 0 || quantumMax < quantumMin) {
+        qDebug() << "barridoQuantumRR: rango de quantum inválido:" << quantumMin << quantumMax;
+        return {};
+    }
+    for (int costo : costosCambio) {
+        if (costo < 0) {
+            qDebug() << "barridoQuantumRR: costo de cambio de contexto inválido:" << costo;
+            return {};
+        }
+    }
+    // --- Fin defensiva ---
+
+    // Carga internada una sola vez y compartida (solo lectura) por todos los hilos
+    const CargaTrabajo carga = internarProcesos(procesos);
+    const std::vector<int> costos = costosCambio.empty() ? std::vector<int>{0} : costosCambio;
+    const size_t numQuantums = static_cast<size_t>(quantumMax - quantumMin + 1);
+
+    std::vector<PuntoBarrido> puntos(costos.size() * numQuantums);
+    ejecutarEnParalelo(puntos.size(), hilos, [&](size_t k) {
+        int costo = costos[k / numQuantums];
+        int quantum = quantumMin + static_cast<int>(k % numQuantums);
+        puntos[k] = simularRR(carga, quantum, costo);
+    });
+    return puntos;
+}
+
+int mejorPuntoBarrido(const std::vector<PuntoBarrido>& puntos, int costoCambio) {
+    int mejor = -1;
+    for (size_t k = 0; k < puntos.size(); ++k) {
+        if (puntos[k].costoCambio != costoCambio) continue;
+        if (mejor < 0 || puntos[k].esperaPromedio < puntos[mejor].esperaPromedio ||
+            (puntos[k].esperaPromedio == puntos[mejor].esperaPromedio &&
+             puntos[k].quantum < puntos[mejor].quantum)) {
+            mejor = static_cast<int>(k);
+        }
+    }
+    return mejor;
+}
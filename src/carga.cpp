@@ -0,0 +1,122 @@
+#include "carga.h"
+#include <QDebug>
+#include <algorithm>
+#include "kernelsMetricas.h"
+
+CargaTrabajo internarProcesos(const std::vector<Proceso> &procesos) {
+    CargaTrabajo carga;
+    const size_t n = procesos.size();
+    carga.pids.reserve(n);
+    carga.burstTime.reserve(n);
+    carga.arrivalTime.reserve(n);
+    carga.priority.reserve(n);
+    carga.ordenLlegada.resize(n);
+
+    for (size_t id = 0; id < n; ++id) {
+        const Proceso &p = procesos[id];
+        carga.pids.push_back(p.pid);
+        carga.burstTime.push_back(p.burstTime);
+        carga.arrivalTime.push_back(p.arrivalTime);
+        carga.priority.push_back(p.priority);
+        carga.ordenLlegada[id] = static_cast<uint32_t>(id);
+    }
+
+    // Orden estable: a igual llegada se respeta el orden del archivo
+    const std::vector<int> &llegada = carga.arrivalTime;
+    std::stable_sort(carga.ordenLlegada.begin(), carga.ordenLlegada.end(),
+                     [&llegada](uint32_t a, uint32_t b) {
+                         return llegada[a] < llegada[b];
+                     });
+    return carga;
+}
+
+bool procesosValidos(const std::vector<Proceso> &procesos, const char *funcion) {
+    if (procesos.empty()) {
+        qDebug().nospace() << funcion << ": vector de procesos vacío. Abortando.";
+        return false;
+    }
+    for (const auto &p : procesos) {
+        if (p.arrivalTime < 0) {
+            qDebug().nospace() << funcion << ": arrivalTime inválido en PID " << p.pid << " : " << p.arrivalTime;
+            return false;
+        }
+        if (p.burstTime <= 0) {
+            qDebug().nospace() << funcion << ": burstTime inválido en PID " << p.pid << " : " << p.burstTime;
+            return false;
+        }
+        if (p.priority < 0) {
+            qDebug().nospace() << funcion << ": priority inválido en PID " << p.pid << " : " << p.priority;
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<int> rangosPrioridad(const CargaTrabajo &carga, int *niveles) {
+    std::vector<int> valores(carga.priority);
+    std::sort(valores.begin(), valores.end());
+    valores.erase(std::unique(valores.begin(), valores.end()), valores.end());
+    std::vector<int> rangos(carga.size());
+    for (size_t id = 0; id < carga.size(); ++id) {
+        rangos[id] = static_cast<int>(std::lower_bound(valores.begin(), valores.end(), carga.priority[id]) -
+                                      valores.begin());
+    }
+    if (niveles) *niveles = static_cast<int>(valores.size());
+    return rangos;
+}
+
+Proceso CargaTrabajo::proceso(uint32_t id) const {
+    return Proceso{ pids[id], burstTime[id], arrivalTime[id], priority[id], -1, -1, 0, 0 };
+}
+
+void completarMetricas(const CargaTrabajo &carga, ResultadoCompacto &resultado,
+                       const std::vector<int> *ciclosES) {
+    const size_t n = carga.size();
+    resultado.espera.resize(n);
+    resultado.turnaround.resize(n);
+    resultado.reducciones = calcularMetricasColumnas(carga.arrivalTime.data(), carga.burstTime.data(),
+                                                     resultado.inicio.data(), resultado.fin.data(),
+                                                     ciclosES ? ciclosES->data() : nullptr, n,
+                                                     resultado.turnaround.data(), resultado.espera.data());
+}
+
+ResultadoCompacto compactarPorTerminacion(const CargaTrabajo &carga,
+                                          std::vector<int> primeraEjecucion,
+                                          std::vector<int> ultimaEjecucion,
+                                          LineaTiempo lineaTiempo,
+                                          const std::vector<int> *ciclosES) {
+    const size_t n = carga.size();
+    ResultadoCompacto resultado;
+    resultado.orden.resize(n);
+    for (uint32_t id = 0; id < n; ++id) resultado.orden[id] = id;
+    // A igual fin, orden del archivo
+    std::stable_sort(resultado.orden.begin(), resultado.orden.end(), [&ultimaEjecucion](uint32_t a, uint32_t b) {
+        return ultimaEjecucion[a] < ultimaEjecucion[b];
+    });
+    resultado.inicio = std::move(primeraEjecucion);
+    resultado.fin = std::move(ultimaEjecucion);
+    resultado.lineaTiempo = std::move(lineaTiempo);
+    completarMetricas(carga, resultado, ciclosES);
+    return resultado;
+}
+
+std::vector<Proceso> expandirResultado(const CargaTrabajo &carga, const ResultadoCompacto &resultado) {
+    std::vector<Proceso> procesos;
+    procesos.reserve(resultado.size());
+    for (uint32_t id : resultado.orden) {
+        Proceso p = carga.proceso(id);
+        p.startTime = resultado.inicio[id];
+        p.completionTime = resultado.fin[id];
+        p.waitingTime = resultado.espera[id];
+        p.turnaroundTime = resultado.turnaround[id];
+        procesos.push_back(p);
+    }
+    return procesos;
+}
+
+std::vector<Proceso> resultadosPorTerminacion(const CargaTrabajo &carga,
+                                              const std::vector<int> &primeraEjecucion,
+                                              const std::vector<int> &ultimaEjecucion,
+                                              const std::vector<int> *ciclosES) {
+    return expandirResultado(carga, compactarPorTerminacion(carga, primeraEjecucion, ultimaEjecucion, LineaTiempo(), ciclosES));
+}
@@ -0,0 +1,157 @@
+#include "colaBuckets.h"
+#include <stdexcept>
+
+// Constructor
+colaBuckets::colaBuckets(int niveles, size_t capacidadIds)
+    : cabeza(niveles > 0 ? niveles : 1, NINGUNO),
+      ultimo(niveles > 0 ? niveles : 1, NINGUNO),
+      siguiente(capacidadIds, NINGUNO),
+      anterior(capacidadIds, NINGUNO),
+      nivelId(capacidadIds, NINGUNO),
+      epocaId(capacidadIds, 0),
+      total(0)
+{
+    size_t palabras = (cabeza.size() + 63) / 64;
+    bitmap.assign(palabras, 0);
+    resumen.assign((palabras + 63) / 64, 0);
+}
+
+void colaBuckets::marcar(int nivel) {
+    size_t w = static_cast<size_t>(nivel) / 64;
+    bitmap[w] |= (uint64_t(1) << (nivel % 64));
+    resumen[w / 64] |= (uint64_t(1) << (w % 64));
+}
+
+void colaBuckets::desmarcar(int nivel) {
+    size_t w = static_cast<size_t>(nivel) / 64;
+    bitmap[w] &= ~(uint64_t(1) << (nivel % 64));
+    if (bitmap[w] == 0) {
+        resumen[w / 64] &= ~(uint64_t(1) << (w % 64));
+    }
+}
+
+// Encolar al final del nivel indicado
+void colaBuckets::pushBack(uint32_t id, int nivel) {
+    if (nivel < 0 || nivel >= niveles()) {
+        throw std::runtime_error("colaBuckets: nivel fuera de rango");
+    }
+    if (id >= nivelId.size()) {
+        siguiente.resize(static_cast<size_t>(id) + 1, NINGUNO);
+        anterior.resize(static_cast<size_t>(id) + 1, NINGUNO);
+        nivelId.resize(static_cast<size_t>(id) + 1, NINGUNO);
+        epocaId.resize(static_cast<size_t>(id) + 1, 0);
+    }
+    if (nivelId[id] != NINGUNO) {
+        throw std::runtime_error("colaBuckets: id ya encolado");
+    }
+    nivelId[id]   = nivel;
+    epocaId[id]   = epoca;
+    siguiente[id] = NINGUNO;
+    anterior[id]  = ultimo[nivel];
+    if (ultimo[nivel] != NINGUNO) {
+        siguiente[ultimo[nivel]] = static_cast<int32_t>(id);
+    } else {
+        cabeza[nivel] = static_cast<int32_t>(id);
+        marcar(nivel);
+    }
+    ultimo[nivel] = static_cast<int32_t>(id);
+    total++;
+}
+
+// Sacar un id de su nivel (desenlazar en O(1))
+bool colaBuckets::remove(uint32_t id) {
+    if (!contains(id)) return false;
+    int nivel = nivelActual(id);
+    int32_t ant = anterior[id];
+    int32_t sig = siguiente[id];
+    if (ant != NINGUNO) siguiente[ant] = sig; else cabeza[nivel] = sig;
+    if (sig != NINGUNO) anterior[sig] = ant; else ultimo[nivel] = ant;
+    if (cabeza[nivel] == NINGUNO) {
+        desmarcar(nivel);
+    }
+    nivelId[id] = NINGUNO;
+    total--;
+    return true;
+}
+
+// Nivel no vacío de menor número (find-first-set sobre el bitmap)
+int colaBuckets::mejorNivel() const {
+    for (size_t r = 0; r < resumen.size(); ++r) {
+        if (resumen[r] != 0) {
+            size_t w = r * 64 + static_cast<size_t>(__builtin_ctzll(resumen[r]));
+            return static_cast<int>(w * 64 + static_cast<size_t>(__builtin_ctzll(bitmap[w])));
+        }
+    }
+    return -1;
+}
+
+uint32_t colaBuckets::front(int nivel) const {
+    if (nivel < 0 || nivel >= niveles() || cabeza[nivel] == NINGUNO) {
+        throw std::runtime_error("colaBuckets: nivel vacío");
+    }
+    return static_cast<uint32_t>(cabeza[nivel]);
+}
+
+uint32_t colaBuckets::popMejor() {
+    int nivel = mejorNivel();
+    if (nivel < 0) {
+        throw std::runtime_error("colaBuckets: cola vacía");
+    }
+    uint32_t id = static_cast<uint32_t>(cabeza[nivel]);
+    remove(id);
+    return id;
+}
+
+// Mueve todos los encolados a `destino` respetando el orden de niveles
+// (primero los del nivel 0, luego los del 1...). Las listas se empalman en
+// O(1) por nivel y los ids no se reetiquetan: la nueva época hace que
+// nivelActual() devuelva `destino` para todos los encolados hasta ahora.
+void colaBuckets::promoverTodos(int destino) {
+    if (destino < 0 || destino >= niveles()) {
+        throw std::runtime_error("colaBuckets: nivel fuera de rango");
+    }
+    int32_t nuevaCabeza = NINGUNO;
+    int32_t nuevoUltimo = NINGUNO;
+    for (int nivel = 0; nivel < niveles(); ++nivel) {
+        if (cabeza[nivel] == NINGUNO) continue;
+        if (nuevoUltimo == NINGUNO) {
+            nuevaCabeza = cabeza[nivel];
+        } else {
+            siguiente[nuevoUltimo] = cabeza[nivel];
+            anterior[cabeza[nivel]] = nuevoUltimo;
+        }
+        nuevoUltimo = ultimo[nivel];
+        cabeza[nivel] = ultimo[nivel] = NINGUNO;
+        desmarcar(nivel);
+    }
+    if (nuevaCabeza != NINGUNO) {
+        cabeza[destino] = nuevaCabeza;
+        ultimo[destino] = nuevoUltimo;
+        marcar(destino);
+    }
+    epoca++;
+    destinoPromocion = destino;
+}
+
+std::vector<uint32_t> colaBuckets::enOrden() const {
+    std::vector<uint32_t> ids;
+    ids.reserve(static_cast<size_t>(total));
+    for (int nivel = 0; nivel < niveles(); ++nivel) {
+        for (int32_t id = cabeza[nivel]; id != NINGUNO; id = siguiente[id]) {
+            ids.push_back(static_cast<uint32_t>(id));
+        }
+    }
+    return ids;
+}
+
+int colaBuckets::nivelActual(uint32_t id) const {
+    return epocaId[id] == epoca ? nivelId[id] : destinoPromocion;
+}
+
+bool colaBuckets::contains(uint32_t id) const {
+    return id < nivelId.size() && nivelId[id] != NINGUNO;
+}
+
+int colaBuckets::nivelDe(uint32_t id) const {
+    return contains(id) ? nivelActual(id) : -1;
+}
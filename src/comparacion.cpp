@@ -0,0 +1,104 @@
+#include "comparacion.h"
+#include <QDebug>
+#include <cmath>
+#include "algoritmo.h"
+#include "poolHilos.h"
+
+CargaComparacion prepararComparacion(const std::vector<Proceso>& procesos) {
+    CargaComparacion comparacion;
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesos, "prepararComparacion")) return comparacion;
+    // --- Fin defensiva ---
+    comparacion.carga = internarProcesos(procesos);
+    return comparacion;
+}
+
+CargaComparacion prepararComparacion(const CargaES& cargaES) {
+    // --- Programación defensiva ---
+    if (cargaES.perfiles.size() != cargaES.procesos.size()) {
+        qDebug() << "prepararComparacion: se esperaba un perfil de ráfagas por proceso:"
+                 << cargaES.perfiles.size() << "perfiles," << cargaES.procesos.size() << "procesos.";
+        return CargaComparacion();
+    }
+    // --- Fin defensiva ---
+    CargaComparacion comparacion = prepararComparacion(cargaES.procesos);
+    if (comparacion.valida()) {
+        comparacion.perfiles = cargaES.perfiles;
+        comparacion.dispositivos = cargaES.dispositivos;
+    }
+    return comparacion;
+}
+
+ResultadoComparacion ejecutarComparacion(const CargaComparacion& carga,
+                                         Politica politica,
+                                         const ParametrosPolitica& parametros,
+                                         const ConfigSMP& config)
+{
+    ResultadoComparacion resultado;
+    resultado.politica = politica;
+    // --- Programación defensiva ---
+    if (!carga.valida()) {
+        qDebug() << "ejecutarComparacion: carga vacía o inválida. Abortando.";
+        return resultado;
+    }
+    // --- Fin defensiva ---
+
+    const bool conCostoCambio = config.costoCambioContexto > 0 || config.costoMismoProceso > 0;
+    const bool usaMotor = carga.conES() || conCostoCambio || config.numCPUs > 1 || config.soloAgregados;
+
+    if (carga.conES()) {
+        ResultadoES conES = simularConES(carga.carga, carga.perfiles, carga.dispositivos,
+                                         politica, parametros, config);
+        resultado.procesos = std::move(conES.cpu.procesos);
+        resultado.metricas = conES.cpu.metricas;
+        resultado.utilizacionCPU = conES.utilizacionCPU;
+        resultado.throughput = conES.throughput;
+        resultado.dispositivos = std::move(conES.dispositivos);
+        resultado.cambiosContexto = conES.cpu.cambiosContexto;
+        resultado.ciclosCambio = conES.cpu.ciclosCambio;
+    } else if (usaMotor) {
+        ResultadoSMP motor = simularMulticore(carga.carga, politica, parametros, config);
+        resultado.procesos = std::move(motor.procesos);
+        resultado.metricas = motor.metricas;
+        for (const EstadisticasCPU& cpu : motor.cpus) {
+            resultado.utilizacionCPU += cpu.utilizacion / motor.cpus.size();
+        }
+        resultado.throughput = motor.metricas.throughput;
+        resultado.cambiosContexto = motor.cambiosContexto;
+        resultado.ciclosCambio = motor.ciclosCambio;
+    } else {
+        // Resultado compacto, expandido al detalle por proceso
+        const ResultadoCompacto compacto = ejecutarPoliticaCompacta(carga.carga, politica, parametros);
+        resultado.metricas = calcularMetricas(carga.carga, compacto);
+        if (resultado.metricas.makespan > 0) {
+            long long ocupado = 0;
+            for (uint32_t id : compacto.orden) ocupado += carga.carga.burstTime[id];
+            resultado.utilizacionCPU = static_cast<double>(ocupado) / resultado.metricas.makespan;
+        }
+        resultado.throughput = resultado.metricas.throughput;
+        resultado.procesos = expandirResultado(carga.carga, compacto);
+        resultado.cambiosContexto = compacto.lineaTiempo.cambiosDeProceso();
+    }
+    resultado.ejecutado = resultado.metricas.procesos > 0;
+
+    // Justicia: desviación media respecto de la cuota ponderada (necesita el detalle)
+    if (resultado.ejecutado && !resultado.procesos.empty()) {
+        double suma = 0.0;
+        for (double d : calcularDesviacionCuota(resultado.procesos)) suma += std::fabs(d);
+        resultado.desviacionCuotaPromedio = suma / resultado.procesos.size();
+    }
+    return resultado;
+}
+
+std::vector<ResultadoComparacion> compararPoliticas(const CargaComparacion& carga,
+                                                    const std::vector<Politica>& politicas,
+                                                    const ParametrosPolitica& parametros,
+                                                    const ConfigSMP& config,
+                                                    int hilos)
+{
+    std::vector<ResultadoComparacion> resultados(politicas.size());
+    ejecutarEnParalelo(politicas.size(), hilos, [&](size_t k) {
+        resultados[k] = ejecutarComparacion(carga, politicas[k], parametros, config);
+    });
+    return resultados;
+}
@@ -0,0 +1,152 @@
+#include "entradaSalida.h"
+#include <QFile>
+#include <QTextStream>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+// simularConES vive en smp.cpp: reutiliza el motor de simularMulticore
+
+CargaES cargarProcesosES(const QString &ruta, QStringList *erroresSalida) {
+    CargaES carga;
+    std::unordered_set<QString> seenPIDs;
+    std::unordered_map<QString, int> indiceDispositivo; // Nombre -> índice en carga.dispositivos
+    QStringList errores;
+
+    QFile archivo(ruta);
+    if (!archivo.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        if (erroresSalida) {
+            erroresSalida->append(QString("No se pudo abrir el archivo:\n%1").arg(ruta));
+        }
+        return carga;
+    }
+
+    QTextStream in(&archivo);
+    int lineaNum = 0;
+    while (!in.atEnd()) {
+        QString linea = in.readLine().trimmed();
+        lineaNum++;
+        if (linea.isEmpty()) continue;
+
+        // 4 campos fijos + pares (<DISPOSITIVO>:<E/S>, <CPU>)
+        QStringList partes = linea.split(",");
+        if (partes.size() < 4 || partes.size() % 2 != 0) {
+            errores.append(QString("Formato incorrecto en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(linea));
+            continue;
+        }
+
+        QString pidStr    = partes[0].trimmed();
+        bool    okBurst   = false;
+        bool    okArrival = false;
+        bool    okPrio    = false;
+        int     burstVal   = partes[1].trimmed().toInt(&okBurst);
+        int     arrivalVal = partes[2].trimmed().toInt(&okArrival);
+        int     prioVal    = partes[3].trimmed().toInt(&okPrio);
+
+        if (pidStr.isEmpty()) {
+            errores.append(QString("PID vacío en línea %1 : \"%2\"").arg(lineaNum).arg(linea));
+            continue;
+        }
+        if (!okBurst || burstVal <= 0) {
+            errores.append(QString("BurstTime inválido en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(partes[1].trimmed()));
+            continue;
+        }
+        if (!okArrival || arrivalVal < 0) {
+            errores.append(QString("ArrivalTime inválido en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(partes[2].trimmed()));
+            continue;
+        }
+        if (!okPrio || prioVal < 0) {
+            errores.append(QString("Priority inválido en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(partes[3].trimmed()));
+            continue;
+        }
+        if (seenPIDs.find(pidStr) != seenPIDs.end()) {
+            errores.append(QString("Proceso duplicado detectado: PID \"%1\" en línea %2")
+                          .arg(pidStr).arg(lineaNum));
+            continue;
+        }
+
+        PerfilES perfil;
+        perfil.rafagasCPU.push_back(burstVal);
+        long long totalCPU = burstVal;
+        bool lineaValida = true;
+        for (int k = 4; k + 1 < partes.size(); k += 2) {
+            QStringList es = partes[k].trimmed().split(":");
+            bool okES = false, okCPU = false;
+            int duracionES = es.size() == 2 ? es[1].trimmed().toInt(&okES) : 0;
+            int rafagaCPU  = partes[k + 1].trimmed().toInt(&okCPU);
+            if (es.size() != 2 || es[0].trimmed().isEmpty() || !okES || duracionES <= 0) {
+                errores.append(QString("Ráfaga de E/S inválida en línea %1 : \"%2\"")
+                              .arg(lineaNum).arg(partes[k].trimmed()));
+                lineaValida = false;
+                break;
+            }
+            if (!okCPU || rafagaCPU <= 0) {
+                errores.append(QString("Ráfaga de CPU inválida en línea %1 : \"%2\"")
+                              .arg(lineaNum).arg(partes[k + 1].trimmed()));
+                lineaValida = false;
+                break;
+            }
+            const QString nombre = es[0].trimmed();
+            if (indiceDispositivo.find(nombre) == indiceDispositivo.end()) {
+                indiceDispositivo[nombre] = static_cast<int>(carga.dispositivos.size());
+                Dispositivo dispositivo;
+                dispositivo.nombre = nombre;
+                carga.dispositivos.push_back(dispositivo);
+            }
+            perfil.rafagasES.push_back({indiceDispositivo[nombre], duracionES});
+            perfil.rafagasCPU.push_back(rafagaCPU);
+            totalCPU += rafagaCPU;
+        }
+        if (!lineaValida) continue;
+        if (totalCPU > 1000000000LL) {
+            errores.append(QString("CPU total demasiado grande en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(pidStr));
+            continue;
+        }
+
+        Proceso p;
+        p.pid            = pidStr;
+        p.burstTime      = static_cast<int>(totalCPU);
+        p.arrivalTime    = arrivalVal;
+        p.priority       = prioVal;
+        p.startTime      = -1;
+        p.completionTime = -1;
+        p.waitingTime    = 0;
+        p.turnaroundTime = 0;
+
+        carga.procesos.push_back(p);
+        carga.perfiles.push_back(perfil);
+        seenPIDs.insert(pidStr);
+    }
+
+    archivo.close();
+
+    // Los errores se devuelven al llamador (la GUI decide cómo mostrarlos)
+    if (!errores.isEmpty()) {
+        if (erroresSalida) {
+            erroresSalida->append(errores);
+        }
+        return CargaES();
+    }
+
+    return carga;
+}
+
+void calcularUtilizacionYThroughput(const std::vector<Proceso>& ejecutados,
+                                    double *utilizacion,
+                                    double *throughput)
+{
+    // Cada Proceso aparece una vez (las políticas expropiativas ya consolidan sus tramos)
+    long long ocupado = 0;
+    int makespan = 0;
+    for (const Proceso& p : ejecutados) {
+        ocupado += p.burstTime;
+        makespan = std::max(makespan, p.completionTime);
+    }
+    *utilizacion = makespan > 0 ? static_cast<double>(ocupado) / makespan : 0.0;
+    *throughput  = makespan > 0 ? static_cast<double>(ejecutados.size()) / makespan : 0.0;
+}
@@ -5,6 +5,14 @@
 #include <QScrollBar>
 #include <QVBoxLayout>
 #include <QTimer>
+#include <QThread>
+#include <QApplication>
+
+// Función de delay (animación paso a paso)
+static void delay(int milisegundos) {
+    QThread::msleep(milisegundos);
+    QApplication::processEvents(); // Procesar eventos de la GUI
+}
 
 GanttWindow::GanttWindow(QWidget *parent)
     : QWidget(parent),
@@ -82,13 +90,10 @@ QColor GanttWindow::colorParaPID(const QString &pid) {
 }
 
 // Bloque para Simulación A (se deja tamaño 40×40, texto en dos líneas)
-void GanttWindow::agregarBloqueEnTiempoReal(const QString &pid, int ciclo) {
-    actualizarNumeroCiclo(ciclo);
-
+QLabel *GanttWindow::crearBloqueProceso(QWidget *padre, const QString &pid, int ciclo) {
     QColor colorProceso = colorParaPID(pid);
 
-    QLabel *bloqueUnitario = new QLabel(QString("%1\n%2").arg(pid).arg(ciclo),
-                                        contenedorBloques);
+    QLabel *bloqueUnitario = new QLabel(QString("%1\n%2").arg(pid).arg(ciclo), padre);
     bloqueUnitario->setFixedSize(ANCHO_BASE_UNIDAD, ALTO_UNIDAD);
     bloqueUnitario->setAlignment(Qt::AlignCenter);
     bloqueUnitario->setFrameShape(QFrame::Box);
@@ -98,8 +103,25 @@ void GanttWindow::agregarBloqueEnTiempoReal(const QString &pid, int ciclo) {
         "border: 1px solid #444; margin: 0; padding: 0;")
         .arg(colorProceso.name()));
     bloqueUnitario->setToolTip(QString("Proceso: %1\nCiclo: %2").arg(pid).arg(ciclo));
+    return bloqueUnitario;
+}
 
-    layoutBloques->addWidget(bloqueUnitario);
+QLabel *GanttWindow::crearBloqueCambio(QWidget *padre, const QString &pid, int ciclo) {
+    QLabel *bloqueCambio = new QLabel(QString("CS\n%1").arg(ciclo), padre);
+    bloqueCambio->setFixedSize(ANCHO_BASE_UNIDAD, ALTO_UNIDAD);
+    bloqueCambio->setAlignment(Qt::AlignCenter);
+    bloqueCambio->setStyleSheet(QString(
+        "background-color: #555; color: #eee; font-size: 10px; font-weight: bold; "
+        "border: 2px dashed %1; margin: 0; padding: 0;")
+        .arg(colorParaPID(pid).name()));
+    bloqueCambio->setToolTip(QString("Cambio de contexto hacia %1\nCiclo: %2").arg(pid).arg(ciclo));
+    return bloqueCambio;
+}
+
+void GanttWindow::agregarBloqueEnTiempoReal(const QString &pid, int ciclo) {
+    actualizarNumeroCiclo(ciclo);
+
+    layoutBloques->addWidget(crearBloqueProceso(contenedorBloques, pid, ciclo));
 
     // Auto-scroll horizontal al final (con un breve delay)
     QScrollBar *hbar = scrollArea->horizontalScrollBar();
@@ -118,9 +140,93 @@ void GanttWindow::limpiarDiagrama() {
         delete item;
     }
     colores.clear();
+    carriles.clear();     // Los widgets de los carriles ya se borraron arriba
+    ciclosCarril.clear();
+    carrilesCPU = 0;
     actualizarNumeroCiclo(0);
 }
 
+// Simulación multicore: un carril horizontal por núcleo, apilados en vertical
+void GanttWindow::configurarCPUs(int numCPUs, const QStringList &dispositivos) {
+    limpiarDiagrama();
+    if (numCPUs <= 1 && dispositivos.isEmpty()) {
+        scrollArea->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+        scrollArea->setFixedHeight(ALTO_UNIDAD + 50);
+        return;
+    }
+
+    QWidget *contenedorCarriles = new QWidget(contenedorBloques);
+    QVBoxLayout *vCarriles = new QVBoxLayout(contenedorCarriles);
+    vCarriles->setContentsMargins(0, 0, 0, 0);
+    vCarriles->setSpacing(4);
+
+    const int totalCarriles = numCPUs + dispositivos.size();
+    for (int k = 0; k < totalCarriles; ++k) {
+        QWidget *fila = new QWidget(contenedorCarriles);
+        QHBoxLayout *carril = new QHBoxLayout(fila);
+        carril->setContentsMargins(0, 0, 0, 0);
+        carril->setSpacing(4);
+        carril->setAlignment(Qt::AlignLeft);
+
+        QString nombre = k < numCPUs ? QString("CPU %1").arg(k) : dispositivos[k - numCPUs];
+        QLabel *etiqueta = new QLabel(nombre, fila);
+        etiqueta->setFixedSize(ANCHO_BASE_UNIDAD + 10, ALTO_UNIDAD);
+        etiqueta->setAlignment(Qt::AlignCenter);
+        etiqueta->setStyleSheet("font-weight: bold; color: #333;");
+        carril->addWidget(etiqueta);
+
+        vCarriles->addWidget(fila);
+        carriles.push_back(carril);
+    }
+    ciclosCarril.assign(totalCarriles, 0);
+    carrilesCPU = numCPUs;
+    layoutBloques->addWidget(contenedorCarriles);
+
+    // Hasta 6 carriles visibles a la vez; con más núcleos se hace scroll vertical
+    int visibles = totalCarriles < 6 ? totalCarriles : 6;
+    scrollArea->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    scrollArea->setFixedHeight(visibles * (ALTO_UNIDAD + 4) + 50);
+}
+
+void GanttWindow::agregarBloqueEnCPU(int cpu, const QString &pid, int ciclo, TipoBloque tipo) {
+    if (cpu < 0 || cpu >= static_cast<int>(carriles.size())) {
+        if (tipo == TipoBloque::Proceso) {
+            agregarBloqueEnTiempoReal(pid, ciclo);
+            return;
+        }
+        actualizarNumeroCiclo(ciclo);
+        layoutBloques->addWidget(crearBloqueCambio(contenedorBloques, pid, ciclo));
+        QScrollBar *hbar = scrollArea->horizontalScrollBar();
+        QTimer::singleShot(50, [hbar]() {
+            hbar->setValue(hbar->maximum());
+        });
+        return;
+    }
+    actualizarNumeroCiclo(ciclo);
+
+    QWidget *fila = carriles[cpu]->parentWidget();
+    // Ciclos ociosos del núcleo hasta `ciclo`
+    while (ciclosCarril[cpu] < ciclo) {
+        QLabel *ocioso = new QLabel("-", fila);
+        ocioso->setFixedSize(ANCHO_BASE_UNIDAD, ALTO_UNIDAD);
+        ocioso->setAlignment(Qt::AlignCenter);
+        ocioso->setStyleSheet("background-color: #e0e0e0; color: #888; border: 1px dashed #bbb;");
+        ocioso->setToolTip(cpu < carrilesCPU
+                               ? QString("CPU %1 ociosa\nCiclo: %2").arg(cpu).arg(ciclosCarril[cpu])
+                               : QString("Dispositivo ocioso\nCiclo: %1").arg(ciclosCarril[cpu]));
+        carriles[cpu]->addWidget(ocioso);
+        ciclosCarril[cpu]++;
+    }
+    carriles[cpu]->addWidget(tipo == TipoBloque::Proceso ? crearBloqueProceso(fila, pid, ciclo)
+                                                         : crearBloqueCambio(fila, pid, ciclo));
+    ciclosCarril[cpu] = ciclo + 1;
+
+    QScrollBar *hbar = scrollArea->horizontalScrollBar();
+    QTimer::singleShot(50, [hbar]() {
+        hbar->setValue(hbar->maximum());
+    });
+}
+
 // Bloque para Simulación B (ACCESS vs WAIT)
 void GanttWindow::agregarBloqueSync(const QString &pid,
                                     const QString &recurso,
@@ -225,4 +331,54 @@ void GanttWindow::agregarBloqueSync(const QString &pid,
     QTimer::singleShot(50, [hbar]() {
         hbar->setValue(hbar->maximum());
     });
-}
\ No newline at end of file
+}
+
+// ----- ObservadorSimulacion -----
+
+// Simulación A: un bloque por ciclo con delay de 300 ms
+void GanttWindow::cicloEjecutado(const QString &pid, int ciclo) {
+    agregarBloqueEnTiempoReal(pid, ciclo);
+    delay(300);
+}
+
+// Simulación A multicore: cada ciclo en el carril de su núcleo
+void GanttWindow::tramoEjecutadoEnCPU(int cpu, const QString &pid, int inicio, int duracion) {
+    if (carriles.empty()) {
+        ObservadorSimulacion::tramoEjecutadoEnCPU(cpu, pid, inicio, duracion);
+        return;
+    }
+    for (int ciclo = inicio; ciclo < inicio + duracion; ++ciclo) {
+        agregarBloqueEnCPU(cpu, pid, ciclo);
+        delay(300);
+    }
+}
+
+// Cambio de contexto: un bloque distinto por ciclo perdido, animado como
+// los ciclos de proceso para que el costo se vea en la línea de tiempo
+void GanttWindow::cambioDeContexto(int cpu, const QString &pid, int inicio, int duracion) {
+    for (int ciclo = inicio; ciclo < inicio + duracion; ++ciclo) {
+        agregarBloqueEnCPU(cpu, pid, ciclo, TipoBloque::CambioContexto);
+        delay(300);
+    }
+}
+
+// Simulación A con E/S: la ráfaga se pinta completa en el carril del
+// dispositivo al comenzar (sin delay; la animación la marcan las CPUs)
+void GanttWindow::tramoEntradaSalida(int dispositivo, const QString &pid, int inicio, int duracion) {
+    const int carril = carrilesCPU + dispositivo;
+    if (carril >= static_cast<int>(carriles.size())) return;
+    for (int ciclo = inicio; ciclo < inicio + duracion; ++ciclo) {
+        agregarBloqueEnCPU(carril, pid, ciclo);
+    }
+}
+
+// Simulación B: WAIT se anima ciclo a ciclo (500 ms), ACCESS se deja más tiempo (3 s)
+void GanttWindow::bloqueSync(const QString &pid,
+                             const QString &recurso,
+                             const QString &accion,
+                             int ciclo,
+                             bool accessed)
+{
+    agregarBloqueSync(pid, recurso, accion, ciclo, accessed);
+    delay(accessed ? 3000 : 500);
+}
@@ -0,0 +1,233 @@
+#include "kernelsMetricas.h"
+#include <algorithm>
+#include <climits>
+
+// El camino AVX2 se compila con target("avx2") en esta sola unidad y se elige
+// en tiempo de ejecución: el binario sigue corriendo en CPUs sin AVX2
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KERNELS_METRICAS_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Carriles de la suma de cuadrados: los mismos 8 del camino AVX2 (dos
+// vectores de 4 doubles), así el escalar acumula en el mismo orden
+constexpr int CARRILES = 8;
+
+struct Acumulado {
+    long long suma = 0;
+    double cuadrados[CARRILES] = {};
+    int minimo = INT_MAX;
+    int maximo = INT_MIN;
+
+    void agregar(int valor, size_t i) {
+        suma += valor;
+        const double x = valor;
+        cuadrados[i % CARRILES] += x * x;
+        minimo = std::min(minimo, valor);
+        maximo = std::max(maximo, valor);
+    }
+
+    ReduccionColumna resultado(size_t n) const {
+        ReduccionColumna r;
+        r.cantidad = static_cast<long long>(n);
+        if (n == 0) return r;
+        r.suma = suma;
+        for (double c : cuadrados) r.sumaCuadrados += c;
+        r.minimo = minimo;
+        r.maximo = maximo;
+        return r;
+    }
+};
+
+struct Acumulados {
+    Acumulado turnaround, espera, respuesta;
+};
+
+// Procesos [desde, n); también es la cola del camino AVX2
+void kernelEscalar(const int* llegada, const int* rafaga, const int* inicio, const int* fin,
+                   const int* ciclosES, size_t desde, size_t n,
+                   int* turnaround, int* espera, int* respuesta, Acumulados& a) {
+    for (size_t i = desde; i < n; ++i) {
+        const int vuelta = fin[i] - llegada[i];
+        const int espe = vuelta - rafaga[i] - (ciclosES ? ciclosES[i] : 0);
+        a.turnaround.agregar(vuelta, i);
+        a.espera.agregar(espe, i);
+        if (turnaround) turnaround[i] = vuelta;
+        if (espera) espera[i] = espe;
+        if (inicio) {
+            const int resp = inicio[i] - llegada[i];
+            a.respuesta.agregar(resp, i);
+            if (respuesta) respuesta[i] = resp;
+        }
+    }
+}
+
+#ifdef KERNELS_METRICAS_AVX2
+
+// Sin inicializadores por defecto: el constructor no tendría target("avx2")
+struct AcumuladoAvx2 {
+    __m256i suma;           // 4 × int64
+    __m256d cuadradosBajo;  // carriles 0..3
+    __m256d cuadradosAlto;  // carriles 4..7
+    __m256i minimo;
+    __m256i maximo;
+};
+
+__attribute__((target("avx2")))
+inline void iniciarAvx2(AcumuladoAvx2& a) {
+    a.suma = _mm256_setzero_si256();
+    a.cuadradosBajo = _mm256_setzero_pd();
+    a.cuadradosAlto = _mm256_setzero_pd();
+    a.minimo = _mm256_set1_epi32(INT_MAX);
+    a.maximo = _mm256_set1_epi32(INT_MIN);
+}
+
+__attribute__((target("avx2")))
+inline __m256i cargar(const int* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+__attribute__((target("avx2")))
+inline void guardar(int* p, __m256i v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+__attribute__((target("avx2")))
+inline void agregarAvx2(AcumuladoAvx2& a, __m256i v) {
+    const __m128i bajo = _mm256_castsi256_si128(v);
+    const __m128i alto = _mm256_extracti128_si256(v, 1);
+    a.suma = _mm256_add_epi64(a.suma, _mm256_cvtepi32_epi64(bajo));
+    a.suma = _mm256_add_epi64(a.suma, _mm256_cvtepi32_epi64(alto));
+    const __m256d xb = _mm256_cvtepi32_pd(bajo);
+    const __m256d xa = _mm256_cvtepi32_pd(alto);
+    a.cuadradosBajo = _mm256_add_pd(a.cuadradosBajo, _mm256_mul_pd(xb, xb));
+    a.cuadradosAlto = _mm256_add_pd(a.cuadradosAlto, _mm256_mul_pd(xa, xa));
+    a.minimo = _mm256_min_epi32(a.minimo, v);
+    a.maximo = _mm256_max_epi32(a.maximo, v);
+}
+
+// Vuelca los registros en el acumulador escalar (antes de procesar la cola)
+__attribute__((target("avx2")))
+inline void volcarAvx2(const AcumuladoAvx2& v, Acumulado& a) {
+    alignas(32) long long sumas[4];
+    alignas(32) int minimos[8], maximos[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sumas), v.suma);
+    _mm256_storeu_pd(a.cuadrados, v.cuadradosBajo);
+    _mm256_storeu_pd(a.cuadrados + 4, v.cuadradosAlto);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(minimos), v.minimo);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(maximos), v.maximo);
+    a.suma = sumas[0] + sumas[1] + sumas[2] + sumas[3];
+    a.minimo = *std::min_element(minimos, minimos + 8);
+    a.maximo = *std::max_element(maximos, maximos + 8);
+}
+
+__attribute__((target("avx2")))
+void kernelAvx2(const int* llegada, const int* rafaga, const int* inicio, const int* fin,
+                const int* ciclosES, size_t n,
+                int* turnaround, int* espera, int* respuesta, Acumulados& a) {
+    AcumuladoAvx2 vuelta, espe, resp;
+    iniciarAvx2(vuelta);
+    iniciarAvx2(espe);
+    iniciarAvx2(resp);
+    const size_t bloques = n - n % CARRILES;
+
+    for (size_t i = 0; i < bloques; i += CARRILES) {
+        const __m256i l = cargar(llegada + i);
+        const __m256i t = _mm256_sub_epi32(cargar(fin + i), l);
+        __m256i e = _mm256_sub_epi32(t, cargar(rafaga + i));
+        if (ciclosES) e = _mm256_sub_epi32(e, cargar(ciclosES + i));
+        agregarAvx2(vuelta, t);
+        agregarAvx2(espe, e);
+        if (turnaround) guardar(turnaround + i, t);
+        if (espera) guardar(espera + i, e);
+        if (inicio) {
+            const __m256i r = _mm256_sub_epi32(cargar(inicio + i), l);
+            agregarAvx2(resp, r);
+            if (respuesta) guardar(respuesta + i, r);
+        }
+    }
+
+    volcarAvx2(vuelta, a.turnaround);
+    volcarAvx2(espe, a.espera);
+    if (inicio) volcarAvx2(resp, a.respuesta);
+    kernelEscalar(llegada, rafaga, inicio, fin, ciclosES, bloques, n,
+                  turnaround, espera, respuesta, a);
+}
+
+#endif // KERNELS_METRICAS_AVX2
+
+} // namespace
+
+double ReduccionColumna::varianza() const {
+    if (cantidad == 0) return 0.0;
+    const double media = promedio();
+    return std::max(0.0, sumaCuadrados / cantidad - media * media);
+}
+
+bool kernelsSimdDisponibles() {
+#ifdef KERNELS_METRICAS_AVX2
+    static const bool disponible = __builtin_cpu_supports("avx2");
+    return disponible;
+#else
+    return false;
+#endif
+}
+
+ReduccionesMetricas calcularMetricasColumnas(const int* llegada, const int* rafaga,
+                                             const int* inicio, const int* fin,
+                                             const int* ciclosES, size_t n,
+                                             int* turnaround, int* espera, int* respuesta,
+                                             bool permitirSimd) {
+    Acumulados a;
+#ifdef KERNELS_METRICAS_AVX2
+    if (permitirSimd && kernelsSimdDisponibles()) {
+        kernelAvx2(llegada, rafaga, inicio, fin, ciclosES, n, turnaround, espera, respuesta, a);
+    } else
+#endif
+    {
+        (void)permitirSimd;
+        kernelEscalar(llegada, rafaga, inicio, fin, ciclosES, 0, n, turnaround, espera, respuesta, a);
+    }
+
+    ReduccionesMetricas r;
+    r.turnaround = a.turnaround.resultado(n);
+    r.espera = a.espera.resultado(n);
+    r.respuesta = a.respuesta.resultado(inicio ? n : 0);
+    return r;
+}
+
+ReduccionesMetricas calcularMetricasColumnas(const ColumnasEjecucion& columnas, bool permitirSimd) {
+    return calcularMetricasColumnas(columnas.llegada.data(), columnas.rafaga.data(),
+                                    columnas.inicio.empty() ? nullptr : columnas.inicio.data(),
+                                    columnas.fin.data(),
+                                    columnas.ciclosES.empty() ? nullptr : columnas.ciclosES.data(),
+                                    columnas.size(), nullptr, nullptr, nullptr, permitirSimd);
+}
+
+ColumnasEjecucion columnasDe(const std::vector<Proceso>& ejecucion) {
+    ColumnasEjecucion c;
+    const size_t n = ejecucion.size();
+    c.llegada.resize(n);
+    c.rafaga.resize(n);
+    c.inicio.resize(n);
+    c.fin.resize(n);
+    bool conES = false;
+    for (size_t i = 0; i < n; ++i) {
+        const Proceso& p = ejecucion[i];
+        c.llegada[i] = p.arrivalTime;
+        c.rafaga[i] = p.burstTime;
+        c.inicio[i] = p.startTime;
+        c.fin[i] = p.completionTime;
+        conES = conES || p.completionTime - p.arrivalTime - p.burstTime != p.waitingTime;
+    }
+    if (conES) {
+        c.ciclosES.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            const Proceso& p = ejecucion[i];
+            c.ciclosES[i] = p.completionTime - p.arrivalTime - p.burstTime - p.waitingTime;
+        }
+    }
+    return c;
+}
@@ -0,0 +1,128 @@
+#include "lineaTiempo.h"
+#include <QDebug>
+#include <algorithm>
+#include <climits>
+#include <map>
+#include "carga.h"
+#include "flujoBinario.h"
+
+void LineaTiempo::agregar(uint32_t id, int inicio, int duracion, TipoTramo tipo) {
+    if (duracion <= 0) return;
+    if (inicio < fin()) {
+        qDebug() << "LineaTiempo: tramo superpuesto en" << inicio << "(la línea llega a" << fin() << "). Ignorado.";
+        return;
+    }
+    if (inicio > fin()) {
+        tramos.push_back({Tramo::SIN_PROCESO, fin(), inicio - fin(), TipoTramo::Ocioso});
+    }
+    tramos.push_back({id, inicio, duracion, tipo});
+}
+
+int LineaTiempo::tramoEn(int ciclo) const {
+    if (ciclo < 0 || ciclo >= fin()) return -1;
+    // Primer tramo que termina después de `ciclo`
+    auto it = std::upper_bound(tramos.begin(), tramos.end(), ciclo,
+                               [](int c, const Tramo& t) { return c < t.fin(); });
+    return static_cast<int>(it - tramos.begin());
+}
+
+int LineaTiempo::cambiosDeProceso() const {
+    int cambios = 0;
+    uint32_t anterior = Tramo::SIN_PROCESO;
+    for (const Tramo& t : tramos) {
+        if (t.tipo != TipoTramo::Ejecucion) continue;
+        if (anterior != Tramo::SIN_PROCESO && t.id != anterior) cambios++;
+        anterior = t.id;
+    }
+    return cambios;
+}
+
+std::vector<uint8_t> codificarLineaTiempo(const LineaTiempo& linea) {
+    escritorBinario salida;
+    salida.natural(linea.tramos.size());
+    int64_t idAnterior = 0;
+    for (const Tramo& t : linea.tramos) {
+        salida.natural((static_cast<uint64_t>(t.duracion) << 2) | static_cast<uint64_t>(t.tipo));
+        if (t.tipo != TipoTramo::Ocioso) {
+            salida.entero(static_cast<int64_t>(t.id) - idAnterior);
+            idAnterior = t.id;
+        }
+    }
+    return salida.liberar();
+}
+
+bool decodificarLineaTiempo(const std::vector<uint8_t>& datos, size_t numProcesos, LineaTiempo* linea) {
+    linea->tramos.clear();
+    lectorBinario entrada(datos);
+    // Cada tramo ocupa al menos un byte: un largo imposible no reserva memoria
+    const uint64_t cantidad = entrada.natural();
+    if (!entrada.ok() || cantidad > entrada.restantes()) return false;
+    linea->tramos.reserve(cantidad);
+
+    int64_t idAnterior = 0;
+    int64_t inicio = 0;
+    for (uint64_t k = 0; k < cantidad; ++k) {
+        const uint64_t cabecera = entrada.natural();
+        const uint64_t tipo = cabecera & 3;
+        const uint64_t duracion = cabecera >> 2;
+        if (!entrada.ok() || tipo > static_cast<uint64_t>(TipoTramo::CambioContexto) ||
+            duracion == 0 || inicio + static_cast<int64_t>(duracion) > INT_MAX) {
+            linea->tramos.clear();
+            return false;
+        }
+        Tramo t{Tramo::SIN_PROCESO, static_cast<int>(inicio), static_cast<int>(duracion),
+                static_cast<TipoTramo>(tipo)};
+        if (t.tipo != TipoTramo::Ocioso) {
+            const int64_t id = idAnterior + entrada.entero();
+            if (!entrada.ok() || id < 0 || static_cast<uint64_t>(id) >= numProcesos) {
+                linea->tramos.clear();
+                return false;
+            }
+            t.id = static_cast<uint32_t>(id);
+            idAnterior = id;
+        }
+        linea->tramos.push_back(t);
+        inicio += static_cast<int64_t>(duracion);
+    }
+    if (!entrada.alFinal()) {
+        linea->tramos.clear();
+        return false;
+    }
+    return true;
+}
+
+void agregarBloques(const CargaTrabajo& carga, const LineaTiempo& linea,
+                    std::vector<BloqueGantt>& bloques, int cpu) {
+    for (const Tramo& t : linea.tramos) {
+        if (t.tipo == TipoTramo::Ocioso) continue;
+        bloques.push_back({carga.pids[t.id], t.inicio, t.duracion, cpu,
+                           t.tipo == TipoTramo::CambioContexto ? TipoBloque::CambioContexto
+                                                               : TipoBloque::Proceso});
+    }
+}
+
+std::vector<LineaTiempo> lineasDesdeBloques(const CargaTrabajo& carga,
+                                            const std::vector<BloqueGantt>& bloques,
+                                            int numCPUs) {
+    std::vector<LineaTiempo> lineas(std::max(0, numCPUs));
+    std::map<QString, uint32_t> ids;
+    for (uint32_t id = 0; id < carga.size(); ++id) ids.emplace(carga.pids[id], id);
+
+    // Los bloques de cada núcleo se cierran en orden, pero se ordenan igual
+    std::vector<const BloqueGantt*> orden;
+    orden.reserve(bloques.size());
+    for (const BloqueGantt& b : bloques) orden.push_back(&b);
+    std::stable_sort(orden.begin(), orden.end(), [](const BloqueGantt* a, const BloqueGantt* b) {
+        return a->inicio < b->inicio;
+    });
+    for (const BloqueGantt* b : orden) {
+        auto it = ids.find(b->pid);
+        if (b->cpu < 0 || b->cpu >= numCPUs || it == ids.end()) continue;
+        if (b->tipo == TipoBloque::CambioContexto) {
+            lineas[b->cpu].cambioContexto(it->second, b->inicio, b->duracion);
+        } else {
+            lineas[b->cpu].ejecutar(it->second, b->inicio, b->duracion);
+        }
+    }
+    return lineas;
+}
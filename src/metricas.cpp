@@ -0,0 +1,177 @@
+#include "metricas.h"
+#include <algorithm>
+#include <cmath>
+
+// ---------------------
+// histogramaLatencia
+// ---------------------
+int histogramaLatencia::indice(int64_t valor) {
+    if (valor < EXACTOS) return static_cast<int>(valor);
+    // Potencia de 2 más alta; las 128 sub-cubetas usan los 7 bits siguientes
+    int superior = 63;
+    while (!(static_cast<uint64_t>(valor) >> superior)) --superior;
+    const int desplazamiento = superior - BITS_SUBCUBETA;
+    const int sub = static_cast<int>(valor >> desplazamiento) - SUBCUBETAS;
+    return EXACTOS + (desplazamiento - 1) * SUBCUBETAS + sub;
+}
+
+int64_t histogramaLatencia::limiteSuperior(int indice) {
+    if (indice < EXACTOS) return indice;
+    const int desplazamiento = (indice - EXACTOS) / SUBCUBETAS + 1;
+    const int64_t sub = (indice - EXACTOS) % SUBCUBETAS + SUBCUBETAS;
+    return ((sub + 1) << desplazamiento) - 1;
+}
+
+void histogramaLatencia::registrar(int64_t valor) {
+    if (valor < 0) valor = 0;
+    cuentas[indice(valor)]++;
+    if (total == 0 || valor > mayor) mayor = valor;
+    total++;
+    suma += valor;
+}
+
+int64_t histogramaLatencia::percentil(double p) const {
+    if (total == 0) return 0;
+    p = std::min(100.0, std::max(0.0, p));
+    // Rango (1-based) del registro que deja al menos p % por debajo
+    uint64_t rango = static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total)));
+    if (rango == 0) rango = 1;
+    uint64_t acumulado = 0;
+    for (int i = 0; i < NUM_CUBETAS; ++i) {
+        acumulado += cuentas[i];
+        if (acumulado >= rango) return std::min(limiteSuperior(i), mayor);
+    }
+    return mayor;
+}
+
+void histogramaLatencia::guardar(escritorBinario& salida) const {
+    uint64_t noVacias = 0;
+    for (uint64_t c : cuentas) noVacias += c > 0;
+    salida.natural(noVacias);
+    int anterior = -1;
+    for (int i = 0; i < NUM_CUBETAS; ++i) {
+        if (cuentas[i] == 0) continue;
+        salida.natural(static_cast<uint64_t>(i - anterior));
+        salida.natural(cuentas[i]);
+        anterior = i;
+    }
+    salida.natural(total);
+    salida.real(suma);
+    salida.entero(mayor);
+}
+
+bool histogramaLatencia::restaurar(lectorBinario& entrada) {
+    cuentas.fill(0);
+    const uint64_t noVacias = entrada.natural();
+    int64_t i = -1;
+    for (uint64_t k = 0; k < noVacias && entrada.ok(); ++k) {
+        const uint64_t salto = entrada.natural();
+        if (salto == 0 || salto > static_cast<uint64_t>(NUM_CUBETAS - 1 - i)) return false;
+        i += static_cast<int64_t>(salto);
+        cuentas[i] = entrada.natural();
+    }
+    total = entrada.natural();
+    suma = entrada.real();
+    mayor = entrada.entero();
+    return entrada.ok();
+}
+
+// ---------------------
+// AcumuladorMetricas
+// ---------------------
+void AcumuladorMetricas::agregar(int64_t llegada, int64_t inicio, int64_t fin, int64_t rafaga, int64_t ciclosES) {
+    const int64_t vuelta = fin - llegada;
+    espera.registrar(vuelta - rafaga - ciclosES);
+    turnaround.registrar(vuelta);
+    respuesta.registrar(inicio - llegada);
+    makespan = std::max(makespan, fin);
+    // Cuota recibida: fracción de su estadía que el proceso pasó en CPU
+    const long double cuota = vuelta > 0 ? static_cast<long double>(rafaga) / vuelta : 1.0L;
+    sumaCuota += cuota;
+    sumaCuota2 += cuota * cuota;
+    procesos++;
+}
+
+void AcumuladorMetricas::agregar(const Proceso& p) {
+    const int64_t vuelta = static_cast<int64_t>(p.completionTime) - p.arrivalTime;
+    // waitingTime ya descuenta la E/S si la hubo
+    agregar(p.arrivalTime, p.startTime, p.completionTime, p.burstTime,
+            vuelta - p.burstTime - p.waitingTime);
+}
+
+static ResumenDistribucion resumir(const histogramaLatencia& h) {
+    ResumenDistribucion r;
+    r.promedio = h.promedio();
+    r.p50 = h.percentil(50.0);
+    r.p90 = h.percentil(90.0);
+    r.p99 = h.percentil(99.0);
+    r.maximo = h.maximo();
+    return r;
+}
+
+MetricasEjecucion AcumuladorMetricas::resultado() const {
+    MetricasEjecucion m;
+    m.procesos = procesos;
+    m.espera = resumir(espera);
+    m.turnaround = resumir(turnaround);
+    m.respuesta = resumir(respuesta);
+    m.makespan = makespan;
+    m.throughput = makespan > 0 ? static_cast<double>(procesos) / makespan : 0.0;
+    m.indiceJain = sumaCuota2 > 0
+        ? static_cast<double>(sumaCuota * sumaCuota / (procesos * sumaCuota2))
+        : 0.0;
+    return m;
+}
+
+void AcumuladorMetricas::guardar(escritorBinario& salida) const {
+    espera.guardar(salida);
+    turnaround.guardar(salida);
+    respuesta.guardar(salida);
+    salida.entero(procesos);
+    salida.entero(makespan);
+    salida.real(sumaCuota);
+    salida.real(sumaCuota2);
+}
+
+bool AcumuladorMetricas::restaurar(lectorBinario& entrada) {
+    if (!espera.restaurar(entrada) || !turnaround.restaurar(entrada) || !respuesta.restaurar(entrada)) {
+        return false;
+    }
+    entrada.campo(procesos);
+    entrada.campo(makespan);
+    sumaCuota = entrada.real();
+    sumaCuota2 = entrada.real();
+    return entrada.ok();
+}
+
+MetricasEjecucion calcularMetricas(const std::vector<Proceso>& ejecucion) {
+    AcumuladorMetricas acumulador;
+    for (const Proceso& p : ejecucion) acumulador.agregar(p);
+    return acumulador.resultado();
+}
+
+MetricasEjecucion calcularMetricas(const CargaTrabajo& carga, const ResultadoCompacto& resultado) {
+    AcumuladorMetricas acumulador;
+    for (uint32_t id : resultado.orden) {
+        const int64_t vuelta = resultado.turnaround[id];
+        acumulador.agregar(carga.arrivalTime[id], resultado.inicio[id], resultado.fin[id], carga.burstTime[id],
+                           vuelta - carga.burstTime[id] - resultado.espera[id]);
+    }
+    MetricasEjecucion metricas = acumulador.resultado();
+    // Sin reducciones (resultado armado a mano) quedan las de los histogramas
+    if (resultado.reducciones.espera.cantidad == static_cast<long long>(resultado.size())) {
+        aplicarReducciones(metricas, resultado.reducciones);
+    }
+    return metricas;
+}
+
+static void aplicarReduccion(ResumenDistribucion& resumen, const ReduccionColumna& columna) {
+    resumen.promedio = columna.promedio();
+    resumen.maximo = columna.maximo;
+}
+
+void aplicarReducciones(MetricasEjecucion& metricas, const ReduccionesMetricas& reducciones) {
+    aplicarReduccion(metricas.espera, reducciones.espera);
+    aplicarReduccion(metricas.turnaround, reducciones.turnaround);
+    aplicarReduccion(metricas.respuesta, reducciones.respuesta);
+}
@@ -0,0 +1,172 @@
+#include "modeloAnalitico.h"
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace {
+
+// Clase de prioridad del modelo: fracción de las llegadas y momentos de su servicio
+struct ClaseModelo {
+    double fraccion = 0.0;
+    double servicio = 0.0;          // E[S_k]
+    double servicioCuadrado = 0.0;  // E[S_k²]
+};
+
+// Clases por valor de `clave` (menor = más urgente), de a un grupo de iguales
+std::vector<ClaseModelo> clasesPor(const std::vector<int>& clave, const std::vector<int>& rafaga) {
+    const size_t n = clave.size();
+    std::vector<std::pair<int, int>> pares(n);
+    for (size_t id = 0; id < n; ++id) pares[id] = {clave[id], rafaga[id]};
+    std::sort(pares.begin(), pares.end());
+
+    std::vector<ClaseModelo> clases;
+    for (size_t k = 0; k < n;) {
+        size_t fin = k;
+        double suma = 0.0, suma2 = 0.0;
+        while (fin < n && pares[fin].first == pares[k].first) {
+            const double s = pares[fin].second;
+            suma += s;
+            suma2 += s * s;
+            fin++;
+        }
+        const double cantidad = static_cast<double>(fin - k);
+        clases.push_back({cantidad / n, suma / cantidad, suma2 / cantidad});
+        k = fin;
+    }
+    return clases;
+}
+
+// Espera promedio con prioridades (Cobham si !expropiativa; reanudación si
+// expropiativa). false si alguna clase satura la CPU
+bool esperaPorClases(const std::vector<ClaseModelo>& clases, double tasaLlegada, bool expropiativa,
+                     double* espera) {
+    double residual = 0.0;  // W0 = Σ λ_k·E[S_k²] / 2 (todas las clases)
+    for (const ClaseModelo& c : clases) residual += tasaLlegada * c.fraccion * c.servicioCuadrado / 2.0;
+
+    double total = 0.0;
+    double cargaPrevia = 0.0;     // σ_{k−1}: carga de las clases más urgentes
+    double residualHasta = 0.0;   // Σ_{j<=k} λ_j·E[S_j²] / 2
+    for (const ClaseModelo& c : clases) {
+        const double cargaHasta = cargaPrevia + tasaLlegada * c.fraccion * c.servicio;
+        if (cargaHasta >= 1.0) return false;
+        residualHasta += tasaLlegada * c.fraccion * c.servicioCuadrado / 2.0;
+        double esperaClase;
+        if (expropiativa) {
+            // T_k = E[S_k] / (1 − σ_{k−1}) + R_k / ((1 − σ_{k−1})(1 − σ_k)); W_k = T_k − E[S_k]
+            const double vuelta = c.servicio / (1.0 - cargaPrevia) +
+                                  residualHasta / ((1.0 - cargaPrevia) * (1.0 - cargaHasta));
+            esperaClase = vuelta - c.servicio;
+        } else {
+            esperaClase = residual / ((1.0 - cargaPrevia) * (1.0 - cargaHasta));
+        }
+        total += c.fraccion * esperaClase;
+        cargaPrevia = cargaHasta;
+    }
+    *espera = total;
+    return true;
+}
+
+} // namespace
+
+AjusteCarga ajustarCarga(const CargaTrabajo& carga) {
+    AjusteCarga ajuste;
+    const size_t n = carga.size();
+    ajuste.procesos = static_cast<long long>(n);
+    if (n == 0) return ajuste;
+
+    double suma = 0.0, suma2 = 0.0;
+    for (size_t id = 0; id < n; ++id) {
+        const double s = carga.burstTime[id];
+        suma += s;
+        suma2 += s * s;
+    }
+    ajuste.servicioMedio = suma / n;
+    ajuste.servicioCuadrado = suma2 / n;
+    const double varianzaServicio = std::max(0.0, ajuste.servicioCuadrado - ajuste.servicioMedio * ajuste.servicioMedio);
+    ajuste.cvServicio = ajuste.servicioMedio > 0.0 ? std::sqrt(varianzaServicio) / ajuste.servicioMedio : 0.0;
+    if (n < 2) return ajuste;
+
+    // Interllegadas en orden de llegada
+    double sumaInter = 0.0, sumaInter2 = 0.0;
+    for (size_t k = 1; k < n; ++k) {
+        const double d = static_cast<double>(carga.arrivalTime[carga.ordenLlegada[k]]) -
+                         carga.arrivalTime[carga.ordenLlegada[k - 1]];
+        sumaInter += d;
+        sumaInter2 += d * d;
+    }
+    if (sumaInter <= 0.0) return ajuste; // Todos llegan juntos: no es un proceso de llegadas
+    const double mediaInter = sumaInter / (n - 1);
+    const double varianzaInter = std::max(0.0, sumaInter2 / (n - 1) - mediaInter * mediaInter);
+    ajuste.tasaLlegada = 1.0 / mediaInter;
+    ajuste.cvLlegadas = std::sqrt(varianzaInter) / mediaInter;
+    ajuste.utilizacion = ajuste.tasaLlegada * ajuste.servicioMedio;
+    return ajuste;
+}
+
+EstimacionAnalitica estimarEspera(const CargaTrabajo& carga, const AjusteCarga& ajuste, Politica politica) {
+    EstimacionAnalitica e;
+    e.politica = politica;
+    switch (politica) {
+    case Politica::FIFO:               e.modelo = "M/G/1 FCFS (Pollaczek-Khinchine)"; break;
+    case Politica::SJF:                e.modelo = "M/G/1 no expropiativo por ráfaga (Cobham)"; break;
+    case Politica::Priority:           e.modelo = "M/G/1 no expropiativo por prioridad (Cobham)"; break;
+    case Politica::PreemptivePriority: e.modelo = "M/G/1 expropiativo por prioridad (sin aging)"; break;
+    case Politica::RoundRobin:
+    case Politica::RoundRobinAdaptativo: e.modelo = "M/G/1 processor sharing (límite de RR)"; break;
+    default:
+        e.modelo = "Sin modelo";
+        return e;
+    }
+    // --- Programación defensiva ---
+    if (carga.size() != static_cast<size_t>(ajuste.procesos)) {
+        qDebug() << "estimarEspera: el ajuste es de otra carga:" << ajuste.procesos << "procesos," << carga.size() << "en la carga.";
+        return e;
+    }
+    // --- Fin defensiva ---
+    if (!ajuste.valido()) return e;
+    e.aplicable = true;
+
+    const double lambda = ajuste.tasaLlegada;
+    const double rho = ajuste.utilizacion;
+    double espera = 0.0;
+    bool estable = rho < 1.0;
+    if (estable) {
+        switch (politica) {
+        case Politica::FIFO:
+            espera = lambda * ajuste.servicioCuadrado / (2.0 * (1.0 - rho));
+            break;
+        case Politica::SJF:
+            estable = esperaPorClases(clasesPor(carga.burstTime, carga.burstTime), lambda, false, &espera);
+            break;
+        case Politica::Priority:
+            estable = esperaPorClases(clasesPor(carga.priority, carga.burstTime), lambda, false, &espera);
+            break;
+        case Politica::PreemptivePriority:
+            estable = esperaPorClases(clasesPor(carga.priority, carga.burstTime), lambda, true, &espera);
+            break;
+        default: // Processor sharing: E[T | x] = x / (1 − ρ)
+            espera = rho * ajuste.servicioMedio / (1.0 - rho);
+            break;
+        }
+    }
+    e.estable = estable;
+    e.espera = estable ? espera : std::numeric_limits<double>::infinity();
+    e.turnaround = e.espera + ajuste.servicioMedio;
+    return e;
+}
+
+std::vector<EstimacionAnalitica> estimarPoliticas(const CargaTrabajo& carga,
+                                                  const std::vector<Politica>& politicas) {
+    const AjusteCarga ajuste = ajustarCarga(carga);
+    std::vector<EstimacionAnalitica> estimaciones;
+    estimaciones.reserve(politicas.size());
+    for (Politica politica : politicas) estimaciones.push_back(estimarEspera(carga, ajuste, politica));
+    return estimaciones;
+}
+
+bool discrepaDelModelo(const EstimacionAnalitica& estimacion, double esperaSimulada, double tolerancia) {
+    if (!estimacion.aplicable || !estimacion.estable) return false;
+    return std::fabs(esperaSimulada - estimacion.espera) > tolerancia * std::max(estimacion.espera, 1.0);
+}
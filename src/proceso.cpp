@@ -3,16 +3,17 @@
 #include <QTextStream>
 #include <QDebug>
 #include <unordered_set>
-#include <QMessageBox>
 
-std::vector<Proceso> cargarProcesosDesdeArchivo(const QString &ruta) {
+std::vector<Proceso> cargarProcesosDesdeArchivo(const QString &ruta, QStringList *erroresSalida) {
     std::vector<Proceso> procesos;
     std::unordered_set<QString> seenPIDs;
     QStringList errores;  // <-- acumulador de mensajes de error
 
     QFile archivo(ruta);
     if (!archivo.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QMessageBox::warning(nullptr, "Error", QString("No se pudo abrir el archivo:\n%1").arg(ruta));
+        if (erroresSalida) {
+            erroresSalida->append(QString("No se pudo abrir el archivo:\n%1").arg(ruta));
+        }
         return procesos;
     }
 
@@ -79,8 +80,11 @@ std::vector<Proceso> cargarProcesosDesdeArchivo(const QString &ruta) {
 
     archivo.close();
 
+    // Los errores se devuelven al llamador (la GUI decide cómo mostrarlos)
     if (!errores.isEmpty()) {
-        QMessageBox::warning(nullptr, "Errores en procesos.txt", errores.join("\n"));
+        if (erroresSalida) {
+            erroresSalida->append(errores);
+        }
         return {};
     }
 
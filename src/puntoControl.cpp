@@ -0,0 +1,163 @@
+#include "puntoControl.h"
+#include <QByteArray>
+#include <QFile>
+#include "flujoBinario.h"
+
+// simularConPuntosControl, reanudarSimulacion y simularVentana viven en
+// smp.cpp: el estado que se serializa es el del motor de simularMulticore
+
+// Cabecera del archivo: firma + versión del formato. Desde la versión 2 los
+// puntos van uno tras otro hasta el final (sin cantidad al frente), así
+// ArchivoPuntosControl puede agregarlos a medida que se toman
+static const char FIRMA_PUNTOS_CONTROL[] = "PCSMP";
+static const uint64_t VERSION_ARCHIVO = 2;
+
+static void escribirCabecera(escritorBinario &salida) {
+    for (const char *c = FIRMA_PUNTOS_CONTROL; *c; ++c) {
+        salida.natural(static_cast<uint8_t>(*c));
+    }
+    salida.natural(VERSION_ARCHIVO);
+}
+
+// Un punto: tiempo, eventos, bloquesPrevios, delta de bloques (pid en UTF-8,
+// inicio, duración, núcleo, tipo) y el estado serializado
+static void escribirPunto(escritorBinario &salida, const PuntoControl &punto) {
+    salida.entero(punto.tiempo);
+    salida.entero(punto.eventos);
+    salida.natural(punto.bloquesPrevios);
+    salida.natural(punto.bloquesNuevos.size());
+    for (const BloqueGantt &bloque : punto.bloquesNuevos) {
+        const QByteArray pid = bloque.pid.toUtf8();
+        salida.bytes(std::vector<uint8_t>(pid.constData(), pid.constData() + pid.size()));
+        salida.entero(bloque.inicio);
+        salida.entero(bloque.duracion);
+        salida.entero(bloque.cpu);
+        salida.natural(static_cast<uint64_t>(bloque.tipo));
+    }
+    salida.bytes(punto.datos);
+}
+
+// false si el punto está truncado o dañado
+static bool leerPunto(lectorBinario &entrada, PuntoControl &punto) {
+    entrada.campo(punto.tiempo);
+    entrada.campo(punto.eventos);
+    entrada.campo(punto.bloquesPrevios);
+    // Cada bloque ocupa al menos 5 bytes: un largo imposible no reserva memoria
+    const uint64_t cantidad = entrada.natural();
+    if (!entrada.ok() || cantidad > entrada.restantes() / 5) return false;
+    punto.bloquesNuevos.resize(cantidad);
+    std::vector<uint8_t> pid;
+    for (BloqueGantt &bloque : punto.bloquesNuevos) {
+        entrada.bytes(pid);
+        bloque.pid = QString::fromUtf8(reinterpret_cast<const char *>(pid.data()), static_cast<int>(pid.size()));
+        entrada.campo(bloque.inicio);
+        entrada.campo(bloque.duracion);
+        entrada.campo(bloque.cpu);
+        const uint64_t tipo = entrada.natural();
+        if (tipo > static_cast<uint64_t>(TipoBloque::CambioContexto)) return false;
+        bloque.tipo = static_cast<TipoBloque>(tipo);
+    }
+    entrada.bytes(punto.datos);
+    return entrada.ok();
+}
+
+bool guardarPuntosControl(const QString &ruta, const std::vector<PuntoControl> &puntos, QStringList *errores) {
+    escritorBinario salida;
+    escribirCabecera(salida);
+    for (const PuntoControl &punto : puntos) {
+        escribirPunto(salida, punto);
+    }
+
+    QFile archivo(ruta);
+    if (!archivo.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        if (errores) {
+            errores->append(QString("No se pudo abrir el archivo:\n%1").arg(ruta));
+        }
+        return false;
+    }
+    const std::vector<uint8_t> &datos = salida.datos();
+    const qint64 escritos = archivo.write(reinterpret_cast<const char *>(datos.data()),
+                                          static_cast<qint64>(datos.size()));
+    archivo.close();
+    if (escritos != static_cast<qint64>(datos.size())) {
+        if (errores) {
+            errores->append(QString("No se pudo escribir el archivo de puntos de control:\n%1").arg(ruta));
+        }
+        return false;
+    }
+    return true;
+}
+
+ArchivoPuntosControl::ArchivoPuntosControl(const QString &ruta, QStringList *errores)
+    : archivo(ruta), errores(errores) {
+    if (!archivo.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        if (errores) {
+            errores->append(QString("No se pudo abrir el archivo:\n%1").arg(ruta));
+        }
+        return;
+    }
+    escritorBinario cabecera;
+    escribirCabecera(cabecera);
+    const std::vector<uint8_t> &datos = cabecera.datos();
+    valido = archivo.write(reinterpret_cast<const char *>(datos.data()), static_cast<qint64>(datos.size())) ==
+                 static_cast<qint64>(datos.size()) &&
+             archivo.flush();
+    if (!valido && errores) {
+        errores->append(QString("No se pudo escribir el archivo de puntos de control:\n%1").arg(ruta));
+    }
+}
+
+void ArchivoPuntosControl::puntoTomado(const PuntoControl &punto) {
+    if (!valido) return;
+    // El punto entero en una sola escritura + flush: una caída deja a lo sumo
+    // el último a medias, que cargarPuntosControl descarta
+    escritorBinario salida;
+    escribirPunto(salida, punto);
+    const std::vector<uint8_t> &datos = salida.datos();
+    valido = archivo.write(reinterpret_cast<const char *>(datos.data()), static_cast<qint64>(datos.size())) ==
+                 static_cast<qint64>(datos.size()) &&
+             archivo.flush();
+    if (!valido && errores) {
+        errores->append(QString("No se pudo escribir el punto de control del ciclo %1").arg(punto.tiempo));
+    }
+}
+
+std::vector<PuntoControl> cargarPuntosControl(const QString &ruta, QStringList *errores) {
+    QFile archivo(ruta);
+    if (!archivo.open(QIODevice::ReadOnly)) {
+        if (errores) {
+            errores->append(QString("No se pudo abrir el archivo:\n%1").arg(ruta));
+        }
+        return {};
+    }
+    const QByteArray contenido = archivo.readAll();
+    archivo.close();
+
+    lectorBinario entrada(reinterpret_cast<const uint8_t *>(contenido.constData()),
+                          static_cast<size_t>(contenido.size()));
+    bool firmaValida = true;
+    for (const char *c = FIRMA_PUNTOS_CONTROL; *c; ++c) {
+        firmaValida = firmaValida && entrada.natural() == static_cast<uint8_t>(*c);
+    }
+    if (!firmaValida || entrada.natural() != VERSION_ARCHIVO) {
+        if (errores) {
+            errores->append(QString("El archivo no es de puntos de control (o es de otra versión):\n%1").arg(ruta));
+        }
+        return {};
+    }
+
+    std::vector<PuntoControl> puntos;
+    while (!entrada.alFinal()) {
+        PuntoControl punto;
+        if (!leerPunto(entrada, punto)) {
+            if (errores) {
+                errores->append(QString("Punto de control final incompleto (descartado; quedan %1):\n%2")
+                                    .arg(puntos.size())
+                                    .arg(ruta));
+            }
+            break;
+        }
+        puntos.push_back(std::move(punto));
+    }
+    return puntos;
+}
@@ -0,0 +1,258 @@
+#include "replicacion.h"
+#include <QDebug>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include "carga.h"
+#include "comparacion.h"
+#include "poolHilos.h"
+
+namespace {
+
+using ValoresMetricas = std::array<double, NUM_METRICAS_REPLICACION>;
+
+const double PI = 3.14159265358979323846;
+
+uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Uniforme en [0, 1) con 53 bits; las transformaciones son propias para que
+// la réplica no dependa de la implementación de <random> de cada compilador
+double uniforme(std::mt19937_64& generador) {
+    return static_cast<double>(generador() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+double factorPerturbacion(std::mt19937_64& generador, DistribucionPerturbacion distribucion, double variacion) {
+    if (variacion <= 0.0) return 1.0;
+    switch (distribucion) {
+    case DistribucionPerturbacion::Uniforme: {
+        const double ancho = variacion * std::sqrt(3.0);
+        return std::max(0.0, 1.0 + ancho * (2.0 * uniforme(generador) - 1.0));
+    }
+    case DistribucionPerturbacion::Lognormal: {
+        // Box-Muller; media exp(mu + sigma²/2) = 1
+        const double u1 = 1.0 - uniforme(generador);
+        const double u2 = uniforme(generador);
+        const double z = std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * PI * u2);
+        const double sigma2 = std::log(1.0 + variacion * variacion);
+        return std::exp(-sigma2 / 2.0 + std::sqrt(sigma2) * z);
+    }
+    case DistribucionPerturbacion::Exponencial:
+        return -std::log(1.0 - uniforme(generador));
+    }
+    return 1.0;
+}
+
+int acotarInt(long long v) {
+    return static_cast<int>(std::min<long long>(v, INT_MAX));
+}
+
+ValoresMetricas valoresMetricas(const ResultadoComparacion& r) {
+    ValoresMetricas valores{};
+    auto v = [&](MetricaReplicacion m) -> double& { return valores[static_cast<int>(m)]; };
+    const MetricasEjecucion& m = r.metricas;
+    v(MetricaReplicacion::EsperaPromedio) = m.espera.promedio;
+    v(MetricaReplicacion::EsperaP50) = static_cast<double>(m.espera.p50);
+    v(MetricaReplicacion::EsperaP90) = static_cast<double>(m.espera.p90);
+    v(MetricaReplicacion::EsperaP99) = static_cast<double>(m.espera.p99);
+    v(MetricaReplicacion::EsperaMaxima) = static_cast<double>(m.espera.maximo);
+    v(MetricaReplicacion::TurnaroundPromedio) = m.turnaround.promedio;
+    v(MetricaReplicacion::TurnaroundP90) = static_cast<double>(m.turnaround.p90);
+    v(MetricaReplicacion::TurnaroundP99) = static_cast<double>(m.turnaround.p99);
+    v(MetricaReplicacion::RespuestaPromedio) = m.respuesta.promedio;
+    v(MetricaReplicacion::RespuestaP90) = static_cast<double>(m.respuesta.p90);
+    v(MetricaReplicacion::RespuestaP99) = static_cast<double>(m.respuesta.p99);
+    v(MetricaReplicacion::Makespan) = static_cast<double>(m.makespan);
+    v(MetricaReplicacion::Throughput) = r.throughput;
+    v(MetricaReplicacion::UtilizacionCPU) = r.utilizacionCPU;
+    v(MetricaReplicacion::IndiceJain) = m.indiceJain;
+    v(MetricaReplicacion::DesviacionCuota) = r.desviacionCuotaPromedio;
+    v(MetricaReplicacion::CambiosContexto) = r.cambiosContexto;
+    v(MetricaReplicacion::CiclosCambio) = static_cast<double>(r.ciclosCambio);
+    return valores;
+}
+
+// Cuantil de la normal estándar (Acklam, error relativo < 1.2e-9)
+double cuantilNormal(double p) {
+    static const double a[] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                                1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+    static const double b[] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                                6.680131188771972e+01, -1.328068155288572e+01 };
+    static const double c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                                -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+    static const double d[] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                                3.754408661907416e+00 };
+    const double bajo = 0.02425;
+    if (p < bajo || p > 1.0 - bajo) {
+        const double q = std::sqrt(-2.0 * std::log(p < bajo ? p : 1.0 - p));
+        const double x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+                         ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+        return p < bajo ? x : -x;
+    }
+    const double q = p - 0.5;
+    const double r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+           (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+}
+
+} // namespace
+
+QString nombreMetrica(MetricaReplicacion metrica) {
+    switch (metrica) {
+    case MetricaReplicacion::EsperaPromedio:     return "Espera promedio";
+    case MetricaReplicacion::EsperaP50:          return "Espera p50";
+    case MetricaReplicacion::EsperaP90:          return "Espera p90";
+    case MetricaReplicacion::EsperaP99:          return "Espera p99";
+    case MetricaReplicacion::EsperaMaxima:       return "Espera máxima";
+    case MetricaReplicacion::TurnaroundPromedio: return "Turnaround promedio";
+    case MetricaReplicacion::TurnaroundP90:      return "Turnaround p90";
+    case MetricaReplicacion::TurnaroundP99:      return "Turnaround p99";
+    case MetricaReplicacion::RespuestaPromedio:  return "Respuesta promedio";
+    case MetricaReplicacion::RespuestaP90:       return "Respuesta p90";
+    case MetricaReplicacion::RespuestaP99:       return "Respuesta p99";
+    case MetricaReplicacion::Makespan:           return "Makespan";
+    case MetricaReplicacion::Throughput:         return "Throughput";
+    case MetricaReplicacion::UtilizacionCPU:     return "Utilización CPU";
+    case MetricaReplicacion::IndiceJain:         return "Índice de Jain";
+    case MetricaReplicacion::DesviacionCuota:    return "Desviación de cuota";
+    case MetricaReplicacion::CambiosContexto:    return "Cambios de contexto";
+    case MetricaReplicacion::CiclosCambio:       return "Ciclos de cambio";
+    }
+    return "";
+}
+
+uint64_t semillaReplica(uint64_t semilla, int replica) {
+    return splitmix64(splitmix64(semilla) + static_cast<uint64_t>(replica));
+}
+
+double cuantilStudent(double p, int gradosLibertad) {
+    // --- Programación defensiva ---
+    if (!(p > 0.0 && p < 1.0) || gradosLibertad < 1) {
+        qDebug() << "cuantilStudent: parámetros inválidos:" << p << gradosLibertad;
+        return 0.0;
+    }
+    // --- Fin defensiva ---
+    if (gradosLibertad == 1) return std::tan(PI * (p - 0.5));
+    if (gradosLibertad == 2) return (2.0 * p - 1.0) / std::sqrt(2.0 * p * (1.0 - p));
+
+    // Abramowitz y Stegun 26.7.5
+    const double z = cuantilNormal(p);
+    const double z2 = z * z;
+    const double nu = gradosLibertad;
+    const double g1 = (z2 + 1.0) * z / 4.0;
+    const double g2 = ((5.0 * z2 + 16.0) * z2 + 3.0) * z / 96.0;
+    const double g3 = (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) * z / 384.0;
+    const double g4 = ((((79.0 * z2 + 776.0) * z2 + 1482.0) * z2 - 1920.0) * z2 - 945.0) * z / 92160.0;
+    return z + g1 / nu + g2 / (nu * nu) + g3 / (nu * nu * nu) + g4 / (nu * nu * nu * nu);
+}
+
+std::vector<Proceso> perturbarProcesos(const std::vector<Proceso>& procesos,
+                                       const ConfigReplicacion& config,
+                                       int replica)
+{
+    std::vector<Proceso> perturbados(procesos);
+    std::mt19937_64 generador(semillaReplica(config.semilla, replica));
+
+    // Interllegadas en orden de llegada (estable), acumuladas desde 0
+    std::vector<size_t> orden(procesos.size());
+    std::iota(orden.begin(), orden.end(), 0);
+    std::stable_sort(orden.begin(), orden.end(), [&](size_t a, size_t b) {
+        return procesos[a].arrivalTime < procesos[b].arrivalTime;
+    });
+    long long llegadaOriginal = 0, llegada = 0;
+    for (size_t k : orden) {
+        const long long hueco = procesos[k].arrivalTime - llegadaOriginal;
+        if (hueco > 0) {
+            llegada += std::llround(hueco * factorPerturbacion(generador, config.distribucion, config.variacionLlegada));
+        }
+        llegadaOriginal = procesos[k].arrivalTime;
+        perturbados[k].arrivalTime = acotarInt(llegada);
+    }
+
+    for (Proceso& p : perturbados) {
+        const double factor = factorPerturbacion(generador, config.distribucion, config.variacionRafaga);
+        p.burstTime = acotarInt(std::max(1LL, std::llround(p.burstTime * factor)));
+    }
+    return perturbados;
+}
+
+std::vector<ResumenReplicacion> replicarPoliticas(const std::vector<Proceso>& procesos,
+                                                  const std::vector<Politica>& politicas,
+                                                  const ParametrosPolitica& parametros,
+                                                  const ConfigSMP& configMotor,
+                                                  const ConfigReplicacion& config)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesos, "replicarPoliticas")) return {};
+    if (politicas.empty()) {
+        qDebug() << "replicarPoliticas: no hay políticas para replicar.";
+        return {};
+    }
+    if (config.replicas < 2) {
+        qDebug() << "replicarPoliticas: se necesitan al menos 2 réplicas para un intervalo:" << config.replicas;
+        return {};
+    }
+    if (!(config.variacionLlegada >= 0.0) || !(config.variacionRafaga >= 0.0) ||
+        !std::isfinite(config.variacionLlegada) || !std::isfinite(config.variacionRafaga)) {
+        qDebug() << "replicarPoliticas: variación inválida:" << config.variacionLlegada << config.variacionRafaga;
+        return {};
+    }
+    if (!(config.confianza > 0.0 && config.confianza < 1.0)) {
+        qDebug() << "replicarPoliticas: nivel de confianza fuera de (0, 1):" << config.confianza;
+        return {};
+    }
+    // --- Fin defensiva ---
+
+    const size_t R = static_cast<size_t>(config.replicas);
+    const size_t P = politicas.size();
+    // Cada réplica escribe solo su fila: valores[r][p]
+    std::vector<std::vector<ValoresMetricas>> valores(R, std::vector<ValoresMetricas>(P));
+    std::vector<std::vector<char>> ejecutado(R, std::vector<char>(P, 0));
+
+    ejecutarEnParalelo(R, config.hilos, [&](size_t r) {
+        const int replica = static_cast<int>(r);
+        const CargaComparacion carga = prepararComparacion(perturbarProcesos(procesos, config, replica));
+        ParametrosPolitica parametrosReplica = parametros;
+        // Lottery sortea con una secuencia propia de la réplica, distinta de la de la carga
+        parametrosReplica.semillaLoteria = semillaReplica(parametros.semillaLoteria ^ 0x4C4F54455259ULL, replica);
+        for (size_t p = 0; p < P; ++p) {
+            const ResultadoComparacion resultado =
+                ejecutarComparacion(carga, politicas[p], parametrosReplica, configMotor);
+            ejecutado[r][p] = resultado.ejecutado;
+            if (resultado.ejecutado) valores[r][p] = valoresMetricas(resultado);
+        }
+    });
+
+    // Reducción en orden de réplica: misma suma en punto flotante con cualquier número de hilos
+    std::vector<ResumenReplicacion> resumenes(P);
+    for (size_t p = 0; p < P; ++p) {
+        ResumenReplicacion& resumen = resumenes[p];
+        resumen.politica = politicas[p];
+        for (size_t r = 0; r < R; ++r) resumen.replicas += ejecutado[r][p];
+        if (resumen.replicas == 0) continue;
+        const double t = resumen.replicas >= 2
+            ? cuantilStudent(0.5 + config.confianza / 2.0, resumen.replicas - 1) : 0.0;
+        for (int m = 0; m < NUM_METRICAS_REPLICACION; ++m) {
+            double suma = 0.0;
+            for (size_t r = 0; r < R; ++r) {
+                if (ejecutado[r][p]) suma += valores[r][p][m];
+            }
+            const double media = suma / resumen.replicas;
+            double sumaCuadrados = 0.0;
+            for (size_t r = 0; r < R; ++r) {
+                if (ejecutado[r][p]) sumaCuadrados += (valores[r][p][m] - media) * (valores[r][p][m] - media);
+            }
+            IntervaloConfianza& ic = resumen.metricas[m];
+            ic.media = media;
+            ic.desviacion = resumen.replicas >= 2 ? std::sqrt(sumaCuadrados / (resumen.replicas - 1)) : 0.0;
+            ic.semiancho = t * ic.desviacion / std::sqrt(static_cast<double>(resumen.replicas));
+        }
+    }
+    return resumenes;
+}
@@ -0,0 +1,1257 @@
+#include "smp.h"
+#include "entradaSalida.h"
+#include <QDebug>
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <random>
+#include <utility>
+#include "algoritmo.h"
+#include "arbolFenwick.h"
+#include "carga.h"
+#include "colaBuckets.h"
+#include "kernelsMetricas.h"
+#include "metricas.h"
+#include "priorityQueue.h"
+#include "percentilDinamico.h"
+#include "puntoControl.h"
+#include "flujoBinario.h"
+#include "planificador.h"
+
+namespace {
+
+// Clave de las colas ready: (primaria, secundaria), menor = antes; a igual
+// clave el id menor. La secundaria suele ser una secuencia de encolado para
+// que los empates salgan en orden FIFO.
+using ClaveSMP = std::pair<int64_t, int64_t>;
+using ColaSMP = priorityQueue<ClaveSMP>;
+
+// Estado de un núcleo
+struct Nucleo {
+    uint32_t actual = 0;
+    bool hayActual = false;
+    bool reencolar = false; // Agotó quantum/slice: vuelve a la cola tras las llegadas
+    int tickActual = 0;     // Ciclos del bloque de Gantt abierto
+    int usado = 0;          // Ciclos del quantum/slice en curso
+    int limite = INT_MAX;   // Largo del quantum/slice en curso
+    int64_t pesoTotal = 0;  // CFS: pesos en cola + actual
+    int64_t minVruntime = 0;
+    int ultimo = -1;        // Último id despachado (-1: el núcleo aún no despachó)
+    int cambioRestante = 0; // Ciclos del cambio de contexto en curso
+    int tickCambio = 0;     // Ciclos del bloque de cambio de contexto abierto
+};
+
+// CFS y Stride ordenan por tiempo virtual ponderado por peso/tickets
+bool usaVruntime(Politica politica) {
+    return politica == Politica::CFS || politica == Politica::Stride;
+}
+
+bool esExpropiativa(Politica politica) {
+    return politica == Politica::SRT || politica == Politica::PreemptivePriority ||
+           politica == Politica::MLFQ;
+}
+
+// Estado de un dispositivo de E/S: su cola (clave según la disciplina) y la
+// ráfaga en servicio
+struct DispositivoActivo {
+    ColaSMP cola;
+    uint32_t actual = 0;
+    bool ocupado = false;
+    int fin = 0;
+    long long esperaTotal = 0;
+
+    explicit DispositivoActivo(size_t capacidad) : cola(capacidad) {}
+};
+
+// Ráfagas de E/S de simularConES (nullptr en simularMulticore: una ráfaga por proceso)
+struct EntradaSalidaMotor {
+    const std::vector<PerfilES>* perfiles;
+    const std::vector<Dispositivo>* dispositivos;
+    ResultadoES* salida;
+};
+
+// Puntos de control (puntoControl.h); nullptr en las corridas comunes
+struct PuntosControlMotor {
+    long long cadaEventos = 0;                   // 0 = no guardar
+    SumideroPuntosControl* salida = nullptr;
+    const PuntoControl* desde = nullptr;         // Reanudar desde este punto
+    int hastaTiempo = -1;                        // Cortar al llegar a este ciclo (-1 = hasta el final)
+};
+
+// Sumidero de las variantes que devuelven los puntos en un vector
+class VectorPuntosControl : public SumideroPuntosControl {
+public:
+    explicit VectorPuntosControl(std::vector<PuntoControl>* puntos) : puntos(puntos) {}
+    void puntoTomado(const PuntoControl& punto) override { puntos->push_back(punto); }
+
+private:
+    std::vector<PuntoControl>* puntos;
+};
+
+constexpr uint64_t VERSION_PUNTO_CONTROL = 1;
+
+// FNV-1a sobre los datos de entrada: un punto de control solo se restaura
+// sobre la misma carga
+uint64_t huellaCarga(const CargaTrabajo& carga) {
+    uint64_t huella = 1469598103934665603ULL;
+    auto mezclar = [&](uint64_t v) {
+        huella ^= v;
+        huella *= 1099511628211ULL;
+    };
+    mezclar(carga.size());
+    for (size_t id = 0; id < carga.size(); ++id) {
+        mezclar(static_cast<uint64_t>(carga.arrivalTime[id]));
+        mezclar(static_cast<uint64_t>(carga.burstTime[id]));
+        mezclar(static_cast<uint64_t>(carga.priority[id]));
+    }
+    return huella;
+}
+
+// Motor de simularMulticore y simularConES como máquina de estados: cada
+// paso() atiende un instante (llegadas, E/S, expropiaciones, despachos) y
+// avanza los núcleos hasta el siguiente evento. simularMotor lo corre de una
+// vez; el Planificador (planificador.h) lo avanza a pedido.
+class MotorSMP {
+public:
+    enum class Paso {
+        Sigue,  // Quedan eventos
+        Fin,    // Terminaron todos los procesos
+        Corte   // pc->hastaTiempo (o nada más que simular): finalizar() no da métricas
+    };
+
+    // `eventosSalida` (opcional) recibe los eventos de cada paso
+    MotorSMP(const CargaTrabajo& carga,
+             Politica politica,
+             const ParametrosPolitica& parametros,
+             const ConfigSMP& config,
+             ObservadorSimulacion* obs,
+             EntradaSalidaMotor* es,
+             PuntosControlMotor* pc,
+             std::vector<EventoSimulacion>* eventosSalida = nullptr)
+        : carga(carga), politica(politica), parametros(parametros), config(config),
+          obs(obs), es(es), pc(pc), eventosSalida(eventosSalida),
+          n(carga.size()), numCPUs(config.numCPUs),
+          envejecimiento(politica == Politica::PreemptivePriority ? parametros.envejecimiento : 0),
+          periodoBoost(politica == Politica::MLFQ ? parametros.periodoBoost : 0),
+          nivelMaximo(static_cast<int>(parametros.quantumPorNivel.size()) - 1),
+          adaptativo(politica == Politica::RoundRobinAdaptativo),
+          vencimientos(carga.size()),
+          generador(parametros.semillaLoteria)
+    {
+        if (!configuracionValida()) return;
+
+        // Estado por proceso en arreglos planos indexados por id
+        tiempoRestante = carga.burstTime;
+        rafagaCPU = carga.burstTime;
+        rafaga.assign(n, 0);
+        ciclosES.assign(n, 0);
+        encoladoES.assign(n, 0);
+        if (es) {
+            for (uint32_t id = 0; id < n; ++id) {
+                rafagaCPU[id] = tiempoRestante[id] = (*es->perfiles)[id].rafagasCPU[0];
+            }
+        }
+        primeraEjecucion.assign(n, -1);
+        ultimaEjecucion.assign(n, 0);
+        cpuAnterior.assign(n, -1);
+        // Preemptive Priority envejece por rangos densos, como en algoritmo.h
+        base = politica == Politica::PreemptivePriority ? rangosPrioridad(carga) : carga.priority;
+        efectiva = base;
+        nivel.assign(n, 0);
+        epocaNivel.assign(n, 0);
+        vruntime.assign(n, 0);
+        peso.assign(n, 1);
+        if (usaVruntime(politica) || politica == Politica::Lottery) {
+            for (uint32_t id = 0; id < n; ++id) peso[id] = pesoPorPrioridad(carga.priority[id]);
+        }
+
+        // MLFQ usa una colaBuckets por núcleo (boost O(niveles)); el resto, el heap
+        if (politica == Politica::MLFQ) {
+            for (int c = 0; c < numCPUs; ++c) buckets.emplace_back(nivelMaximo + 1, n);
+        } else {
+            colas.reserve(numCPUs);
+            for (int c = 0; c < numCPUs; ++c) colas.emplace_back(n);
+        }
+        if (politica == Politica::Lottery) {
+            for (int c = 0; c < numCPUs; ++c) tickets.emplace_back(n);
+        }
+        nucleos.assign(numCPUs, Nucleo());
+        cpuDe.assign(n, -1);
+        if (adaptativo) {
+            for (int c = 0; c < numCPUs; ++c) restantesEnCola.emplace_back(parametros.percentilQuantum, n);
+        }
+
+        resultado.cpus.assign(numCPUs, EstadisticasCPU());
+
+        if (es) {
+            dispositivosActivos.reserve(es->dispositivos->size());
+            for (const Dispositivo& dispositivo : *es->dispositivos) {
+                dispositivosActivos.emplace_back(n);
+                EstadisticasDispositivo est;
+                est.nombre = dispositivo.nombre;
+                es->salida->dispositivos.push_back(est);
+            }
+        }
+
+        proximoBoost = periodoBoost > 0 ? periodoBoost : -1;
+        huella = pc ? huellaCarga(carga) : 0;
+        bloquesBase = pc && pc->desde ? pc->desde->bloquesPrevios : 0;
+        if (pc && pc->desde) {
+            if (!restaurarPunto(*pc->desde)) {
+                qDebug() << "reanudarSimulacion: punto de control dañado o de otra carga, política o número de CPUs.";
+                return;
+            }
+            eventos = pc->desde->eventos;
+        }
+        eventosInicio = eventos;
+        listo = true;
+    }
+
+    // false si la carga o la configuración son inválidas (ya reportado)
+    bool valido() const { return listo; }
+    int tiempoActual() const { return tiempo; }
+
+    Paso paso() {
+        if (terminados >= n) return Paso::Fin;
+
+        // 0) Entre dos eventos: punto de control o corte de la ventana
+        if (pc) {
+            if (pc->hastaTiempo >= 0 && tiempo >= pc->hastaTiempo) return Paso::Corte;
+            if (pc->cadaEventos > 0 && eventos > eventosInicio && eventos % pc->cadaEventos == 0) {
+                guardarPunto();
+            }
+        }
+        eventos++;
+
+        // 1) Llegadas: al núcleo menos cargado (a igualdad, el de menor índice)
+        while (i < n && carga.arrivalTime[carga.ordenLlegada[i]] <= tiempo) {
+            uint32_t id = carga.ordenLlegada[i];
+            int destino = nucleoMenosCargado();
+            if (usaVruntime(politica)) {
+                vruntime[id] = nucleos[destino].minVruntime;
+                nucleos[destino].pesoTotal += peso[id];
+            }
+            efectiva[id] = base[id];
+            fijarNivel(id, 0);
+            encolar(destino, id, tiempo);
+            emitir(TipoEvento::Llegada, id, destino, tiempo);
+            i++;
+        }
+
+        // 1b) Fin de E/S: el proceso vuelve a la política como una llegada,
+        //     con su siguiente ráfaga de CPU y sin perder su nivel (MLFQ) ni
+        //     su vruntime (CFS/Stride, nunca por debajo del mínimo del núcleo)
+        for (size_t d = 0; d < dispositivosActivos.size(); ++d) {
+            DispositivoActivo& dev = dispositivosActivos[d];
+            if (!dev.ocupado || dev.fin > tiempo) continue;
+            const uint32_t id = dev.actual;
+            dev.ocupado = false;
+            rafaga[id]++;
+            rafagaCPU[id] = tiempoRestante[id] = (*es->perfiles)[id].rafagasCPU[rafaga[id]];
+            int destino = nucleoMenosCargado();
+            if (usaVruntime(politica)) {
+                int origen = cpuAnterior[id] >= 0 ? cpuAnterior[id] : destino;
+                vruntime[id] = std::max(vruntime[id] - nucleos[origen].minVruntime + nucleos[destino].minVruntime,
+                                        nucleos[destino].minVruntime);
+                nucleos[destino].pesoTotal += peso[id];
+            }
+            efectiva[id] = base[id];
+            encolar(destino, id, tiempo);
+        }
+
+        // 1c) Cada dispositivo libre atiende al primero de su cola
+        for (size_t d = 0; d < dispositivosActivos.size(); ++d) {
+            DispositivoActivo& dev = dispositivosActivos[d];
+            if (dev.ocupado || dev.cola.isEmpty()) continue;
+            const uint32_t id = dev.cola.pop().id;
+            const int duracion = (*es->perfiles)[id].rafagasES[rafaga[id]].duracion;
+            dev.actual = id;
+            dev.ocupado = true;
+            dev.fin = tiempo + duracion;
+            dev.esperaTotal += tiempo - encoladoES[id];
+            ciclosES[id] += duracion;
+            EstadisticasDispositivo& est = es->salida->dispositivos[d];
+            est.ciclosOcupado += duracion;
+            est.atendidas++;
+            if (!config.soloAgregados) {
+                es->salida->bloquesES.push_back({carga.pids[id], tiempo, duracion, static_cast<int>(d)});
+            }
+            if (obs) {
+                obs->tramoEntradaSalida(static_cast<int>(d), carga.pids[id], tiempo, duracion);
+            }
+        }
+
+        // 2) Quien agotó su quantum/slice vuelve a su cola detrás de las llegadas
+        for (int c = 0; c < numCPUs; ++c) {
+            Nucleo& nc = nucleos[c];
+            if (nc.reencolar) {
+                encolar(c, nc.actual, tiempo);
+                nc.hayActual = false;
+                nc.reencolar = false;
+            }
+        }
+
+        // 3) Aging (Preemptive Priority): sube un nivel al final del nuevo bucket
+        while (!vencimientos.isEmpty() && vencimientos.top().clave <= tiempo) {
+            auto venc = vencimientos.pop();
+            efectiva[venc.id]--;
+            colas[cpuDe[venc.id]].decreaseKey(venc.id, {efectiva[venc.id], secuencia++});
+            if (efectiva[venc.id] > 0) {
+                vencimientos.insertNewValue(venc.id, venc.clave + envejecimiento);
+            }
+        }
+
+        // 4) Boost (MLFQ): todos al nivel 0 respetando el orden actual de cada
+        //    cola. Los niveles se anulan con una nueva época, sin recorrer los ids
+        if (proximoBoost >= 0 && proximoBoost <= tiempo) {
+            epocaBoost++;
+            for (int c = 0; c < numCPUs; ++c) {
+                buckets[c].promoverTodos(0);
+                if (nucleos[c].hayActual) {
+                    nucleos[c].usado = 0;
+                    nucleos[c].limite = parametros.quantumPorNivel[0];
+                }
+            }
+            proximoBoost += ((tiempo - proximoBoost) / periodoBoost + 1) * periodoBoost;
+        }
+
+        // 5) Preempción en cada núcleo
+        if (esExpropiativa(politica)) {
+            for (int c = 0; c < numCPUs; ++c) {
+                if (!debeExpropiar(c)) continue;
+                Nucleo& nc = nucleos[c];
+                cerrarBloque(c, tiempo);
+                cerrarCambio(c, tiempo); // Expropiado mientras cargaba su contexto
+                efectiva[nc.actual] = base[nc.actual];
+                encolar(c, nc.actual, tiempo);
+                emitir(TipoEvento::Expropiacion, nc.actual, c, tiempo);
+                nc.hayActual = false;
+            }
+        }
+
+        // 6) Despacho desde la cola propia
+        for (int c = 0; c < numCPUs; ++c) {
+            if (!nucleos[c].hayActual && tamCola(c) > 0) {
+                despachar(c, sacar(c), tiempo);
+            }
+        }
+
+        // 7) Robo de trabajo: un núcleo ocioso toma el siguiente de la cola más larga
+        if (config.robarTrabajo && numCPUs > 1) {
+            for (int c = 0; c < numCPUs; ++c) {
+                if (nucleos[c].hayActual) continue;
+                int victima = -1;
+                for (int v = 0; v < numCPUs; ++v) {
+                    if (v != c && tamCola(v) > 0 && (victima < 0 || tamCola(v) > tamCola(victima))) {
+                        victima = v;
+                    }
+                }
+                if (victima < 0) break; // No queda nada en espera
+                uint32_t id = sacar(victima);
+                migrar(id, victima, c);
+                despachar(c, id, tiempo);
+            }
+        }
+
+        // 8) Siguiente evento: fin de ráfaga, de quantum o de cambio de
+        //    contexto en algún núcleo, llegada, fin de E/S, aging o boost
+        int proximoFinES = INT_MAX;
+        for (const DispositivoActivo& dev : dispositivosActivos) {
+            if (dev.ocupado) proximoFinES = std::min(proximoFinES, dev.fin);
+        }
+        int avance = INT_MAX;
+        bool algunoOcupado = false;
+        for (const Nucleo& nc : nucleos) {
+            if (!nc.hayActual) continue;
+            algunoOcupado = true;
+            if (nc.cambioRestante > 0) {
+                avance = std::min(avance, nc.cambioRestante);
+            } else {
+                avance = std::min(avance, std::min(tiempoRestante[nc.actual], nc.limite - nc.usado));
+            }
+        }
+        if (!algunoOcupado) {
+            // Todo ocioso: saltar a la siguiente llegada o fin de E/S
+            int siguiente = proximoFinES;
+            if (i < n) siguiente = std::min(siguiente, carga.arrivalTime[carga.ordenLlegada[i]]);
+            if (siguiente == INT_MAX) return Paso::Corte;
+            tiempo = siguiente;
+            return Paso::Sigue;
+        }
+        if (i < n) avance = std::min(avance, carga.arrivalTime[carga.ordenLlegada[i]] - tiempo);
+        if (proximoFinES != INT_MAX) avance = std::min(avance, proximoFinES - tiempo);
+        if (!vencimientos.isEmpty()) avance = std::min(avance, vencimientos.top().clave - tiempo);
+        if (proximoBoost >= 0) avance = std::min(avance, proximoBoost - tiempo);
+        if (pc && pc->hastaTiempo >= 0) avance = std::min(avance, pc->hastaTiempo - tiempo);
+
+        // 9) Avanzar todos los núcleos ocupados
+        const int inicio = tiempo;
+        tiempo += avance;
+        for (int c = 0; c < numCPUs; ++c) {
+            Nucleo& nc = nucleos[c];
+            if (!nc.hayActual) continue;
+            const uint32_t id = nc.actual;
+            if (nc.cambioRestante > 0) {
+                // Ciclos perdidos: ni el proceso ni su quantum avanzan
+                if (obs) {
+                    obs->cambioDeContexto(c, carga.pids[id], inicio, avance);
+                }
+                nc.cambioRestante -= avance;
+                nc.tickCambio += avance;
+                resultado.ciclosCambio += avance;
+                if (nc.cambioRestante == 0) {
+                    cerrarCambio(c, tiempo);
+                }
+                continue;
+            }
+            if (obs) {
+                obs->tramoEjecutadoEnCPU(c, carga.pids[id], inicio, avance);
+            }
+            cpuAnterior[id] = c;
+            tiempoRestante[id] -= avance;
+            nc.tickActual += avance;
+            nc.usado += avance;
+            resultado.cpus[c].ciclosOcupado += avance;
+
+            if (usaVruntime(politica)) {
+                vruntime[id] += avance * ESCALA_VRUNTIME / peso[id];
+                int64_t candidato = vruntime[id];
+                if (!colas[c].isEmpty() && colas[c].top().clave.first < candidato) {
+                    candidato = colas[c].top().clave.first;
+                }
+                nc.minVruntime = std::max(nc.minVruntime, candidato);
+            }
+
+            if (tiempoRestante[id] == 0 && es &&
+                rafaga[id] < static_cast<int>((*es->perfiles)[id].rafagasES.size())) {
+                // Fin de ráfaga de CPU con E/S pendiente: a la cola del dispositivo
+                const int d = (*es->perfiles)[id].rafagasES[rafaga[id]].dispositivo;
+                const bool porPrioridad = (*es->dispositivos)[d].disciplina == DisciplinaES::Prioridad;
+                cerrarBloque(c, tiempo);
+                nc.pesoTotal -= peso[id];
+                nc.hayActual = false;
+                encoladoES[id] = tiempo;
+                dispositivosActivos[d].cola.insertNewValue(
+                    id, porPrioridad ? ClaveSMP{carga.priority[id], secuencia++} : ClaveSMP{secuencia++, 0});
+            } else if (tiempoRestante[id] == 0) {
+                ultimaEjecucion[id] = tiempo;
+                metricas.agregar(carga.arrivalTime[id], primeraEjecucion[id], tiempo,
+                                 carga.burstTime[id], ciclosES[id]);
+                cerrarBloque(c, tiempo);
+                emitir(TipoEvento::Terminacion, id, c, tiempo);
+                nc.pesoTotal -= peso[id];
+                nc.hayActual = false;
+                terminados++;
+            } else if (nc.usado >= nc.limite) {
+                // RR y MLFQ cierran el bloque en cada quantum; CFS, Stride y
+                // Lottery lo mantienen abierto si el mismo proceso vuelve a ser elegido
+                if (politica == Politica::MLFQ && nivelDe(id) < nivelMaximo) {
+                    fijarNivel(id, nivelDe(id) + 1);
+                }
+                if (!usaVruntime(politica) && politica != Politica::Lottery) {
+                    cerrarBloque(c, tiempo);
+                }
+                nc.reencolar = true;
+            }
+        }
+        return Paso::Sigue;
+    }
+
+    // Resultado tras el último paso (se llama una sola vez)
+    ResultadoSMP finalizar() {
+        if (terminados < n) {
+            // Corte en pc->hastaTiempo: se cierran los tramos abiertos, sin métricas finales
+            for (int c = 0; c < numCPUs; ++c) {
+                cerrarBloque(c, tiempo);
+                cerrarCambio(c, tiempo);
+            }
+            return std::move(resultado);
+        }
+
+        // Métricas finales: percentiles de los histogramas; promedio y máximo con
+        // una pasada del kernel de columnas sobre los arreglos por id
+        resultado.metricas = metricas.resultado();
+        aplicarReducciones(resultado.metricas,
+                           calcularMetricasColumnas(carga.arrivalTime.data(), carga.burstTime.data(),
+                                                    primeraEjecucion.data(), ultimaEjecucion.data(),
+                                                    ciclosES.data(), n));
+        if (!config.soloAgregados) {
+            resultado.procesos = resultadosPorTerminacion(carga, primeraEjecucion, ultimaEjecucion,
+                                                          es ? &ciclosES : nullptr);
+        }
+        resultado.makespan = *std::max_element(ultimaEjecucion.begin(), ultimaEjecucion.end());
+        long long totalOcupado = 0, maxOcupado = 0;
+        for (EstadisticasCPU& cpu : resultado.cpus) {
+            cpu.utilizacion = resultado.makespan > 0
+                ? static_cast<double>(cpu.ciclosOcupado) / resultado.makespan : 0.0;
+            totalOcupado += cpu.ciclosOcupado;
+            maxOcupado = std::max(maxOcupado, cpu.ciclosOcupado);
+        }
+        const double promedio = static_cast<double>(totalOcupado) / numCPUs;
+        resultado.desbalanceCarga = promedio > 0.0 ? maxOcupado / promedio - 1.0 : 0.0;
+
+        if (es) {
+            for (size_t d = 0; d < dispositivosActivos.size(); ++d) {
+                EstadisticasDispositivo& est = es->salida->dispositivos[d];
+                est.utilizacion = resultado.makespan > 0
+                    ? static_cast<double>(est.ciclosOcupado) / resultado.makespan : 0.0;
+                est.esperaPromedio = est.atendidas > 0
+                    ? static_cast<double>(dispositivosActivos[d].esperaTotal) / est.atendidas : 0.0;
+            }
+            es->salida->utilizacionCPU = resultado.makespan > 0
+                ? static_cast<double>(totalOcupado) / (static_cast<double>(numCPUs) * resultado.makespan) : 0.0;
+            es->salida->throughput = resultado.makespan > 0
+                ? static_cast<double>(n) / resultado.makespan : 0.0;
+        }
+        return std::move(resultado);
+    }
+
+private:
+    bool configuracionValida() const {
+        // --- Programación defensiva ---
+        if (carga.size() == 0) {
+            qDebug() << "simularMulticore: carga vacía. Abortando.";
+            return false;
+        }
+        if (config.numCPUs <= 0 || config.penalizacionMigracion < 0) {
+            qDebug() << "simularMulticore: configuración inválida: CPUs" << config.numCPUs
+                     << "penalización" << config.penalizacionMigracion;
+            return false;
+        }
+        if (config.costoCambioContexto < 0 || config.costoMismoProceso < 0) {
+            qDebug() << "simularMulticore: costo de cambio de contexto inválido:"
+                     << config.costoCambioContexto << config.costoMismoProceso;
+            return false;
+        }
+        if ((politica == Politica::RoundRobin || politica == Politica::Stride ||
+             politica == Politica::Lottery) && parametros.quantum <= 0) {
+            qDebug() << "simularMulticore: quantum inválido:" << parametros.quantum;
+            return false;
+        }
+        if (politica == Politica::RoundRobinAdaptativo &&
+            (parametros.percentilQuantum < 1 || parametros.percentilQuantum > 100)) {
+            qDebug() << "simularMulticore: percentil de quantum inválido:" << parametros.percentilQuantum;
+            return false;
+        }
+        if (politica == Politica::MLFQ) {
+            if (parametros.quantumPorNivel.empty() || parametros.periodoBoost < 0) {
+                qDebug() << "simularMulticore: parámetros de MLFQ inválidos.";
+                return false;
+            }
+            for (int q : parametros.quantumPorNivel) {
+                if (q <= 0) {
+                    qDebug() << "simularMulticore: quantum de MLFQ inválido:" << q;
+                    return false;
+                }
+            }
+        }
+        if (politica == Politica::CFS &&
+            (parametros.latenciaObjetivo <= 0 || parametros.granularidadMinima <= 0)) {
+            qDebug() << "simularMulticore: latencia/granularidad de CFS inválidas.";
+            return false;
+        }
+        // --- Fin defensiva ---
+        return true;
+    }
+
+    void emitir(TipoEvento tipo, uint32_t id, int cpu, int instante, int duracion = 0) {
+        if (eventosSalida) {
+            eventosSalida->push_back({tipo, id, cpu, instante, duracion});
+        }
+    }
+
+    // Clave de `id` al encolarse según la política
+    ClaveSMP clave(uint32_t id) {
+        switch (politica) {
+        case Politica::SJF:                return {rafagaCPU[id], carga.arrivalTime[id]};
+        case Politica::Priority:           return {carga.priority[id], carga.arrivalTime[id]};
+        case Politica::SRT:                return {tiempoRestante[id], 0};
+        case Politica::PreemptivePriority: return {efectiva[id], secuencia++};
+        case Politica::CFS:
+        case Politica::Stride:             return {vruntime[id], secuencia++};
+        case Politica::FIFO:
+        case Politica::RoundRobin:
+        case Politica::RoundRobinAdaptativo:
+        case Politica::Lottery:
+        case Politica::MLFQ:               break; // MLFQ encola en `buckets` por nivelDe()
+        }
+        return {secuencia++, 0};
+    }
+
+    // Nivel de MLFQ: el guardado si es de la época de boost vigente, si no 0
+    int nivelDe(uint32_t id) const { return epocaNivel[id] == epocaBoost ? nivel[id] : 0; }
+
+    void fijarNivel(uint32_t id, int valor) {
+        nivel[id] = valor;
+        epocaNivel[id] = epocaBoost;
+    }
+
+    // Procesos en espera en la cola de `cpu`
+    int tamCola(int cpu) const {
+        return politica == Politica::MLFQ ? buckets[cpu].size() : colas[cpu].size();
+    }
+
+    // Núcleo menos cargado (a igualdad, el de menor índice)
+    int nucleoMenosCargado() const {
+        int destino = 0;
+        int cargaMin = INT_MAX;
+        for (int c = 0; c < numCPUs; ++c) {
+            int cargaC = tamCola(c) + (nucleos[c].hayActual ? 1 : 0);
+            if (cargaC < cargaMin) {
+                cargaMin = cargaC;
+                destino = c;
+            }
+        }
+        return destino;
+    }
+
+    void encolar(int cpu, uint32_t id, int ahora) {
+        if (politica == Politica::MLFQ) {
+            buckets[cpu].pushBack(id, nivelDe(id));
+        } else {
+            colas[cpu].insertNewValue(id, clave(id));
+        }
+        cpuDe[id] = cpu;
+        if (politica == Politica::Lottery) {
+            tickets[cpu].asignar(id, peso[id]);
+        }
+        if (adaptativo) {
+            restantesEnCola[cpu].insertar(id, tiempoRestante[id]);
+        }
+        if (envejecimiento > 0 && efectiva[id] > 0) {
+            vencimientos.insertNewValue(id, ahora + envejecimiento);
+        }
+    }
+
+    // Saca el siguiente de la cola de `cpu`: el de menor clave o, en Lottery,
+    // el ganador de un sorteo entre los tickets de esa cola (como lotteryScheduling)
+    uint32_t sacar(int cpu) {
+        if (politica == Politica::MLFQ) return buckets[cpu].popMejor();
+        if (politica != Politica::Lottery) return colas[cpu].pop().id;
+        const uint64_t boleto = generador() % static_cast<uint64_t>(tickets[cpu].total());
+        sorteos++;
+        const uint32_t id = tickets[cpu].buscar(static_cast<int64_t>(boleto));
+        tickets[cpu].asignar(id, 0);
+        colas[cpu].deleteValue(id);
+        return id;
+    }
+
+    void cerrarBloque(int cpu, int ahora) {
+        Nucleo& nc = nucleos[cpu];
+        if (nc.tickActual > 0) {
+            if (!config.soloAgregados) {
+                resultado.bloques.push_back({carga.pids[nc.actual], ahora - nc.tickActual, nc.tickActual, cpu});
+            }
+            emitir(TipoEvento::Ejecucion, nc.actual, cpu, ahora - nc.tickActual, nc.tickActual);
+        }
+        nc.tickActual = 0;
+    }
+
+    void cerrarCambio(int cpu, int ahora) {
+        Nucleo& nc = nucleos[cpu];
+        if (nc.tickCambio > 0) {
+            if (!config.soloAgregados) {
+                resultado.bloques.push_back({carga.pids[nc.actual], ahora - nc.tickCambio, nc.tickCambio, cpu,
+                                             TipoBloque::CambioContexto});
+            }
+            emitir(TipoEvento::CambioContexto, nc.actual, cpu, ahora - nc.tickCambio, nc.tickCambio);
+        }
+        nc.tickCambio = 0;
+        nc.cambioRestante = 0;
+    }
+
+    // ¿La cola de `cpu` tiene a alguien que debe expropiar al actual?
+    bool debeExpropiar(int cpu) const {
+        const Nucleo& nc = nucleos[cpu];
+        if (!nc.hayActual || tamCola(cpu) == 0) return false;
+        if (politica == Politica::MLFQ) return buckets[cpu].mejorNivel() < nivelDe(nc.actual);
+        const int64_t mejor = colas[cpu].top().clave.first;
+        switch (politica) {
+        case Politica::SRT:                return mejor < tiempoRestante[nc.actual];
+        case Politica::PreemptivePriority: return mejor < efectiva[nc.actual];
+        default:                           return false;
+        }
+    }
+
+    // Pone a `id` en la CPU `cpu` y calcula su quantum/slice
+    void despachar(int cpu, uint32_t id, int ahora) {
+        Nucleo& nc = nucleos[cpu];
+        if (nc.tickActual > 0 && nc.actual != id) {
+            cerrarBloque(cpu, ahora);
+        }
+        vencimientos.deleteValue(id);
+        const int origen = cpuDe[id]; // Cola de la que salió (otra si fue robado)
+        cpuDe[id] = -1;
+        // Cambio de contexto: el núcleo carga a `id` antes de avanzarlo
+        if (nc.ultimo >= 0) {
+            const bool mismo = nc.ultimo == static_cast<int>(id);
+            const int costo = mismo ? config.costoMismoProceso : config.costoCambioContexto;
+            if (mismo) {
+                resultado.redespachos++;
+            } else {
+                resultado.cambiosContexto++;
+            }
+            if (costo > 0) {
+                cerrarBloque(cpu, ahora);
+                nc.cambioRestante = costo;
+            }
+        }
+        emitir(TipoEvento::Despacho, id, cpu, ahora);
+        nc.ultimo = static_cast<int>(id);
+        nc.actual = id;
+        nc.hayActual = true;
+        nc.usado = 0;
+        if (primeraEjecucion[id] < 0) {
+            primeraEjecucion[id] = ahora;
+        }
+        switch (politica) {
+        case Politica::RoundRobin:
+        case Politica::Stride:
+        case Politica::Lottery:
+            nc.limite = parametros.quantum;
+            break;
+        case Politica::MLFQ:
+            nc.limite = parametros.quantumPorNivel[nivelDe(id)];
+            break;
+        case Politica::RoundRobinAdaptativo:
+            // Percentil del restante en la cola de origen, con `id` todavía dentro
+            nc.limite = static_cast<int>(restantesEnCola[origen].valor());
+            restantesEnCola[origen].quitar(id);
+            break;
+        case Politica::CFS: {
+            const int64_t ejecutables = colas[cpu].size() + 1;
+            int64_t periodo = parametros.latenciaObjetivo;
+            if (ejecutables * parametros.granularidadMinima > periodo) {
+                periodo = ejecutables * parametros.granularidadMinima;
+            }
+            nc.limite = static_cast<int>(std::max<int64_t>(1, periodo * peso[id] / nc.pesoTotal));
+            break;
+        }
+        default:
+            nc.limite = INT_MAX;
+        }
+    }
+
+    // Migración de `id` (ya fuera de la cola de `origen`) hacia `destino`
+    void migrar(uint32_t id, int origen, int destino) {
+        if (usaVruntime(politica)) {
+            vruntime[id] = vruntime[id] - nucleos[origen].minVruntime + nucleos[destino].minVruntime;
+            nucleos[origen].pesoTotal -= peso[id];
+            nucleos[destino].pesoTotal += peso[id];
+        }
+        // Solo paga la penalización quien ya calentó la caché de otro núcleo
+        if (cpuAnterior[id] >= 0 && cpuAnterior[id] != destino) {
+            tiempoRestante[id] += config.penalizacionMigracion;
+            resultado.ciclosMigracion += config.penalizacionMigracion;
+        }
+        resultado.migraciones++;
+        resultado.cpus[destino].migracionesEntrantes++;
+    }
+
+    // Puntos de control: la misma lista de campos guarda y restaura. Los
+    // arreglos que la política no lee no se guardan; `peso` se recalcula,
+    // `restantesEnCola` y `tickets` se rearman desde las colas y el generador
+    // de Lottery se repone descartando los `sorteos` ya hechos
+    template <typename Flujo>
+    void camposEstado(Flujo& flujo) {
+        flujo.campo(tiempo);
+        flujo.campo(proximoBoost);
+        flujo.campo(i);
+        flujo.campo(terminados);
+        flujo.campo(secuencia);
+        flujo.vector(tiempoRestante);
+        flujo.vector(primeraEjecucion);
+        flujo.vector(ultimaEjecucion);
+        flujo.vector(cpuAnterior);
+        flujo.vector(cpuDe);
+        if (politica == Politica::PreemptivePriority) flujo.vector(efectiva);
+        if (politica == Politica::MLFQ) {
+            flujo.vector(nivel);
+            flujo.vector(epocaNivel);
+            flujo.campo(epocaBoost);
+        }
+        if (usaVruntime(politica)) flujo.vector(vruntime);
+        if (politica == Politica::Lottery) flujo.campo(sorteos);
+        for (Nucleo& nc : nucleos) {
+            flujo.campo(nc.actual);
+            flujo.campo(nc.hayActual);
+            flujo.campo(nc.reencolar);
+            flujo.campo(nc.tickActual);
+            flujo.campo(nc.usado);
+            flujo.campo(nc.limite);
+            flujo.campo(nc.pesoTotal);
+            flujo.campo(nc.minVruntime);
+            flujo.campo(nc.ultimo);
+            flujo.campo(nc.cambioRestante);
+            flujo.campo(nc.tickCambio);
+        }
+        for (EstadisticasCPU& cpu : resultado.cpus) {
+            flujo.campo(cpu.ciclosOcupado);
+            flujo.campo(cpu.migracionesEntrantes);
+        }
+        flujo.campo(resultado.migraciones);
+        flujo.campo(resultado.ciclosMigracion);
+        flujo.campo(resultado.cambiosContexto);
+        flujo.campo(resultado.redespachos);
+        flujo.campo(resultado.ciclosCambio);
+    }
+
+    void guardarPunto() {
+        escritorBinario salida;
+        salida.natural(VERSION_PUNTO_CONTROL);
+        salida.natural(huella);
+        salida.natural(static_cast<uint64_t>(politica));
+        salida.natural(static_cast<uint64_t>(numCPUs));
+        camposEstado(salida);
+        for (int c = 0; c < numCPUs; ++c) {
+            if (politica == Politica::MLFQ) {
+                // (id, nivel, posición) en orden de salida: se reencolan en ese orden
+                const std::vector<uint32_t> orden = buckets[c].enOrden();
+                salida.natural(orden.size());
+                for (size_t k = 0; k < orden.size(); ++k) {
+                    salida.natural(orden[k]);
+                    salida.entero(buckets[c].nivelDe(orden[k]));
+                    salida.entero(static_cast<int64_t>(k));
+                }
+                continue;
+            }
+            salida.natural(colas[c].entradas().size());
+            for (const ColaSMP::Entrada& e : colas[c].entradas()) {
+                salida.natural(e.id);
+                salida.entero(e.clave.first);
+                salida.entero(e.clave.second);
+            }
+        }
+        salida.natural(vencimientos.entradas().size());
+        for (const priorityQueue<int>::Entrada& e : vencimientos.entradas()) {
+            salida.natural(e.id);
+            salida.entero(e.clave);
+        }
+        metricas.guardar(salida);
+
+        PuntoControl punto;
+        punto.tiempo = tiempo;
+        punto.eventos = eventos;
+        punto.bloquesPrevios = bloquesBase + resultado.bloques.size();
+        punto.bloquesNuevos.assign(resultado.bloques.begin() + bloquesEntregados, resultado.bloques.end());
+        bloquesEntregados = resultado.bloques.size();
+        punto.datos = salida.liberar();
+        pc->salida->puntoTomado(punto);
+    }
+
+    // false si el punto no es de esta carga/política/CPUs o está dañado
+    bool restaurarPunto(const PuntoControl& punto) {
+        lectorBinario entrada(punto.datos);
+        if (entrada.natural() != VERSION_PUNTO_CONTROL || entrada.natural() != huella ||
+            entrada.natural() != static_cast<uint64_t>(politica) ||
+            entrada.natural() != static_cast<uint64_t>(numCPUs)) {
+            return false;
+        }
+        camposEstado(entrada);
+        if (!entrada.ok() || i > n || terminados > n || tiempoRestante.size() != n ||
+            primeraEjecucion.size() != n || ultimaEjecucion.size() != n ||
+            cpuAnterior.size() != n || cpuDe.size() != n || efectiva.size() != n ||
+            nivel.size() != n || epocaNivel.size() != n || vruntime.size() != n) {
+            return false;
+        }
+        for (uint32_t id = 0; id < n; ++id) {
+            if (cpuDe[id] < -1 || cpuDe[id] >= numCPUs || nivel[id] < 0 || nivel[id] > std::max(nivelMaximo, 0)) {
+                return false;
+            }
+        }
+        for (const Nucleo& nc : nucleos) {
+            if (nc.actual >= n || nc.ultimo < -1 || nc.ultimo >= static_cast<int>(n)) return false;
+        }
+        for (int c = 0; c < numCPUs; ++c) {
+            const uint64_t cantidad = entrada.natural();
+            for (uint64_t k = 0; k < cantidad && entrada.ok(); ++k) {
+                const uint64_t id = entrada.natural();
+                const int64_t primaria = entrada.entero();
+                const int64_t secundaria = entrada.entero();
+                if (id >= n || cpuDe[id] != c) return false;
+                if (politica == Politica::MLFQ) {
+                    if (buckets[c].contains(static_cast<uint32_t>(id)) || primaria < 0 || primaria > nivelMaximo) {
+                        return false;
+                    }
+                    buckets[c].pushBack(static_cast<uint32_t>(id), static_cast<int>(primaria));
+                    continue;
+                }
+                if (colas[c].contains(static_cast<uint32_t>(id))) return false;
+                colas[c].insertNewValue(static_cast<uint32_t>(id), {primaria, secundaria});
+                if (adaptativo) {
+                    restantesEnCola[c].insertar(static_cast<uint32_t>(id), tiempoRestante[id]);
+                }
+                if (politica == Politica::Lottery) {
+                    tickets[c].asignar(static_cast<uint32_t>(id), peso[id]);
+                }
+            }
+        }
+        generador.discard(sorteos);
+        const uint64_t cantidad = entrada.natural();
+        for (uint64_t k = 0; k < cantidad && entrada.ok(); ++k) {
+            const uint64_t id = entrada.natural();
+            const int vence = static_cast<int>(entrada.entero());
+            if (id >= n || cpuDe[id] < 0 || vencimientos.contains(static_cast<uint32_t>(id))) return false;
+            vencimientos.insertNewValue(static_cast<uint32_t>(id), vence);
+        }
+        return metricas.restaurar(entrada) && entrada.alFinal();
+    }
+
+    static constexpr int64_t ESCALA_VRUNTIME = 1024 * 1024; // vruntime en 1/1024 de ciclo
+
+    const CargaTrabajo& carga;
+    const Politica politica;
+    const ParametrosPolitica& parametros;
+    const ConfigSMP& config;
+    ObservadorSimulacion* obs;
+    EntradaSalidaMotor* es;
+    PuntosControlMotor* pc;
+    std::vector<EventoSimulacion>* eventosSalida;
+    const size_t n;
+    const int numCPUs;
+    const int envejecimiento;
+    const int periodoBoost;
+    const int nivelMaximo;
+    const bool adaptativo;          // RR adaptativo: distribución del restante en cada cola
+    bool listo = false;
+
+    std::vector<int> tiempoRestante;
+    std::vector<int> rafagaCPU;        // Largo de la ráfaga de CPU en curso (SJF)
+    std::vector<int> rafaga;           // Índice de la ráfaga de CPU en curso
+    std::vector<int> ciclosES;         // Ciclos servidos en dispositivos
+    std::vector<int> encoladoES;       // Llegada a la cola del dispositivo
+    std::vector<int> primeraEjecucion;
+    std::vector<int> ultimaEjecucion;
+    AcumuladorMetricas metricas;       // Se alimenta en cada terminación
+    std::vector<int> cpuAnterior;      // Último núcleo donde corrió
+    std::vector<int> base;             // Prioridad (en rangos densos con Preemptive Priority)
+    std::vector<int> efectiva;         // Preemptive Priority
+    std::vector<int> nivel;            // MLFQ (válido si epocaNivel == epocaBoost; si no, 0)
+    std::vector<uint32_t> epocaNivel;
+    uint32_t epocaBoost = 0;           // Boosts hechos
+    std::vector<int64_t> vruntime;     // CFS
+    std::vector<int64_t> peso;
+
+    std::vector<ColaSMP> colas;
+    std::vector<colaBuckets> buckets;  // MLFQ: en lugar de `colas`
+    std::vector<Nucleo> nucleos;
+    std::vector<int> cpuDe;            // Cola donde espera cada id
+    priorityQueue<int> vencimientos;   // Aging de Preemptive Priority
+    std::vector<percentilDinamico> restantesEnCola;
+    std::vector<arbolFenwick> tickets; // Lottery: tickets de los que esperan en cada cola
+    std::mt19937_64 generador;         // Lottery: un sorteo para todos los núcleos
+    uint64_t sorteos = 0;
+    int64_t secuencia = 0;
+    std::vector<DispositivoActivo> dispositivosActivos;
+    ResultadoSMP resultado;
+
+    int tiempo = 0;
+    int proximoBoost = -1;
+    size_t i = 0;
+    size_t terminados = 0;
+    long long eventos = 0;
+    long long eventosInicio = 0;
+    uint64_t huella = 0;
+    size_t bloquesBase = 0;
+    size_t bloquesEntregados = 0; // De resultado.bloques, ya enviados como delta de un punto
+};
+
+ResultadoSMP simularMotor(const CargaTrabajo& carga,
+                          Politica politica,
+                          const ParametrosPolitica& parametros,
+                          const ConfigSMP& config,
+                          ObservadorSimulacion* obs,
+                          EntradaSalidaMotor* es,
+                          PuntosControlMotor* pc = nullptr)
+{
+    MotorSMP motor(carga, politica, parametros, config, obs, es, pc);
+    if (!motor.valido()) return ResultadoSMP();
+    while (motor.paso() == MotorSMP::Paso::Sigue) {
+    }
+    return motor.finalizar();
+}
+
+} // namespace
+
+ResultadoSMP simularMulticore(const CargaTrabajo& carga,
+                              Politica politica,
+                              const ParametrosPolitica& parametros,
+                              const ConfigSMP& config,
+                              ObservadorSimulacion* obs)
+{
+    return simularMotor(carga, politica, parametros, config, obs, nullptr);
+}
+
+struct Planificador::Estado {
+    const ParametrosPolitica parametros;
+    const ConfigSMP config;
+    std::vector<EventoSimulacion> pendientes; // Eventos del último paso
+    size_t leidos = 0;
+    bool fin = false;
+    bool finalizado = false;
+    ResultadoSMP final;
+    MotorSMP motor;
+
+    Estado(const CargaTrabajo& carga, Politica politica,
+           const ParametrosPolitica& parametros, const ConfigSMP& config)
+        : parametros(parametros), config(config),
+          motor(carga, politica, this->parametros, this->config, nullptr, nullptr, nullptr, &pendientes)
+    {
+        fin = !motor.valido();
+    }
+};
+
+Planificador::Planificador(std::unique_ptr<Estado> estado) : estado(std::move(estado)) {}
+Planificador::Planificador(Planificador&& otro) noexcept = default;
+Planificador& Planificador::operator=(Planificador&& otro) noexcept = default;
+Planificador::~Planificador() = default;
+
+std::optional<EventoSimulacion> Planificador::siguiente()
+{
+    if (!estado) return std::nullopt;
+    Estado& e = *estado;
+    // Un paso del motor puede no dar eventos (p. ej. un salto en ocio)
+    while (e.leidos == e.pendientes.size()) {
+        if (e.fin) return std::nullopt;
+        e.pendientes.clear();
+        e.leidos = 0;
+        if (e.motor.paso() != MotorSMP::Paso::Sigue) e.fin = true;
+    }
+    return e.pendientes[e.leidos++];
+}
+
+bool Planificador::valido() const
+{
+    return estado && estado->motor.valido();
+}
+
+bool Planificador::terminado() const
+{
+    return !estado || (estado->fin && estado->leidos == estado->pendientes.size());
+}
+
+int Planificador::tiempo() const
+{
+    return estado ? estado->motor.tiempoActual() : 0;
+}
+
+ResultadoSMP Planificador::resultado()
+{
+    if (!valido() || !terminado()) return ResultadoSMP();
+    if (!estado->finalizado) {
+        estado->final = estado->motor.finalizar();
+        estado->finalizado = true;
+    }
+    return estado->final;
+}
+
+Planificador crearPlanificador(const CargaTrabajo& carga,
+                               Politica politica,
+                               const ParametrosPolitica& parametros,
+                               const ConfigSMP& config)
+{
+    ConfigSMP sinBloques = config;
+    sinBloques.soloAgregados = true;
+    return Planificador(std::make_unique<Planificador::Estado>(carga, politica, parametros, sinBloques));
+}
+
+ResultadoSMP simularConPuntosControl(const CargaTrabajo& carga,
+                                     Politica politica,
+                                     const ParametrosPolitica& parametros,
+                                     const ConfigSMP& config,
+                                     long long cadaEventos,
+                                     SumideroPuntosControl* sumidero,
+                                     ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (cadaEventos <= 0 || !sumidero) {
+        qDebug() << "simularConPuntosControl: se necesita cadaEventos > 0 y un destino para los puntos:" << cadaEventos;
+        return ResultadoSMP();
+    }
+    // --- Fin defensiva ---
+    PuntosControlMotor pc;
+    pc.cadaEventos = cadaEventos;
+    pc.salida = sumidero;
+    return simularMotor(carga, politica, parametros, config, obs, nullptr, &pc);
+}
+
+ResultadoSMP simularConPuntosControl(const CargaTrabajo& carga,
+                                     Politica politica,
+                                     const ParametrosPolitica& parametros,
+                                     const ConfigSMP& config,
+                                     long long cadaEventos,
+                                     std::vector<PuntoControl>* puntos,
+                                     ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!puntos) {
+        qDebug() << "simularConPuntosControl: se necesita un vector de salida.";
+        return ResultadoSMP();
+    }
+    // --- Fin defensiva ---
+    VectorPuntosControl sumidero(puntos);
+    return simularConPuntosControl(carga, politica, parametros, config, cadaEventos, &sumidero, obs);
+}
+
+ResultadoSMP reanudarSimulacion(const CargaTrabajo& carga,
+                                Politica politica,
+                                const ParametrosPolitica& parametros,
+                                const ConfigSMP& config,
+                                const PuntoControl& punto,
+                                long long cadaEventos,
+                                SumideroPuntosControl* sumidero,
+                                ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (cadaEventos < 0 || (cadaEventos > 0 && !sumidero)) {
+        qDebug() << "reanudarSimulacion: cadaEventos inválido o sin destino para los puntos:" << cadaEventos;
+        return ResultadoSMP();
+    }
+    // --- Fin defensiva ---
+    PuntosControlMotor pc;
+    pc.cadaEventos = cadaEventos;
+    pc.salida = sumidero;
+    pc.desde = &punto;
+    return simularMotor(carga, politica, parametros, config, obs, nullptr, &pc);
+}
+
+ResultadoSMP reanudarSimulacion(const CargaTrabajo& carga,
+                                Politica politica,
+                                const ParametrosPolitica& parametros,
+                                const ConfigSMP& config,
+                                const PuntoControl& punto,
+                                long long cadaEventos,
+                                std::vector<PuntoControl>* puntos,
+                                ObservadorSimulacion* obs)
+{
+    if (!puntos) {
+        return reanudarSimulacion(carga, politica, parametros, config, punto, cadaEventos,
+                                  static_cast<SumideroPuntosControl*>(nullptr), obs);
+    }
+    VectorPuntosControl sumidero(puntos);
+    return reanudarSimulacion(carga, politica, parametros, config, punto, cadaEventos, &sumidero, obs);
+}
+
+std::vector<BloqueGantt> simularVentana(const CargaTrabajo& carga,
+                                        Politica politica,
+                                        const ParametrosPolitica& parametros,
+                                        const ConfigSMP& config,
+                                        const std::vector<PuntoControl>& puntos,
+                                        int desde,
+                                        int hasta)
+{
+    std::vector<BloqueGantt> ventana;
+    // --- Programación defensiva ---
+    if (desde < 0 || hasta <= desde) {
+        qDebug() << "simularVentana: ventana inválida:" << desde << hasta;
+        return ventana;
+    }
+    // --- Fin defensiva ---
+
+    // El punto más tardío que no pasa de `desde`
+    PuntosControlMotor pc;
+    for (const PuntoControl& punto : puntos) {
+        if (punto.tiempo <= desde && (!pc.desde || punto.tiempo >= pc.desde->tiempo)) {
+            pc.desde = &punto;
+        }
+    }
+    pc.hastaTiempo = hasta;
+    ConfigSMP conBloques = config;
+    conBloques.soloAgregados = false;
+    ResultadoSMP parcial = simularMotor(carga, politica, parametros, conBloques, nullptr, nullptr, &pc);
+
+    for (const BloqueGantt& bloque : parcial.bloques) {
+        const int inicio = std::max(bloque.inicio, desde);
+        const int fin = std::min(bloque.inicio + bloque.duracion, hasta);
+        if (fin > inicio) {
+            BloqueGantt recortado = bloque;
+            recortado.inicio = inicio;
+            recortado.duracion = fin - inicio;
+            ventana.push_back(recortado);
+        }
+    }
+    // Los tramos abiertos al cortar se cierran juntos: orden por inicio y núcleo
+    std::stable_sort(ventana.begin(), ventana.end(), [](const BloqueGantt& a, const BloqueGantt& b) {
+        return a.inicio != b.inicio ? a.inicio < b.inicio : a.cpu < b.cpu;
+    });
+    return ventana;
+}
+
+ResultadoSMP simularMulticore(const std::vector<Proceso>& procesos,
+                              Politica politica,
+                              const ParametrosPolitica& parametros,
+                              const ConfigSMP& config,
+                              ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesos, "simularMulticore")) return ResultadoSMP();
+    // --- Fin defensiva ---
+    return simularMotor(internarProcesos(procesos), politica, parametros, config, obs, nullptr);
+}
+
+ResultadoES simularConES(const CargaTrabajo& carga,
+                         const std::vector<PerfilES>& perfiles,
+                         const std::vector<Dispositivo>& dispositivos,
+                         Politica politica,
+                         const ParametrosPolitica& parametros,
+                         const ConfigSMP& config,
+                         ObservadorSimulacion* obs)
+{
+    ResultadoES resultado;
+    // --- Programación defensiva ---
+    if (perfiles.size() != carga.size()) {
+        qDebug() << "simularConES: se esperaba un perfil de ráfagas por proceso:"
+                 << perfiles.size() << "perfiles," << carga.size() << "procesos.";
+        return resultado;
+    }
+    for (size_t id = 0; id < perfiles.size(); ++id) {
+        const PerfilES& perfil = perfiles[id];
+        if (perfil.rafagasCPU.size() != perfil.rafagasES.size() + 1) {
+            qDebug() << "simularConES: el perfil de" << carga.pids[id]
+                     << "debe alternar CPU y E/S y terminar en CPU.";
+            return resultado;
+        }
+        long long totalCPU = 0;
+        for (int r : perfil.rafagasCPU) {
+            if (r <= 0) {
+                qDebug() << "simularConES: ráfaga de CPU inválida en PID" << carga.pids[id] << ":" << r;
+                return resultado;
+            }
+            totalCPU += r;
+        }
+        if (totalCPU != carga.burstTime[id]) {
+            qDebug() << "simularConES: burstTime de" << carga.pids[id]
+                     << "no coincide con la suma de sus ráfagas de CPU.";
+            return resultado;
+        }
+        for (const RafagaES& r : perfil.rafagasES) {
+            if (r.duracion <= 0 || r.dispositivo < 0 || r.dispositivo >= static_cast<int>(dispositivos.size())) {
+                qDebug() << "simularConES: ráfaga de E/S inválida en PID" << carga.pids[id];
+                return resultado;
+            }
+        }
+    }
+    // --- Fin defensiva ---
+
+    EntradaSalidaMotor es{&perfiles, &dispositivos, &resultado};
+    resultado.cpu = simularMotor(carga, politica, parametros, config, obs, &es);
+    if (resultado.cpu.metricas.procesos == 0) {
+        // El motor rechazó la entrada (ver su defensiva): sin métricas parciales
+        return ResultadoES();
+    }
+    return resultado;
+}
+
+ResultadoES simularConES(const std::vector<Proceso>& procesos,
+                         const std::vector<PerfilES>& perfiles,
+                         const std::vector<Dispositivo>& dispositivos,
+                         Politica politica,
+                         const ParametrosPolitica& parametros,
+                         const ConfigSMP& config,
+                         ObservadorSimulacion* obs)
+{
+    // --- Programación defensiva ---
+    if (!procesosValidos(procesos, "simularConES")) return ResultadoES();
+    // --- Fin defensiva ---
+    return simularConES(internarProcesos(procesos), perfiles, dispositivos, politica, parametros, config, obs);
+}
@@ -7,31 +7,21 @@
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
-#include <QMessageBox>
-#include <QWidget>
-#include <QThread>
-#include <QApplication>
-#include "ganttwindow.h"
-
-// Función de delay
-void delaySync(int milisegundos) {
-    QThread::msleep(milisegundos);
-    QApplication::processEvents(); // Procesar eventos de la GUI
-}
 
 /**
  * Carga procesos desde archivo. Cada línea con formato:
  *   <PID>,<BT>,<AT>,<Priority>
  */
-std::vector<Proceso> loadProcesos(const QString &ruta) {
+std::vector<Proceso> loadProcesos(const QString &ruta, QStringList *erroresSalida) {
     std::vector<Proceso> v;
     std::unordered_set<QString> seenPIDs;
     QStringList errores;  // acumulador de mensajes
 
     QFile f(ruta);
     if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QMessageBox::warning(nullptr, "Error",
-                             QString("No se pudo abrir procesos en:\n%1").arg(ruta));
+        if (erroresSalida) {
+            erroresSalida->append(QString("No se pudo abrir procesos en:\n%1").arg(ruta));
+        }
         return v;
     }
     QTextStream in(&f);
@@ -103,7 +93,9 @@ std::vector<Proceso> loadProcesos(const QString &ruta) {
     f.close();
 
     if (!errores.isEmpty()) {
-        QMessageBox::warning(nullptr, "Errores en procesos.txt", errores.join("\n"));
+        if (erroresSalida) {
+            erroresSalida->append(errores);
+        }
         return {};
     }
     return v;
@@ -113,15 +105,16 @@ std::vector<Proceso> loadProcesos(const QString &ruta) {
  * Carga recursos desde archivo. Cada línea con formato:
  *   <NOMBRE>,<COUNT>
  */
-std::vector<Recurso> loadRecursos(const QString &ruta) {
+std::vector<Recurso> loadRecursos(const QString &ruta, QStringList *erroresSalida) {
     std::vector<Recurso> v;
     std::unordered_set<QString> seenRecursos;
     QStringList errores;  // acumulador de mensajes
 
     QFile f(ruta);
     if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QMessageBox::warning(nullptr, "Error",
-                             QString("No se pudo abrir recursos en:\n%1").arg(ruta));
+        if (erroresSalida) {
+            erroresSalida->append(QString("No se pudo abrir recursos en:\n%1").arg(ruta));
+        }
         return v;
     }
     QTextStream in(&f);
@@ -175,7 +168,9 @@ std::vector<Recurso> loadRecursos(const QString &ruta) {
     f.close();
 
     if (!errores.isEmpty()) {
-        QMessageBox::warning(nullptr, "Errores en recursos.txt", errores.join("\n"));
+        if (erroresSalida) {
+            erroresSalida->append(errores);
+        }
         return {};
     }
     return v;
@@ -185,15 +180,16 @@ std::vector<Recurso> loadRecursos(const QString &ruta) {
  * Carga acciones desde archivo. Cada línea con formato:
  *   <PID>,<ACTION>,<RECURSO>,<CICLO>
  */
-std::vector<Accion> loadAcciones(const QString &ruta) {
+std::vector<Accion> loadAcciones(const QString &ruta, QStringList *erroresSalida) {
     std::vector<Accion> v;
     std::unordered_set<QString> seenAcciones;
     QStringList errores;  // acumulador de mensajes
 
     QFile f(ruta);
     if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QMessageBox::warning(nullptr, "Error",
-                             QString("No se pudo abrir acciones en:\n%1").arg(ruta));
+        if (erroresSalida) {
+            erroresSalida->append(QString("No se pudo abrir acciones en:\n%1").arg(ruta));
+        }
         return v;
     }
     QTextStream in(&f);
@@ -274,7 +270,9 @@ std::vector<Accion> loadAcciones(const QString &ruta) {
     f.close();
 
     if (!errores.isEmpty()) {
-        QMessageBox::warning(nullptr, "Errores en acciones.txt", errores.join("\n"));
+        if (erroresSalida) {
+            erroresSalida->append(errores);
+        }
         return {};
     }
 
@@ -291,8 +289,7 @@ std::vector<Accion> loadAcciones(const QString &ruta) {
 
 bool validateAndSortActions(std::vector<Accion> &acciones, 
                             const std::vector<Proceso> &procesos,
-                            QWidget *parent /*= nullptr*/,
-                            bool isMutex /*= false*/) {
+                            QStringList *erroresSalida /*= nullptr*/) {
     // Crear mapa de procesos para acceso rápido
     std::unordered_map<QString, Proceso> procesoMap;
     for (const auto &p : procesos) {
@@ -316,19 +313,10 @@ bool validateAndSortActions(std::vector<Accion> &acciones,
         }
     }
 
+    // Sin diálogos aquí: el llamador (GUI o batch) decide cómo reportarlos
     if (!errores.isEmpty()) {
-        QString mensajeCompleto = "Se encontraron los siguientes errores de validación:\n\n";
-        mensajeCompleto += errores.join("\n");
-        mensajeCompleto += "\n\nLa simulación no puede continuar.";
-
-        if (parent != nullptr) {
-            QMessageBox::critical(parent, 
-                                  "Error de Validación - Sincronizador", 
-                                  mensajeCompleto);
-        } else {
-            QMessageBox::critical(nullptr, 
-                                  "Error de Validación - Sincronizador", 
-                                  mensajeCompleto);
+        if (erroresSalida) {
+            erroresSalida->append(errores);
         }
         return false;
     }
@@ -405,8 +393,8 @@ std::vector<BloqueSync> simulateSync(
     const std::vector<Proceso> &procesos,
     std::vector<Recurso> &recursosVec,
     bool isMutex,
-    GanttWindow *gantt,
-    QWidget *parent)
+    ObservadorSimulacion *obs,
+    QStringList *errores)
 {
     // Crear mapa de procesos para acceso rápido a prioridades
     std::unordered_map<QString, Proceso> procesoMap;
@@ -416,7 +404,7 @@ std::vector<BloqueSync> simulateSync(
     // Crear copia de acciones para validar y ordenar
     std::vector<Accion> accionesOrdenadas = acciones;
     // Validar acciones antes de continuar
-    if (!validateAndSortActions(accionesOrdenadas, procesos, parent, isMutex)) {
+    if (!validateAndSortActions(accionesOrdenadas, procesos, errores)) {
         qDebug() << "SIMULACIÓN ABORTADA: Errores en la validación de acciones";
         return std::vector<BloqueSync>(); // Retornar vector vacío en caso de error
     }
@@ -475,17 +463,16 @@ std::vector<BloqueSync> simulateSync(
             };
             timeline.push_back(waitBlock);
             // Dibujar WAIT
-            if (gantt != nullptr) {
+            if (obs != nullptr) {
                 for (int offset = 0; offset < waitBlock.duration; ++offset) {
                     int cicloActual = waitBlock.start + offset;
-                    gantt->agregarBloqueSync(
+                    obs->bloqueSync(
                         waitBlock.pid,
                         waitBlock.recurso,
                         waitBlock.accion,
                         cicloActual,
                         false // WAIT
                     );
-                    delaySync(500);
                 }
             }
 
@@ -505,15 +492,14 @@ std::vector<BloqueSync> simulateSync(
         timeline.push_back(accessBlock);
 
         // Dibujar ACCESS
-        if (gantt != nullptr) {
-            gantt->agregarBloqueSync(
+        if (obs != nullptr) {
+            obs->bloqueSync(
                 accessBlock.pid,
                 accessBlock.recurso,
                 accessBlock.accion,
                 startAccess,
                 true // ACCESS
             );
-            delaySync(3000);
         }
 
         // Registrar fin de acceso en (startAccess + 1)
@@ -527,18 +513,18 @@ std::vector<BloqueSync> simulateMutex(
     const std::vector<Accion> &acciones,
     std::vector<Recurso> &recursosVec,
     const std::vector<Proceso> &procesos,
-    GanttWindow *gantt,
-    QWidget *parent)
+    ObservadorSimulacion *obs,
+    QStringList *errores)
 {
-    return simulateSync(acciones, procesos, recursosVec, true, gantt, parent);
+    return simulateSync(acciones, procesos, recursosVec, true, obs, errores);
 }
 
 std::vector<BloqueSync> simulateSyncSemaforo(
     const std::vector<Accion> &acciones,
     std::vector<Recurso> &recursosVec,
     const std::vector<Proceso> &procesos,
-    GanttWindow *gantt,
-    QWidget *parent)
+    ObservadorSimulacion *obs,
+    QStringList *errores)
 {
-    return simulateSync(acciones, procesos, recursosVec, false, gantt, parent);
+    return simulateSync(acciones, procesos, recursosVec, false, obs, errores);
 }
\ No newline at end of file
@@ -0,0 +1,363 @@
+#include "tiempoReal.h"
+#include <QDebug>
+#include <QFile>
+#include <QTextStream>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <deque>
+#include <numeric>
+#include <unordered_set>
+#include "priorityQueue.h"
+
+// Tope del horizonte: los tiempos de BloqueGantt son int y cada trabajo deja
+// al menos un bloque, así que un hiperperiodo enorme se recorta aquí
+static const long long HORIZONTE_MAXIMO = 100000000LL;
+
+std::vector<TareaPeriodica> cargarTareasPeriodicas(const QString &ruta, QStringList *erroresSalida) {
+    std::vector<TareaPeriodica> tareas;
+    std::unordered_set<QString> idsVistos;
+    QStringList errores;
+
+    QFile archivo(ruta);
+    if (!archivo.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        if (erroresSalida) {
+            erroresSalida->append(QString("No se pudo abrir el archivo:\n%1").arg(ruta));
+        }
+        return tareas;
+    }
+
+    QTextStream in(&archivo);
+    int lineaNum = 0;
+    while (!in.atEnd()) {
+        QString linea = in.readLine().trimmed();
+        lineaNum++;
+        if (linea.isEmpty()) continue;
+
+        QStringList partes = linea.split(",");
+        if (partes.size() < 3 || partes.size() > 5) {
+            errores.append(QString("Formato incorrecto en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(linea));
+            continue;
+        }
+
+        QString idStr = partes[0].trimmed();
+        bool okPeriodo = false, okWcet = false, okDeadline = true, okFase = true;
+        int periodo  = partes[1].trimmed().toInt(&okPeriodo);
+        int wcet     = partes[2].trimmed().toInt(&okWcet);
+        int deadline = partes.size() > 3 ? partes[3].trimmed().toInt(&okDeadline) : periodo;
+        int fase     = partes.size() > 4 ? partes[4].trimmed().toInt(&okFase) : 0;
+
+        if (idStr.isEmpty()) {
+            errores.append(QString("ID vacío en línea %1 : \"%2\"").arg(lineaNum).arg(linea));
+            continue;
+        }
+        if (!okPeriodo || periodo <= 0) {
+            errores.append(QString("Periodo inválido en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(partes[1].trimmed()));
+            continue;
+        }
+        if (!okWcet || wcet <= 0) {
+            errores.append(QString("WCET inválido en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(partes[2].trimmed()));
+            continue;
+        }
+        if (!okDeadline || deadline <= 0) {
+            errores.append(QString("Deadline inválido en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(partes[3].trimmed()));
+            continue;
+        }
+        if (!okFase || fase < 0) {
+            errores.append(QString("Fase inválida en línea %1 : \"%2\"")
+                          .arg(lineaNum).arg(partes[4].trimmed()));
+            continue;
+        }
+        if (idsVistos.find(idStr) != idsVistos.end()) {
+            errores.append(QString("Tarea duplicada detectada: ID \"%1\" en línea %2")
+                          .arg(idStr).arg(lineaNum));
+            continue;
+        }
+
+        TareaPeriodica t;
+        t.id       = idStr;
+        t.periodo  = periodo;
+        t.wcet     = wcet;
+        t.deadline = deadline;
+        t.fase     = fase;
+        tareas.push_back(t);
+        idsVistos.insert(idStr);
+    }
+    archivo.close();
+
+    if (!errores.isEmpty()) {
+        if (erroresSalida) {
+            erroresSalida->append(errores);
+        }
+        return {};
+    }
+    return tareas;
+}
+
+long long calcularHiperperiodo(const std::vector<TareaPeriodica>& tareas, long long limite) {
+    long long mcm = 1;
+    long long faseMaxima = 0;
+    for (const auto& t : tareas) {
+        // mcm(a, b) = a / gcd(a, b) * b, cortando antes de desbordar
+        long long factor = t.periodo / std::gcd(mcm, static_cast<long long>(t.periodo));
+        if (mcm > limite / factor) return 0;
+        mcm *= factor;
+        faseMaxima = std::max(faseMaxima, static_cast<long long>(t.fase));
+    }
+    return mcm + faseMaxima <= limite ? mcm + faseMaxima : 0;
+}
+
+AnalisisTiempoReal analizarPlanificabilidad(const std::vector<TareaPeriodica>& tareas,
+                                            PoliticaTiempoReal politica)
+{
+    AnalisisTiempoReal analisis;
+    // --- Programación defensiva ---
+    if (tareas.empty()) {
+        qDebug() << "analizarPlanificabilidad: sin tareas. Abortando.";
+        analisis.concluyente = false;
+        return analisis;
+    }
+    for (const auto& t : tareas) {
+        if (t.periodo <= 0 || t.wcet <= 0 || t.deadline <= 0 || t.fase < 0) {
+            qDebug() << "analizarPlanificabilidad: tarea inválida" << t.id;
+            analisis.concluyente = false;
+            return analisis;
+        }
+    }
+    // --- Fin defensiva ---
+
+    const size_t n = tareas.size();
+    double densidad = 0.0;
+    bool deadlinesRestringidos = false; // Alguna con deadline < periodo
+    bool deadlinesArbitrarios = false;  // Alguna con deadline > periodo
+    bool hayFases = false;
+    for (const auto& t : tareas) {
+        analisis.utilizacion += static_cast<double>(t.wcet) / t.periodo;
+        densidad += static_cast<double>(t.wcet) / std::min(t.deadline, t.periodo);
+        deadlinesRestringidos |= t.deadline < t.periodo;
+        deadlinesArbitrarios |= t.deadline > t.periodo;
+        hayFases |= t.fase > 0;
+    }
+    analisis.cotaLiuLayland = n * (std::pow(2.0, 1.0 / n) - 1.0);
+    analisis.tiempoRespuesta.assign(n, -1);
+
+    if (politica == PoliticaTiempoReal::EDF) {
+        if (analisis.utilizacion > 1.0) {
+            analisis.planificable = false;
+            analisis.detalle = "U > 1: ninguna política puede cumplir todos los deadlines.";
+        } else if (!deadlinesRestringidos) {
+            analisis.planificable = true;
+            analisis.detalle = "U <= 1 con deadline >= periodo: EDF es planificable (exacto).";
+        } else if (densidad <= 1.0) {
+            analisis.planificable = true;
+            analisis.detalle = "Densidad <= 1: EDF es planificable.";
+        } else {
+            analisis.concluyente = false;
+            analisis.detalle = "U <= 1 pero densidad > 1: la simulación decide.";
+        }
+        return analisis;
+    }
+
+    // RMS: prioridad por periodo (a igual periodo, el primero de la lista)
+    std::vector<size_t> orden(n);
+    std::iota(orden.begin(), orden.end(), 0);
+    std::stable_sort(orden.begin(), orden.end(), [&](size_t a, size_t b) {
+        return tareas[a].periodo < tareas[b].periodo;
+    });
+
+    // Análisis de tiempo de respuesta (iteración de punto fijo por tarea)
+    bool todasCumplen = true;
+    for (size_t k = 0; k < n; ++k) {
+        const TareaPeriodica& t = tareas[orden[k]];
+        long long respuesta = t.wcet;
+        for (size_t j = 0; j < k; ++j) respuesta += tareas[orden[j]].wcet;
+        while (true) {
+            long long siguiente = t.wcet;
+            for (size_t j = 0; j < k; ++j) {
+                const TareaPeriodica& hp = tareas[orden[j]];
+                siguiente += (respuesta + hp.periodo - 1) / hp.periodo * hp.wcet;
+            }
+            if (siguiente == respuesta || siguiente > t.deadline) {
+                respuesta = siguiente;
+                break;
+            }
+            respuesta = siguiente;
+        }
+        analisis.tiempoRespuesta[orden[k]] = respuesta;
+        todasCumplen &= respuesta <= t.deadline;
+    }
+
+    // Liu-Layland solo vale con deadline >= periodo en todas las tareas
+    const bool cotaAplica = !deadlinesRestringidos && analisis.utilizacion <= analisis.cotaLiuLayland;
+    analisis.planificable = todasCumplen;
+    if (deadlinesArbitrarios) {
+        // Con deadline > periodo varios trabajos de la misma tarea se solapan
+        // y el RTA de un solo trabajo no alcanza
+        analisis.concluyente = cotaAplica;
+        analisis.planificable = cotaAplica;
+        analisis.detalle = cotaAplica
+            ? "U <= cota de Liu-Layland: RMS es planificable."
+            : "Hay deadlines > periodo: la simulación decide.";
+    } else if (!todasCumplen && hayFases) {
+        // Con fases el instante crítico puede no ocurrir: el RTA es pesimista
+        analisis.concluyente = false;
+        analisis.detalle = "El RTA (liberación simultánea) excede algún deadline, pero hay fases: la simulación decide.";
+    } else if (cotaAplica) {
+        analisis.detalle = "U <= cota de Liu-Layland: RMS es planificable.";
+    } else {
+        analisis.detalle = todasCumplen
+            ? "El RTA cumple todos los deadlines: RMS es planificable."
+            : "El RTA excede el deadline de al menos una tarea.";
+    }
+    return analisis;
+}
+
+ResultadoTiempoReal simularTiempoReal(const std::vector<TareaPeriodica>& tareas,
+                                      PoliticaTiempoReal politica,
+                                      long long horizonte,
+                                      ObservadorSimulacion* obs)
+{
+    ResultadoTiempoReal resultado;
+    // --- Programación defensiva ---
+    if (tareas.empty()) {
+        qDebug() << "simularTiempoReal: sin tareas. Abortando.";
+        return resultado;
+    }
+    for (const auto& t : tareas) {
+        if (t.periodo <= 0 || t.wcet <= 0 || t.deadline <= 0 || t.fase < 0) {
+            qDebug() << "simularTiempoReal: tarea inválida" << t.id;
+            return resultado;
+        }
+    }
+    if (horizonte < 0) {
+        qDebug() << "simularTiempoReal: horizonte inválido:" << horizonte;
+        return resultado;
+    }
+    if (horizonte == 0) {
+        horizonte = calcularHiperperiodo(tareas, HORIZONTE_MAXIMO);
+        if (horizonte == 0) {
+            qDebug() << "simularTiempoReal: hiperperiodo mayor que" << HORIZONTE_MAXIMO
+                     << "; se recorta el horizonte.";
+            horizonte = HORIZONTE_MAXIMO;
+        }
+    }
+    horizonte = std::min(horizonte, HORIZONTE_MAXIMO);
+    // --- Fin defensiva ---
+
+    const uint32_t n = static_cast<uint32_t>(tareas.size());
+    resultado.horizonte = horizonte;
+    resultado.tareas.resize(n);
+    for (uint32_t k = 0; k < n; ++k) resultado.tareas[k].id = tareas[k].id;
+
+    // Liberaciones: una entrada por tarea con su próxima liberación
+    priorityQueue<long long> liberaciones(n);
+    for (uint32_t k = 0; k < n; ++k) {
+        if (tareas[k].fase < horizonte) liberaciones.insertNewValue(k, tareas[k].fase);
+    }
+
+    // Trabajos pendientes por tarea (liberaciones en orden FIFO); en el heap
+    // ready solo está el más antiguo de cada tarea, que es también el de
+    // deadline más cercano
+    std::vector<std::deque<long long>> pendientes(n);
+    std::vector<int> restante(n, 0);
+    priorityQueue<std::pair<long long, long long>> ready(n);
+    auto clave = [&](uint32_t k) -> std::pair<long long, long long> {
+        if (politica == PoliticaTiempoReal::EDF) {
+            return {pendientes[k].front() + tareas[k].deadline, 0};
+        }
+        return {tareas[k].periodo, 0};
+    };
+
+    std::vector<long long> sumaLatencia(n, 0);
+    long long tiempo = 0;
+    uint32_t enBloque = 0;      // Tarea del bloque de Gantt abierto
+    long long tickActual = 0;
+
+    auto cerrarBloque = [&]() {
+        if (tickActual > 0) {
+            resultado.bloques.push_back({tareas[enBloque].id,
+                                         static_cast<int>(tiempo - tickActual),
+                                         static_cast<int>(tickActual)});
+        }
+        tickActual = 0;
+    };
+
+    while (true) {
+        // Liberar los trabajos que tocan en este instante
+        while (!liberaciones.isEmpty() && liberaciones.top().clave <= tiempo) {
+            auto lib = liberaciones.pop();
+            const uint32_t k = lib.id;
+            pendientes[k].push_back(lib.clave);
+            if (pendientes[k].size() == 1) {
+                restante[k] = tareas[k].wcet;
+                ready.insertNewValue(k, clave(k));
+            }
+            long long siguiente = lib.clave + tareas[k].periodo;
+            if (siguiente < horizonte) liberaciones.insertNewValue(k, siguiente);
+        }
+
+        if (ready.isEmpty()) {
+            if (liberaciones.isEmpty()) break;
+            tiempo = liberaciones.top().clave; // CPU ociosa
+            continue;
+        }
+
+        // Expropiativo: siempre corre el mejor trabajo listo
+        const uint32_t k = ready.top().id;
+        if (k != enBloque) {
+            cerrarBloque();
+            enBloque = k;
+        }
+
+        long long avance = restante[k];
+        if (!liberaciones.isEmpty()) {
+            avance = std::min(avance, liberaciones.top().clave - tiempo);
+        }
+        if (obs) {
+            obs->tramoEjecutado(tareas[k].id, static_cast<int>(tiempo), static_cast<int>(avance));
+        }
+        tiempo += avance;
+        tickActual += avance;
+        restante[k] -= static_cast<int>(avance);
+        resultado.ciclosOcupado += avance;
+
+        if (restante[k] == 0) {
+            // Fin del trabajo: métricas y, si hay otro pendiente, pasa a ready
+            cerrarBloque();
+            const long long liberado = pendientes[k].front();
+            pendientes[k].pop_front();
+            const long long latencia = tiempo - (liberado + tareas[k].deadline);
+            EstadisticasTarea& est = resultado.tareas[k];
+            est.trabajos++;
+            est.latenciaMaxima = est.trabajos == 1 ? latencia : std::max(est.latenciaMaxima, latencia);
+            est.respuestaMaxima = std::max(est.respuestaMaxima, tiempo - liberado);
+            sumaLatencia[k] += latencia;
+            if (latencia > 0) est.deadlinesPerdidos++;
+            resultado.distribucionLatencia[latencia]++;
+
+            if (pendientes[k].empty()) {
+                ready.deleteValue(k);
+            } else {
+                restante[k] = tareas[k].wcet;
+                ready.increaseKey(k, clave(k));
+            }
+        }
+    }
+
+    for (uint32_t k = 0; k < n; ++k) {
+        EstadisticasTarea& est = resultado.tareas[k];
+        if (est.trabajos > 0) est.latenciaPromedio = static_cast<double>(sumaLatencia[k]) / est.trabajos;
+        resultado.trabajos += est.trabajos;
+        resultado.deadlinesPerdidos += est.deadlinesPerdidos;
+    }
+    // Utilización sobre [0, max(horizonte, fin)): con U <= 1 y el
+    // hiperperiodo como horizonte coincide con Σ wcet / periodo
+    resultado.fin = tiempo;
+    const long long ventana = std::max(horizonte, tiempo);
+    resultado.utilizacionCPU = static_cast<double>(resultado.ciclosOcupado) / ventana;
+    return resultado;
+}
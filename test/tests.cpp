@@ -3,10 +3,31 @@
 #include <string>
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <climits>
+#include <random>
+#include <fstream>
+#include <iterator>
 
 #include "../include/proceso.h"
 #include "../include/algoritmo.h"
 #include "../include/synchronizer.h"
+#include "../include/priorityQueue.h"
+#include "../include/colaBuckets.h"
+#include "../include/arbolFenwick.h"
+#include "../include/percentilDinamico.h"
+#include "../include/smp.h"
+#include "../include/entradaSalida.h"
+#include "../include/barrido.h"
+#include "../include/tiempoReal.h"
+#include "../include/metricas.h"
+#include "../include/comparacion.h"
+#include "../include/puntoControl.h"
+#include "../include/replicacion.h"
+#include "../include/kernelsMetricas.h"
+#include "../include/lineaTiempo.h"
+#include "../include/planificador.h"
+#include "../include/modeloAnalitico.h"
 
 // Función auxiliar: extrae solo la secuencia de PIDs de un vector<Proceso>
 static std::vector<std::string> seq_pids(const std::vector<Proceso>& v) {
@@ -64,48 +85,92 @@ static bool test_fifo_simple() {
 }
 
 static bool test_sjf_simple() {
+    // Todos llegan en 0: orden según burstTime puro: P2 (3), P3 (4), P1 (5)
+    std::vector<Proceso> simultaneos;
+    simultaneos.push_back({ "P1", 5, 0, 1, 0,0,0,0 });
+    simultaneos.push_back({ "P2", 3, 0, 2, 0,0,0,0 });
+    simultaneos.push_back({ "P3", 4, 0, 1, 0,0,0,0 });
+    std::vector<std::string> resSimult = seq_pids(shortestJobFirst(simultaneos, nullptr));
+    if (!igual_seq(resSimult, { "P2", "P3", "P1" })) {
+        std::cout << "  [ERROR] SJF simple (llegada en 0): salida = ";
+        for (auto &x : resSimult) std::cout << x << " ";
+        std::cout << "pero se esperaba P2 P3 P1\n";
+        return false;
+    }
+
+    // Con llegadas: en t=0 solo existe P1; al terminar (t=5) se elige entre
+    // los ya llegados P2 (1) y P4 (3) por ráfaga; P3 llega en 12 (CPU ociosa)
     std::vector<Proceso> procesos;
     Proceso p1{ "P1", 5, 0, 1, 0,0,0,0 };
     Proceso p2{ "P2", 3, 1, 2, 0,0,0,0 };
-    Proceso p3{ "P3", 4, 2, 1, 0,0,0,0 };
+    Proceso p3{ "P3", 1, 12, 1, 0,0,0,0 };
+    Proceso p4{ "P4", 2, 3, 1, 0,0,0,0 };
     procesos.push_back(p1);
     procesos.push_back(p2);
     procesos.push_back(p3);
+    procesos.push_back(p4);
 
     auto result = shortestJobFirst(procesos, nullptr);
     std::vector<std::string> resPids = seq_pids(result);
-    // Ajustado para esperar el orden según burstTime puro: P2 (3), P3 (4), P1 (5)
-    std::vector<std::string> exp = { "P2", "P3", "P1" };
+    std::vector<std::string> exp = { "P1", "P4", "P2", "P3" };
 
     if (!igual_seq(resPids, exp)) {
         std::cout << "  [ERROR] SJF simple: salida = ";
         for (auto &x : resPids) std::cout << x << " ";
-        std::cout << "pero se esperaba P2 P3 P1\n";
+        std::cout << "pero se esperaba P1 P4 P2 P3\n";
         return false;
     }
-    return true;
+    for (auto &p : result) {
+        if (p.waitingTime < 0 || p.startTime < p.arrivalTime) {
+            std::cout << "  [ERROR] SJF simple: " << p.pid.toStdString()
+                      << " inicia antes de llegar\n";
+            return false;
+        }
+    }
+    return result[3].startTime == 12;
 }
 
 static bool test_priority_simple() {
+    // Todos llegan en 0: orden según prioridad pura: P2 (1), P1 (2), P3 (3)
+    std::vector<Proceso> simultaneos;
+    simultaneos.push_back({ "P1", 5, 0, 2, 0,0,0,0 });
+    simultaneos.push_back({ "P2", 3, 0, 1, 0,0,0,0 });
+    simultaneos.push_back({ "P3", 4, 0, 3, 0,0,0,0 });
+    std::vector<std::string> resSimult = seq_pids(priorityScheduling(simultaneos, nullptr));
+    if (!igual_seq(resSimult, { "P2", "P1", "P3" })) {
+        std::cout << "  [ERROR] Priority simple (llegada en 0): salida = ";
+        for (auto &x : resSimult) std::cout << x << " ";
+        std::cout << "pero se esperaba P2 P1 P3\n";
+        return false;
+    }
+
+    // Con llegadas: P1 corre primero (único en t=0); en t=5 ya llegaron
+    // P2 (prio 3) y P3 (prio 1), así que sigue P3
     std::vector<Proceso> procesos;
     Proceso p1{ "P1", 5, 0, 2, 0,0,0,0 };
-    Proceso p2{ "P2", 3, 1, 1, 0,0,0,0 };
-    Proceso p3{ "P3", 4, 2, 3, 0,0,0,0 };
+    Proceso p2{ "P2", 3, 1, 3, 0,0,0,0 };
+    Proceso p3{ "P3", 4, 2, 1, 0,0,0,0 };
     procesos.push_back(p1);
     procesos.push_back(p2);
     procesos.push_back(p3);
 
     auto result = priorityScheduling(procesos, nullptr);
     std::vector<std::string> resPids = seq_pids(result);
-    // Ajustado para esperar el orden según prioridad pura: P2 (1), P1 (2), P3 (3)
-    std::vector<std::string> exp = { "P2", "P1", "P3" };
+    std::vector<std::string> exp = { "P1", "P3", "P2" };
 
     if (!igual_seq(resPids, exp)) {
         std::cout << "  [ERROR] Priority simple: salida = ";
         for (auto &x : resPids) std::cout << x << " ";
-        std::cout << "pero se esperaba P2 P1 P3\n";
+        std::cout << "pero se esperaba P1 P3 P2\n";
         return false;
     }
+    for (auto &p : result) {
+        if (p.waitingTime < 0) {
+            std::cout << "  [ERROR] Priority simple: espera negativa en "
+                      << p.pid.toStdString() << "\n";
+            return false;
+        }
+    }
     return true;
 }
 
@@ -159,6 +224,1701 @@ static bool test_srt_simple() {
     return true;
 }
 
+// Bloques como "PID@inicio+duracion" para comparar diagramas de Gantt
+static std::vector<std::string> bloques_str(const std::vector<BloqueGantt>& bloques) {
+    std::vector<std::string> res;
+    for (auto &b : bloques) {
+        // Los cambios de contexto se marcan con "CS:" delante del proceso entrante
+        res.push_back(std::string(b.tipo == TipoBloque::CambioContexto ? "CS:" : "") + b.pid.toStdString() + "@" + std::to_string(b.inicio) + "+" + std::to_string(b.duracion));
+    }
+    return res;
+}
+
+// Priority expropiativo: preempción por llegada más prioritaria y aging que
+// evita la inanición de un proceso de baja prioridad
+static bool test_preemptive_priority_aging() {
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 10, 0, 3, 0,0,0,0 };
+    Proceso p2{ "P2", 4,  1, 1, 0,0,0,0 };
+    Proceso p3{ "P3", 3,  2, 2, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+    procesos.push_back(p3);
+
+    std::vector<BloqueGantt> bloques;
+    auto result = preemptivePriorityScheduling(procesos, 0, bloques, nullptr);
+    std::vector<std::string> exp = { "P1@0+1", "P2@1+4", "P3@5+3", "P1@8+9" };
+    std::vector<std::string> res;
+    for (auto &b : bloques) {
+        res.push_back(b.pid.toStdString() + "@" + std::to_string(b.inicio) + "+" + std::to_string(b.duracion));
+    }
+    if (!igual_seq(res, exp) || !igual_seq(seq_pids(result), { "P2", "P3", "P1" })) {
+        std::cout << "  [ERROR] Preemptive Priority sin aging: bloques = ";
+        for (auto &x : res) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Flujo continuo de procesos prioridad 1: sin aging P1 (prioridad 2) queda
+    // al final; con aging cada 3 ciclos sube a 1 y pasa delante de P3
+    std::vector<Proceso> flujo;
+    Proceso q1{ "P1", 3, 0, 2, 0,0,0,0 };
+    Proceso q2{ "P2", 4, 0, 1, 0,0,0,0 };
+    Proceso q3{ "P3", 4, 4, 1, 0,0,0,0 };
+    Proceso q4{ "P4", 4, 8, 1, 0,0,0,0 };
+    flujo.push_back(q1);
+    flujo.push_back(q2);
+    flujo.push_back(q3);
+    flujo.push_back(q4);
+
+    std::vector<BloqueGantt> sinAging, conAging;
+    auto resSin = seq_pids(preemptivePriorityScheduling(flujo, 0, sinAging, nullptr));
+    auto resCon = seq_pids(preemptivePriorityScheduling(flujo, 3, conAging, nullptr));
+    if (!igual_seq(resSin, { "P2", "P3", "P4", "P1" }) ||
+        !igual_seq(resCon, { "P2", "P1", "P3", "P4" }) || conAging[1].inicio != 4) {
+        std::cout << "  [ERROR] Preemptive Priority con aging: salida = ";
+        for (auto &x : resCon) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Prioridades enormes: las colas se dimensionan por rangos densos, el aging
+    // sube de a un rango y el motor SMP con 1 CPU da los mismos bloques
+    for (auto &p : flujo) p.priority = p.priority == 2 ? INT_MAX : 1000000000;
+    std::vector<BloqueGantt> enormes;
+    auto resEnormes = seq_pids(preemptivePriorityScheduling(flujo, 3, enormes, nullptr));
+    ParametrosPolitica parametros;
+    parametros.envejecimiento = 3;
+    ResultadoSMP motor = simularMulticore(flujo, Politica::PreemptivePriority, parametros, ConfigSMP());
+    if (!igual_seq(resEnormes, resCon) || !igual_seq(bloques_str(enormes), bloques_str(conAging)) ||
+        !igual_seq(bloques_str(motor.bloques), bloques_str(conAging))) {
+        std::cout << "  [ERROR] Preemptive Priority con prioridades INT_MAX y 1e9: salida = ";
+        for (auto &x : resEnormes) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // colaBuckets con más de 64 niveles (bitmap de dos niveles), FIFO por nivel
+    colaBuckets cola(200, 0);
+    cola.pushBack(0, 150);
+    cola.pushBack(1, 70);
+    cola.pushBack(2, 150);
+    bool okMejor = cola.mejorNivel() == 70;
+    cola.remove(1);
+    bool okFifo = cola.mejorNivel() == 150 && cola.popMejor() == 0 && cola.popMejor() == 2;
+    if (!okMejor || !okFifo || !cola.isEmpty() || cola.mejorNivel() != -1) {
+        std::cout << "  [ERROR] colaBuckets: selección por bitmap incorrecta\n";
+        return false;
+    }
+    return true;
+}
+
+// MLFQ: degradación al agotar el quantum, boost periódico contra la
+// inanición y equivalencia con Round Robin cuando hay un solo nivel
+static bool test_mlfq() {
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 6, 0, 1, 0,0,0,0 };
+    Proceso p2{ "P2", 2, 1, 1, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+
+    // P1 agota su quantum de nivel 0 (2) y baja al nivel 1 (quantum 4)
+    std::vector<BloqueGantt> bloques;
+    multilevelFeedbackQueue(procesos, { 2, 4 }, 0, bloques, nullptr);
+    std::vector<std::string> exp = { "P1@0+2", "P2@2+2", "P1@4+4" };
+    if (!igual_seq(bloques_str(bloques), exp)) {
+        std::cout << "  [ERROR] MLFQ degradación: bloques = ";
+        for (auto &x : bloques_str(bloques)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Un proceso largo en el nivel 1 frente a un flujo de procesos cortos:
+    // sin boost vuelve a la CPU en t=6, con boost cada 3 ciclos en t=4
+    std::vector<Proceso> flujo;
+    Proceso largo{ "P1", 5, 0, 1, 0,0,0,0 };
+    flujo.push_back(largo);
+    for (int k = 1; k <= 5; k++) {
+        flujo.push_back(Proceso{ QString("P%1").arg(k + 1), 1, k, 1, 0,0,0,0 });
+    }
+    std::vector<BloqueGantt> sinBoost, conBoost;
+    multilevelFeedbackQueue(flujo, { 1, 50 }, 0, sinBoost, nullptr);
+    multilevelFeedbackQueue(flujo, { 1, 50 }, 3, conBoost, nullptr);
+    if (sinBoost.size() < 7 || sinBoost[6].pid != "P1" || sinBoost[6].inicio != 6 ||
+        conBoost.size() < 5 || conBoost[4].pid != "P1" || conBoost[4].inicio != 4) {
+        std::cout << "  [ERROR] MLFQ boost: bloques = ";
+        for (auto &x : bloques_str(conBoost)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Con un solo nivel y sin boost, MLFQ es exactamente Round Robin
+    std::vector<BloqueGantt> bloquesRR, bloquesMLFQ;
+    roundRobin(flujo, 2, bloquesRR, nullptr);
+    multilevelFeedbackQueue(flujo, { 2 }, 0, bloquesMLFQ, nullptr);
+    if (!igual_seq(bloques_str(bloquesRR), bloques_str(bloquesMLFQ))) {
+        std::cout << "  [ERROR] MLFQ de un nivel distinto de Round Robin\n";
+        return false;
+    }
+
+    // Boost frecuente sobre muchos procesos: el motor SMP con 1 CPU (colaBuckets
+    // por núcleo y niveles por época) da los mismos bloques
+    std::vector<Proceso> muchos;
+    for (int k = 0; k < 300; ++k) {
+        muchos.push_back({ QString("P%1").arg(k + 1), 1 + (k * 37) % 60, k * 3, 1, 0,0,0,0 });
+    }
+    std::vector<BloqueGantt> bloquesBoost;
+    multilevelFeedbackQueue(muchos, { 2, 4, 8 }, 50, bloquesBoost, nullptr);
+    ParametrosPolitica parametros;
+    parametros.quantumPorNivel = { 2, 4, 8 };
+    parametros.periodoBoost = 50;
+    ResultadoSMP motor = simularMulticore(muchos, Politica::MLFQ, parametros, ConfigSMP());
+    if (!igual_seq(bloques_str(motor.bloques), bloques_str(bloquesBoost))) {
+        std::cout << "  [ERROR] MLFQ con boost: motor SMP distinto de multilevelFeedbackQueue\n";
+        return false;
+    }
+
+    // Un hueco ocioso de 10^8 ciclos con boost cada 3 salta los boosts vencidos
+    // de una vez y coincide con el motor SMP
+    std::vector<Proceso> conHueco = {
+        { "P1", 5, 0, 1, 0,0,0,0 },
+        { "P2", 5, 100000000, 1, 0,0,0,0 },
+        { "P3", 4, 100000001, 1, 0,0,0,0 }
+    };
+    std::vector<BloqueGantt> bloquesHueco;
+    multilevelFeedbackQueue(conHueco, { 1, 2 }, 3, bloquesHueco, nullptr);
+    parametros.quantumPorNivel = { 1, 2 };
+    parametros.periodoBoost = 3;
+    ResultadoSMP motorHueco = simularMulticore(conHueco, Politica::MLFQ, parametros, ConfigSMP());
+    if (bloquesHueco.empty() || bloquesHueco.back().inicio + bloquesHueco.back().duracion != 100000009 ||
+        !igual_seq(bloques_str(motorHueco.bloques), bloques_str(bloquesHueco))) {
+        std::cout << "  [ERROR] MLFQ: boost tras un hueco ocioso\n";
+        return false;
+    }
+
+    // promoverTodos no reetiqueta: el nivel de los encolados se lee por época
+    colaBuckets cola(3, 4);
+    cola.pushBack(0, 2);
+    cola.pushBack(1, 1);
+    cola.promoverTodos(0);
+    cola.pushBack(2, 1);
+    if (cola.nivelDe(0) != 0 || cola.nivelDe(1) != 0 || cola.nivelDe(2) != 1 ||
+        cola.enOrden() != std::vector<uint32_t>{ 1, 0, 2 } || !cola.remove(0) || cola.popMejor() != 1 ||
+        cola.mejorNivel() != 1) {
+        std::cout << "  [ERROR] colaBuckets: niveles tras promoverTodos\n";
+        return false;
+    }
+    return true;
+}
+
+// CFS: reparto por vruntime (slices de latencia / n con pesos iguales) y
+// desviación de cuota menor que la de Round Robin con prioridades distintas
+static bool test_cfs() {
+    std::vector<Proceso> iguales;
+    Proceso p1{ "P1", 12, 0, 0, 0,0,0,0 };
+    Proceso p2{ "P2", 12, 0, 0, 0,0,0,0 };
+    iguales.push_back(p1);
+    iguales.push_back(p2);
+
+    std::vector<BloqueGantt> bloques;
+    completelyFairScheduler(iguales, 6, 1, bloques, nullptr);
+    std::vector<std::string> exp = { "P1@0+3", "P2@3+3", "P1@6+3", "P2@9+3",
+                                     "P1@12+3", "P2@15+3", "P1@18+3", "P2@21+3" };
+    if (!igual_seq(bloques_str(bloques), exp)) {
+        std::cout << "  [ERROR] CFS pesos iguales: bloques = ";
+        for (auto &x : bloques_str(bloques)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Prioridad 0 (peso 1024) frente a prioridad 5 (peso 335)
+    std::vector<Proceso> ponderados;
+    Proceso q1{ "P1", 40, 0, 0, 0,0,0,0 };
+    Proceso q2{ "P2", 40, 0, 5, 0,0,0,0 };
+    ponderados.push_back(q1);
+    ponderados.push_back(q2);
+    std::vector<BloqueGantt> bloquesCFS, bloquesRR;
+    auto resCFS = completelyFairScheduler(ponderados, 12, 1, bloquesCFS, nullptr);
+    auto resRR = roundRobin(ponderados, 4, bloquesRR, nullptr);
+    double maxCFS = 0.0, maxRR = 0.0;
+    for (double d : calcularDesviacionCuota(resCFS)) maxCFS = std::max(maxCFS, std::fabs(d));
+    for (double d : calcularDesviacionCuota(resRR)) maxRR = std::max(maxRR, std::fabs(d));
+    if (resCFS.size() != 2 || resCFS[0].pid != "P1" || maxCFS > 0.05 || maxRR < 0.25) {
+        std::cout << "  [ERROR] CFS ponderado: desviación CFS = " << maxCFS
+                  << ", RR = " << maxRR << "\n";
+        return false;
+    }
+    return true;
+}
+
+// SMP: con un núcleo reproduce los algoritmos de un solo CPU; con dos, el
+// núcleo ocioso roba trabajo de la cola más cargada
+static bool test_lottery_stride() {
+    // Fenwick: tickets {3, 0, 5, 2} -> boletos 0..2 = id 0, 3..7 = id 2, 8..9 = id 3
+    arbolFenwick tickets(4);
+    tickets.asignar(0, 3);
+    tickets.asignar(2, 5);
+    tickets.asignar(3, 2);
+    if (tickets.total() != 10 || tickets.buscar(0) != 0 || tickets.buscar(2) != 0 ||
+        tickets.buscar(3) != 2 || tickets.buscar(7) != 2 || tickets.buscar(9) != 3) {
+        std::cout << "  [ERROR] arbolFenwick: búsqueda de boleto incorrecta\n";
+        return false;
+    }
+    tickets.asignar(2, 0);
+    if (tickets.total() != 5 || tickets.buscar(3) != 3) {
+        std::cout << "  [ERROR] arbolFenwick: baja de tickets incorrecta\n";
+        return false;
+    }
+
+    // Stride con tickets iguales alterna quantum a quantum
+    std::vector<Proceso> iguales;
+    Proceso p1{ "P1", 4, 0, 0, 0,0,0,0 };
+    Proceso p2{ "P2", 4, 0, 0, 0,0,0,0 };
+    iguales.push_back(p1);
+    iguales.push_back(p2);
+    std::vector<BloqueGantt> bloques;
+    strideScheduling(iguales, 2, bloques, nullptr);
+    std::vector<std::string> exp = { "P1@0+2", "P2@2+2", "P1@4+2", "P2@6+2" };
+    if (!igual_seq(bloques_str(bloques), exp)) {
+        std::cout << "  [ERROR] Stride tickets iguales: bloques = ";
+        for (auto &x : bloques_str(bloques)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Prioridad 0 (1024 tickets) frente a 5 (335): mientras ambos están en el
+    // sistema P1 debe recibir 1024 / 1359 de la CPU
+    std::vector<Proceso> ponderados;
+    Proceso q1{ "P1", 4000, 0, 0, 0,0,0,0 };
+    Proceso q2{ "P2", 4000, 0, 5, 0,0,0,0 };
+    ponderados.push_back(q1);
+    ponderados.push_back(q2);
+    std::vector<BloqueGantt> bloquesStride, bloquesLoteria, bloquesLoteria2;
+    auto resStride = strideScheduling(ponderados, 1, bloquesStride, nullptr);
+    auto resLoteria = lotteryScheduling(ponderados, 1, 42, bloquesLoteria, nullptr);
+    lotteryScheduling(ponderados, 1, 42, bloquesLoteria2, nullptr);
+    std::vector<CuotaProceso> cuotasStride = calcularCuotas(resStride);
+    std::vector<CuotaProceso> cuotasLoteria = calcularCuotas(resLoteria);
+    const double objetivo = 1024.0 / 1359.0;
+    if (resStride[0].pid != "P1" || resLoteria[0].pid != "P1" ||
+        std::fabs(cuotasStride[0].objetivo - objetivo) > 1e-9 ||
+        std::fabs(cuotasStride[0].obtenida - objetivo) > 0.01 ||
+        std::fabs(cuotasLoteria[0].obtenida - objetivo) > 0.03) {
+        std::cout << "  [ERROR] Cuota de P1: stride " << cuotasStride[0].obtenida
+                  << ", lottery " << cuotasLoteria[0].obtenida << " (objetivo " << objetivo << ")\n";
+        return false;
+    }
+
+    // Misma semilla, misma ejecución
+    if (!igual_seq(bloques_str(bloquesLoteria), bloques_str(bloquesLoteria2))) {
+        std::cout << "  [ERROR] Lottery no es reproducible con la misma semilla\n";
+        return false;
+    }
+
+    // En el motor con 1 CPU, el mismo sorteo; con 2 CPUs cada núcleo sortea su cola
+    ParametrosPolitica parametros;
+    parametros.quantum = 1;
+    parametros.semillaLoteria = 42;
+    ResultadoSMP motor = simularMulticore(ponderados, Politica::Lottery, parametros, ConfigSMP());
+    ConfigSMP dosNucleos;
+    dosNucleos.numCPUs = 2;
+    ponderados.push_back({ "P3", 50, 10, 2, 0,0,0,0 });
+    ResultadoSMP dos = simularMulticore(ponderados, Politica::Lottery, parametros, dosNucleos);
+    ResultadoSMP dosOtraVez = simularMulticore(ponderados, Politica::Lottery, parametros, dosNucleos);
+    if (!igual_seq(bloques_str(motor.bloques), bloques_str(bloquesLoteria)) || dos.procesos.size() != 3 ||
+        !igual_seq(bloques_str(dos.bloques), bloques_str(dosOtraVez.bloques)) || dos.makespan >= 8000) {
+        std::cout << "  [ERROR] Lottery en el motor SMP\n";
+        return false;
+    }
+    return true;
+}
+
+static bool test_rr_adaptativo() {
+    // Percentil dinámico: mediana y p90 con altas y bajas
+    percentilDinamico mediana(50, 8), p90(90, 8);
+    const int claves[] = { 7, 3, 9, 1, 5 };
+    for (uint32_t id = 0; id < 5; ++id) {
+        mediana.insertar(id, claves[id]);
+        p90.insertar(id, claves[id]);
+    }
+    if (mediana.valor() != 5 || p90.valor() != 9) {
+        std::cout << "  [ERROR] Percentil dinámico: mediana " << mediana.valor() << ", p90 " << p90.valor() << "\n";
+        return false;
+    }
+    mediana.quitar(4); // Sin el 5: {1,3,7,9} -> la 2.ª menor
+    p90.quitar(2);     // Sin el 9: {1,3,5,7} -> la 4.ª menor
+    if (mediana.valor() != 3 || p90.valor() != 7 || mediana.size() != 4 || mediana.contains(4)) {
+        std::cout << "  [ERROR] Percentil dinámico tras quitar: " << mediana.valor() << " / " << p90.valor() << "\n";
+        return false;
+    }
+
+    // Restantes {10, 2, 4}: quantum 4 (mediana); luego {2, 4, 6} -> 4,
+    // {4, 6} -> 4 y {6} -> 6. Cuatro bloques y tres cambios de contexto
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 10, 0, 1, 0,0,0,0 };
+    Proceso p2{ "P2", 2,  0, 1, 0,0,0,0 };
+    Proceso p3{ "P3", 4,  0, 1, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+    procesos.push_back(p3);
+    std::vector<BloqueGantt> bloques;
+    roundRobinAdaptativo(procesos, 50, bloques, nullptr);
+    std::vector<std::string> exp = { "P1@0+4", "P2@4+2", "P3@6+4", "P1@10+6" };
+    if (!igual_seq(bloques_str(bloques), exp) || contarCambiosContexto({}, bloques) != 3) {
+        std::cout << "  [ERROR] RR adaptativo: bloques = ";
+        for (auto &x : bloques_str(bloques)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Percentil 100: el quantum cubre al más largo y queda FIFO
+    std::vector<BloqueGantt> bloquesFIFO;
+    roundRobinAdaptativo(procesos, 100, bloquesFIFO, nullptr);
+    if (!igual_seq(bloques_str(bloquesFIFO), { "P1@0+10", "P2@10+2", "P3@12+4" })) {
+        std::cout << "  [ERROR] RR adaptativo con percentil 100 distinto de FIFO\n";
+        return false;
+    }
+
+    // El motor multicore con 1 CPU da los mismos bloques
+    ParametrosPolitica parametros;
+    parametros.percentilQuantum = 50;
+    ResultadoSMP motor = simularMulticore(procesos, Politica::RoundRobinAdaptativo, parametros, ConfigSMP());
+    if (!igual_seq(bloques_str(motor.bloques), exp) || motor.cambiosContexto != 3) {
+        std::cout << "  [ERROR] RR adaptativo en simularMulticore: bloques = ";
+        for (auto &x : bloques_str(motor.bloques)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+    return true;
+}
+
+static bool test_tiempo_real() {
+    // U = 2/5 + 4/7 = 0.971: EDF cumple, RMS pierde un deadline de T2
+    std::vector<TareaPeriodica> tareas;
+    TareaPeriodica t1{ "T1", 5, 2, 5, 0 };
+    TareaPeriodica t2{ "T2", 7, 4, 7, 0 };
+    tareas.push_back(t1);
+    tareas.push_back(t2);
+
+    AnalisisTiempoReal analisisEDF = analizarPlanificabilidad(tareas, PoliticaTiempoReal::EDF);
+    AnalisisTiempoReal analisisRMS = analizarPlanificabilidad(tareas, PoliticaTiempoReal::RMS);
+    if (!analisisEDF.planificable || !analisisEDF.concluyente ||
+        analisisRMS.planificable || !analisisRMS.concluyente ||
+        analisisRMS.tiempoRespuesta[0] != 2 || analisisRMS.tiempoRespuesta[1] != 8 ||
+        std::fabs(analisisRMS.cotaLiuLayland - 2.0 * (std::sqrt(2.0) - 1.0)) > 1e-9) {
+        std::cout << "  [ERROR] Pre-chequeo: EDF " << analisisEDF.planificable
+                  << ", RMS " << analisisRMS.planificable << " (R2 = "
+                  << analisisRMS.tiempoRespuesta[1] << ")\n";
+        return false;
+    }
+
+    // Hiperperiodo 35: 7 trabajos de T1 y 5 de T2, 34 ciclos ocupados
+    ResultadoTiempoReal edf = simularTiempoReal(tareas, PoliticaTiempoReal::EDF);
+    if (edf.horizonte != 35 || edf.trabajos != 12 || edf.deadlinesPerdidos != 0 ||
+        edf.ciclosOcupado != 34 || std::fabs(edf.utilizacionCPU - 34.0 / 35.0) > 1e-9) {
+        std::cout << "  [ERROR] EDF: trabajos " << edf.trabajos << ", perdidos "
+                  << edf.deadlinesPerdidos << ", ocupado " << edf.ciclosOcupado << "\n";
+        return false;
+    }
+
+    // RMS: T1 expropia a T2 en t=5 y el primer trabajo de T2 termina en 8 (deadline 7)
+    ResultadoTiempoReal rms = simularTiempoReal(tareas, PoliticaTiempoReal::RMS);
+    std::vector<BloqueGantt> primeros(rms.bloques.begin(), rms.bloques.begin() + 4);
+    std::vector<std::string> exp = { "T1@0+2", "T2@2+3", "T1@5+2", "T2@7+1" };
+    if (!igual_seq(bloques_str(primeros), exp)) {
+        std::cout << "  [ERROR] RMS: bloques = ";
+        for (auto &x : bloques_str(primeros)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+    if (rms.deadlinesPerdidos != 1 || rms.tareas[1].deadlinesPerdidos != 1 ||
+        rms.tareas[1].latenciaMaxima != 1 || rms.tareas[1].respuestaMaxima != 8 ||
+        rms.distribucionLatencia[1] != 1) {
+        std::cout << "  [ERROR] RMS: deadlines perdidos " << rms.deadlinesPerdidos
+                  << ", latencia máxima T2 " << rms.tareas[1].latenciaMaxima << "\n";
+        return false;
+    }
+    return true;
+}
+
+static bool test_smp() {
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 10, 0, 1, 0,0,0,0 };
+    Proceso p2{ "P2", 2,  0, 1, 0,0,0,0 };
+    Proceso p3{ "P3", 5,  0, 1, 0,0,0,0 };
+    Proceso p4{ "P4", 5,  0, 1, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+    procesos.push_back(p3);
+    procesos.push_back(p4);
+
+    ParametrosPolitica parametros;
+    parametros.quantum = 3;
+    ConfigSMP unNucleo;
+    std::vector<BloqueGantt> bloquesRR;
+    roundRobin(procesos, 3, bloquesRR, nullptr);
+    ResultadoSMP rr = simularMulticore(procesos, Politica::RoundRobin, parametros, unNucleo);
+    if (!igual_seq(bloques_str(rr.bloques), bloques_str(bloquesRR))) {
+        std::cout << "  [ERROR] SMP con 1 CPU distinto de Round Robin\n";
+        return false;
+    }
+
+    // 2 CPUs FIFO: P1,P3 -> CPU0 y P2,P4 -> CPU1. En t=7 la CPU1 queda ociosa
+    // y roba P3 (termina en 12); sin robo P3 espera a P1 (termina en 15)
+    ConfigSMP dosNucleos;
+    dosNucleos.numCPUs = 2;
+    ResultadoSMP conRobo = simularMulticore(procesos, Politica::FIFO, parametros, dosNucleos);
+    dosNucleos.robarTrabajo = false;
+    ResultadoSMP sinRobo = simularMulticore(procesos, Politica::FIFO, parametros, dosNucleos);
+    if (conRobo.makespan != 12 || conRobo.migraciones != 1 ||
+        conRobo.cpus[1].migracionesEntrantes != 1 ||
+        sinRobo.makespan != 15 || sinRobo.migraciones != 0) {
+        std::cout << "  [ERROR] SMP robo de trabajo: makespan " << conRobo.makespan
+                  << " / " << sinRobo.makespan << ", migraciones " << conRobo.migraciones << "\n";
+        return false;
+    }
+    // Con robo ambas CPUs quedan ocupadas 10 y 12 de 12 ciclos
+    if (conRobo.cpus[0].ciclosOcupado != 10 || conRobo.cpus[1].ciclosOcupado != 12 ||
+        std::fabs(conRobo.desbalanceCarga - (12.0 / 11.0 - 1.0)) > 1e-9) {
+        std::cout << "  [ERROR] SMP utilización por núcleo incorrecta\n";
+        return false;
+    }
+
+    // Penalización de migración: un proceso que ya corrió en CPU0 y es robado
+    // por CPU1 paga los ciclos extra
+    std::vector<Proceso> rrMigra;
+    Proceso q1{ "P1", 4, 0, 1, 0,0,0,0 };
+    Proceso q2{ "P2", 4, 0, 1, 0,0,0,0 };
+    Proceso q3{ "P3", 4, 0, 1, 0,0,0,0 };
+    Proceso q4{ "P4", 1, 0, 1, 0,0,0,0 };
+    rrMigra.push_back(q1);
+    rrMigra.push_back(q2);
+    rrMigra.push_back(q3);
+    rrMigra.push_back(q4);
+    parametros.quantum = 2;
+    ConfigSMP conPenalizacion;
+    conPenalizacion.numCPUs = 2;
+    conPenalizacion.penalizacionMigracion = 3;
+    ResultadoSMP migra = simularMulticore(rrMigra, Politica::RoundRobin, parametros, conPenalizacion);
+    long long ocupado = migra.cpus[0].ciclosOcupado + migra.cpus[1].ciclosOcupado;
+    if (migra.ciclosMigracion <= 0 || ocupado != 13 + migra.ciclosMigracion) {
+        std::cout << "  [ERROR] SMP penalización de migración: " << migra.ciclosMigracion << " ciclos\n";
+        return false;
+    }
+    return true;
+}
+
+static bool test_entrada_salida() {
+    // P1: CPU 2, DISCO 3, CPU 1 y P2: CPU 2, DISCO 2, CPU 2 (FIFO, 1 CPU).
+    // Mientras P1 hace E/S corre P2; P2 espera 1 ciclo el disco ocupado
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 3, 0, 1, 0,0,0,0 };
+    Proceso p2{ "P2", 4, 0, 0, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+    std::vector<PerfilES> perfiles(2);
+    perfiles[0].rafagasCPU = { 2, 1 };
+    perfiles[0].rafagasES  = { { 0, 3 } };
+    perfiles[1].rafagasCPU = { 2, 2 };
+    perfiles[1].rafagasES  = { { 0, 2 } };
+    std::vector<Dispositivo> disco(1);
+    disco[0].nombre = "DISCO";
+
+    ParametrosPolitica parametros;
+    ConfigSMP unNucleo;
+    ResultadoES fifoES = simularConES(procesos, perfiles, disco, Politica::FIFO, parametros, unNucleo);
+    std::vector<std::string> expCPU = { "P1@0+2", "P2@2+2", "P1@5+1", "P2@7+2" };
+    std::vector<std::string> expES  = { "P1@2+3", "P2@5+2" };
+    if (!igual_seq(bloques_str(fifoES.cpu.bloques), expCPU) ||
+        !igual_seq(bloques_str(fifoES.bloquesES), expES)) {
+        std::cout << "  [ERROR] E/S: bloques = ";
+        for (auto &x : bloques_str(fifoES.cpu.bloques)) std::cout << x << " ";
+        std::cout << "| ";
+        for (auto &x : bloques_str(fifoES.bloquesES)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+    // Espera = turnaround - CPU - E/S: P1 nunca espera, P2 espera 2 (ready) + 1 (disco)
+    if (fifoES.cpu.makespan != 9 || fifoES.cpu.procesos[0].waitingTime != 0 ||
+        fifoES.cpu.procesos[1].waitingTime != 3 ||
+        std::fabs(fifoES.utilizacionCPU - 7.0 / 9.0) > 1e-9 ||
+        std::fabs(fifoES.dispositivos[0].utilizacion - 5.0 / 9.0) > 1e-9 ||
+        std::fabs(fifoES.dispositivos[0].esperaPromedio - 0.5) > 1e-9 ||
+        std::fabs(fifoES.throughput - 2.0 / 9.0) > 1e-9) {
+        std::cout << "  [ERROR] E/S: makespan " << fifoES.cpu.makespan
+                  << ", utilización CPU " << fifoES.utilizacionCPU
+                  << ", throughput " << fifoES.throughput << "\n";
+        return false;
+    }
+
+    // Cola del disco por prioridad: P3 (prioridad 0) pasa delante de P2 (1)
+    std::vector<Proceso> tres;
+    Proceso q1{ "P1", 2, 0, 2, 0,0,0,0 };
+    Proceso q2{ "P2", 2, 0, 1, 0,0,0,0 };
+    Proceso q3{ "P3", 2, 0, 0, 0,0,0,0 };
+    tres.push_back(q1);
+    tres.push_back(q2);
+    tres.push_back(q3);
+    std::vector<PerfilES> perfilesTres(3);
+    for (int k = 0; k < 3; ++k) {
+        perfilesTres[k].rafagasCPU = { 1, 1 };
+        perfilesTres[k].rafagasES  = { { 0, k == 0 ? 4 : 2 } };
+    }
+    ResultadoES fcfs = simularConES(tres, perfilesTres, disco, Politica::FIFO, parametros, unNucleo);
+    disco[0].disciplina = DisciplinaES::Prioridad;
+    ResultadoES porPrioridad = simularConES(tres, perfilesTres, disco, Politica::FIFO, parametros, unNucleo);
+    if (!igual_seq(bloques_str(fcfs.bloquesES), { "P1@1+4", "P2@5+2", "P3@7+2" }) ||
+        !igual_seq(bloques_str(porPrioridad.bloquesES), { "P1@1+4", "P3@5+2", "P2@7+2" })) {
+        std::cout << "  [ERROR] E/S: disciplina del dispositivo ignorada\n";
+        return false;
+    }
+
+    // Sin ráfagas de E/S reproduce simularMulticore
+    std::vector<PerfilES> sinES(2);
+    sinES[0].rafagasCPU = { 3 };
+    sinES[1].rafagasCPU = { 4 };
+    parametros.quantum = 2;
+    ResultadoES rrES = simularConES(procesos, sinES, {}, Politica::RoundRobin, parametros, unNucleo);
+    ResultadoSMP rr = simularMulticore(procesos, Politica::RoundRobin, parametros, unNucleo);
+    if (!igual_seq(bloques_str(rrES.cpu.bloques), bloques_str(rr.bloques)) ||
+        std::fabs(rrES.utilizacionCPU - 1.0) > 1e-9) {
+        std::cout << "  [ERROR] E/S: sin E/S difiere de simularMulticore\n";
+        return false;
+    }
+    return true;
+}
+
+static bool test_cambio_contexto() {
+    // RR q=2, costo 1 entre procesos: P1 P2 P1 P2 P1 con 4 cambios de 1 ciclo
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 5, 0, 1, 0,0,0,0 };
+    Proceso p2{ "P2", 3, 0, 1, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+
+    ParametrosPolitica parametros;
+    parametros.quantum = 2;
+    ConfigSMP conCosto;
+    conCosto.costoCambioContexto = 1;
+    ResultadoSMP rr = simularMulticore(procesos, Politica::RoundRobin, parametros, conCosto);
+    std::vector<std::string> exp = { "P1@0+2", "CS:P2@2+1", "P2@3+2", "CS:P1@5+1", "P1@6+2",
+                                     "CS:P2@8+1", "P2@9+1", "CS:P1@10+1", "P1@11+1" };
+    if (!igual_seq(bloques_str(rr.bloques), exp) || rr.cambiosContexto != 4 ||
+        rr.ciclosCambio != 4 || rr.makespan != 12 || rr.cpus[0].ciclosOcupado != 8) {
+        std::cout << "  [ERROR] Cambio de contexto RR: bloques = ";
+        for (auto &x : bloques_str(rr.bloques)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Mismas métricas que barridoQuantumRR para cada quantum
+    std::vector<PuntoBarrido> puntos = barridoQuantumRR(procesos, 1, 5, {1}, 1);
+    for (const PuntoBarrido& punto : puntos) {
+        parametros.quantum = punto.quantum;
+        ResultadoSMP r = simularMulticore(procesos, Politica::RoundRobin, parametros, conCosto);
+        double espera = 0.0;
+        for (const auto& p : r.procesos) espera += p.waitingTime;
+        espera /= r.procesos.size();
+        if (r.cambiosContexto != punto.cambiosContexto ||
+            std::fabs(espera - punto.esperaPromedio) > 1e-9) {
+            std::cout << "  [ERROR] Cambio de contexto q=" << punto.quantum << ": espera " << espera
+                      << ", barrido " << punto.esperaPromedio << "\n";
+            return false;
+        }
+    }
+
+    // Costo al mismo proceso: RR sin rivales paga cada fin de quantum
+    std::vector<Proceso> solo = { p1 };
+    ConfigSMP mismo;
+    mismo.costoMismoProceso = 1;
+    parametros.quantum = 2;
+    ResultadoSMP unico = simularMulticore(solo, Politica::RoundRobin, parametros, mismo);
+    if (unico.redespachos != 2 || unico.cambiosContexto != 0 || unico.ciclosCambio != 2 ||
+        unico.procesos[0].completionTime != 7) {
+        std::cout << "  [ERROR] Cambio al mismo proceso: fin " << unico.procesos[0].completionTime << "\n";
+        return false;
+    }
+
+    // SRT, costo 2: P3 llega en t=4 mientras se carga P1 y lo expropia;
+    // solo se pierde el ciclo ya gastado (3..4)
+    std::vector<Proceso> srt;
+    Proceso q1{ "P1", 5, 0, 1, 0,0,0,0 };
+    Proceso q2{ "P2", 3, 0, 1, 0,0,0,0 };
+    Proceso q3{ "P3", 1, 4, 1, 0,0,0,0 };
+    srt.push_back(q1);
+    srt.push_back(q2);
+    srt.push_back(q3);
+    ConfigSMP costoDos;
+    costoDos.costoCambioContexto = 2;
+    ResultadoSMP expropiado = simularMulticore(srt, Politica::SRT, parametros, costoDos);
+    std::vector<std::string> expSRT = { "P2@0+3", "CS:P1@3+1", "CS:P3@4+2", "P3@6+1",
+                                        "CS:P1@7+2", "P1@9+5" };
+    if (!igual_seq(bloques_str(expropiado.bloques), expSRT) ||
+        expropiado.cambiosContexto != 3 || expropiado.ciclosCambio != 5) {
+        std::cout << "  [ERROR] Cambio de contexto SRT: bloques = ";
+        for (auto &x : bloques_str(expropiado.bloques)) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    // Sin costo cuenta los cambios pero no altera la planificación
+    ResultadoSMP gratis = simularMulticore(procesos, Politica::RoundRobin, parametros, ConfigSMP());
+    std::vector<BloqueGantt> bloquesRR;
+    roundRobin(procesos, 2, bloquesRR, nullptr);
+    if (!igual_seq(bloques_str(gratis.bloques), bloques_str(bloquesRR)) ||
+        gratis.cambiosContexto != 4 || gratis.ciclosCambio != 0 ||
+        contarCambiosContexto(procesos, bloquesRR) != 4 ||
+        contarCambiosContexto(fifo(procesos), {}) != 1) {
+        std::cout << "  [ERROR] Cambio de contexto sin costo altera Round Robin\n";
+        return false;
+    }
+    return true;
+}
+
+// Percentiles en streaming (histograma de memoria fija) e índice de Jain
+static bool test_metricas() {
+    // Valores < 256 exactos; más arriba, error relativo < 1 %
+    histogramaLatencia chicos;
+    for (int v = 0; v < 100; ++v) chicos.registrar(v);
+    histogramaLatencia grandes;
+    for (int v = 1; v <= 100000; ++v) grandes.registrar(v);
+    grandes.registrar(1000000000000LL);
+    if (chicos.percentil(50) != 49 || chicos.percentil(99) != 98 || chicos.maximo() != 99 ||
+        std::fabs(chicos.promedio() - 49.5) > 1e-9 ||
+        std::fabs(grandes.percentil(50) - 50000.0) > 500.0 ||
+        std::fabs(grandes.percentil(99) - 99000.0) > 990.0 ||
+        grandes.percentil(100) != 1000000000000LL || grandes.cantidad() != 100001) {
+        std::cout << "  [ERROR] Histograma: p50 " << grandes.percentil(50)
+                  << ", p99 " << grandes.percentil(99) << "\n";
+        return false;
+    }
+
+    // FIFO: P1 (5) espera 0, P2 (3) espera 5; cuotas x = 5/5 y 3/8
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 5, 0, 1, 0,0,0,0 };
+    Proceso p2{ "P2", 3, 0, 1, 0,0,0,0 };
+    Proceso p3{ "P3", 2, 6, 1, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+    MetricasEjecucion fifoM = calcularMetricas(fifo(procesos));
+    const double jain = (1.0 + 0.375) * (1.0 + 0.375) / (2.0 * (1.0 + 0.375 * 0.375));
+    if (fifoM.procesos != 2 || fifoM.espera.p50 != 0 || fifoM.espera.maximo != 5 ||
+        fifoM.turnaround.p99 != 8 || fifoM.respuesta.maximo != 5 || fifoM.makespan != 8 ||
+        std::fabs(fifoM.throughput - 0.25) > 1e-9 || std::fabs(fifoM.indiceJain - jain) > 1e-9) {
+        std::cout << "  [ERROR] Métricas FIFO: Jain " << fifoM.indiceJain << "\n";
+        return false;
+    }
+
+    // El motor acumula al terminar cada proceso lo mismo que una pasada sobre
+    // el resultado; en modo solo agregados no arma procesos ni bloques
+    procesos.push_back(p3);
+    ParametrosPolitica parametros;
+    parametros.quantum = 2;
+    ConfigSMP soloAgregados;
+    soloAgregados.soloAgregados = true;
+    for (Politica politica : { Politica::RoundRobin, Politica::SRT, Politica::CFS }) {
+        ResultadoSMP completo = simularMulticore(procesos, politica, parametros, ConfigSMP());
+        ResultadoSMP agregado = simularMulticore(procesos, politica, parametros, soloAgregados);
+        MetricasEjecucion esperado = calcularMetricas(completo.procesos);
+        const MetricasEjecucion& m = agregado.metricas;
+        if (!agregado.procesos.empty() || !agregado.bloques.empty() || m.procesos != 3 ||
+            m.espera.p90 != esperado.espera.p90 || m.turnaround.p50 != esperado.turnaround.p50 ||
+            m.respuesta.maximo != esperado.respuesta.maximo ||
+            std::fabs(m.espera.promedio - esperado.espera.promedio) > 1e-9 ||
+            std::fabs(m.indiceJain - esperado.indiceJain) > 1e-9 ||
+            std::fabs(completo.metricas.indiceJain - esperado.indiceJain) > 1e-9) {
+            std::cout << "  [ERROR] Métricas del motor (" << nombrePolitica(politica).toStdString() << ")\n";
+            return false;
+        }
+    }
+
+    // Con E/S, la espera no cuenta los ciclos en el dispositivo
+    std::vector<PerfilES> perfiles(1);
+    perfiles[0].rafagasCPU = { 2, 1 };
+    perfiles[0].rafagasES  = { { 0, 3 } };
+    std::vector<Dispositivo> disco(1);
+    disco[0].nombre = "DISCO";
+    Proceso conES{ "P1", 3, 0, 1, 0,0,0,0 };
+    ResultadoES es = simularConES({ conES }, perfiles, disco, Politica::FIFO, parametros, soloAgregados);
+    if (es.cpu.metricas.procesos != 1 || es.cpu.metricas.espera.maximo != 0 ||
+        es.cpu.metricas.turnaround.maximo != 6 || !es.bloquesES.empty()) {
+        std::cout << "  [ERROR] Métricas con E/S en modo solo agregados\n";
+        return false;
+    }
+    return true;
+}
+
+// Comparación: una sola carga preparada para todas las políticas debe dar lo
+// mismo que llamar a cada función de algoritmo.h por separado
+static bool test_comparacion() {
+    std::vector<Proceso> procesos;
+    procesos.push_back({ "P1", 7, 0, 3, 0,0,0,0 });
+    procesos.push_back({ "P2", 4, 2, 1, 0,0,0,0 });
+    procesos.push_back({ "P3", 1, 4, 2, 0,0,0,0 });
+    procesos.push_back({ "P4", 4, 5, 1, 0,0,0,0 });
+    procesos.push_back({ "P5", 6, 20, 2, 0,0,0,0 });
+    ParametrosPolitica parametros;
+    parametros.quantum = 3;
+    parametros.envejecimiento = 2;
+    parametros.semillaLoteria = 7;
+
+    std::vector<BloqueGantt> b;
+    std::vector<std::pair<Politica, std::vector<Proceso>>> esperados = {
+        { Politica::FIFO, fifo(procesos) },
+        { Politica::SJF, shortestJobFirst(procesos) },
+        { Politica::Priority, priorityScheduling(procesos) },
+        { Politica::RoundRobin, roundRobin(procesos, 3, b) },
+        { Politica::RoundRobinAdaptativo, roundRobinAdaptativo(procesos, 50, b) },
+        { Politica::SRT, shortestRemainingTime(procesos, b) },
+        { Politica::PreemptivePriority, preemptivePriorityScheduling(procesos, 2, b) },
+        { Politica::MLFQ, multilevelFeedbackQueue(procesos, { 2, 4, 8 }, 0, b) },
+        { Politica::CFS, completelyFairScheduler(procesos, 6, 1, b) },
+        { Politica::Stride, strideScheduling(procesos, 3, b) },
+        { Politica::Lottery, lotteryScheduling(procesos, 3, 7, b) }
+    };
+    std::vector<Politica> politicas;
+    for (const auto& e : esperados) politicas.push_back(e.first);
+
+    CargaComparacion carga = prepararComparacion(procesos);
+    std::vector<ResultadoComparacion> resultados = compararPoliticas(carga, politicas, parametros, ConfigSMP(), 4);
+    for (size_t k = 0; k < esperados.size(); ++k) {
+        const std::vector<Proceso>& esperado = esperados[k].second;
+        const ResultadoComparacion& r = resultados[k];
+        bool igual = r.ejecutado && r.politica == esperados[k].first && r.procesos.size() == esperado.size();
+        for (size_t i = 0; igual && i < esperado.size(); ++i) {
+            igual = r.procesos[i].pid == esperado[i].pid &&
+                    r.procesos[i].startTime == esperado[i].startTime &&
+                    r.procesos[i].completionTime == esperado[i].completionTime &&
+                    r.procesos[i].waitingTime == esperado[i].waitingTime;
+        }
+        if (!igual || r.metricas.makespan != calcularMetricas(esperado).makespan) {
+            std::cout << "  [ERROR] Comparación distinta de la función directa ("
+                      << nombrePolitica(esperados[k].first).toStdString() << ")\n";
+            return false;
+        }
+    }
+
+    // Solo agregados: mismas métricas, sin detalle; Lottery con costo corre en el motor
+    ConfigSMP soloAgregados;
+    soloAgregados.soloAgregados = true;
+    ResultadoComparacion srt = ejecutarComparacion(carga, Politica::SRT, parametros, soloAgregados);
+    ConfigSMP conCosto;
+    conCosto.costoCambioContexto = 1;
+    ResultadoComparacion loteria = ejecutarComparacion(carga, Politica::Lottery, parametros, conCosto);
+    if (!srt.ejecutado || !srt.procesos.empty() ||
+        srt.metricas.espera.p90 != resultados[5].metricas.espera.p90 || !loteria.ejecutado ||
+        loteria.ciclosCambio != loteria.cambiosContexto) {
+        std::cout << "  [ERROR] Comparación en modo solo agregados o con costo de cambio\n";
+        return false;
+    }
+
+    // Un proceso inválido invalida toda la carga
+    procesos.push_back({ "P6", 0, 1, 1, 0,0,0,0 });
+    if (prepararComparacion(procesos).valida() ||
+        ejecutarComparacion(prepararComparacion(procesos), Politica::FIFO, parametros).ejecutado) {
+        std::cout << "  [ERROR] Carga inválida aceptada\n";
+        return false;
+    }
+    return true;
+}
+
+// Resultado compacto: permutación de ids + columnas por id; expandido es
+// exactamente lo que devuelve cada función de algoritmo.h
+static bool test_resultado_compacto() {
+    std::vector<Proceso> procesos;
+    procesos.push_back({ "P1", 7, 0, 3, 0,0,0,0 });
+    procesos.push_back({ "P2", 4, 2, 1, 0,0,0,0 });
+    procesos.push_back({ "P3", 1, 4, 2, 0,0,0,0 });
+    procesos.push_back({ "P4", 4, 5, 1, 0,0,0,0 });
+    procesos.push_back({ "P5", 6, 20, 2, 0,0,0,0 });
+    procesos.push_back({ "P6", 2, 2, 0, 0,0,0,0 });
+    ParametrosPolitica parametros;
+    parametros.quantum = 2;
+    parametros.envejecimiento = 3;
+    parametros.semillaLoteria = 11;
+    const CargaTrabajo carga = internarProcesos(procesos);
+
+    const Politica politicas[] = { Politica::FIFO, Politica::SJF, Politica::Priority, Politica::RoundRobin,
+                                   Politica::RoundRobinAdaptativo, Politica::SRT, Politica::PreemptivePriority,
+                                   Politica::MLFQ, Politica::CFS, Politica::Stride, Politica::Lottery };
+    for (Politica politica : politicas) {
+        std::vector<BloqueGantt> bloquesCompacto, bloquesClasico;
+        ResultadoCompacto compacto = ejecutarPoliticaCompacta(carga, politica, parametros);
+        std::vector<Proceso> clasico = ejecutarPolitica(carga, politica, parametros, bloquesClasico);
+        agregarBloques(carga, compacto.lineaTiempo, bloquesCompacto);
+
+        // `orden` es una permutación de los ids de la entrada
+        std::vector<uint32_t> ids = compacto.orden;
+        std::sort(ids.begin(), ids.end());
+        bool igual = compacto.size() == procesos.size() && compacto.inicio.size() == procesos.size() &&
+                     compacto.espera.size() == procesos.size() && bloquesCompacto.size() == bloquesClasico.size();
+        for (size_t i = 0; igual && i < ids.size(); ++i) igual = ids[i] == i;
+        for (size_t k = 0; igual && k < clasico.size(); ++k) {
+            const uint32_t id = compacto.orden[k];
+            igual = clasico[k].pid == procesos[id].pid && clasico[k].startTime == compacto.inicio[id] &&
+                    clasico[k].completionTime == compacto.fin[id] &&
+                    clasico[k].waitingTime == compacto.espera[id] &&
+                    clasico[k].turnaroundTime == compacto.turnaround[id];
+        }
+        const MetricasEjecucion a = calcularMetricas(carga, compacto);
+        const MetricasEjecucion b = calcularMetricas(clasico);
+        if (!igual || a.espera.promedio != b.espera.promedio || a.respuesta.p90 != b.respuesta.p90 ||
+            a.makespan != b.makespan || a.indiceJain != b.indiceJain) {
+            std::cout << "  [ERROR] Resultado compacto distinto del clásico ("
+                      << nombrePolitica(politica).toStdString() << ")\n";
+            return false;
+        }
+    }
+
+    // RR devuelve los procesos en el orden de la entrada
+    ResultadoCompacto rr = ejecutarPoliticaCompacta(carga, Politica::RoundRobin, parametros);
+    if (rr.orden != std::vector<uint32_t>{ 0, 1, 2, 3, 4, 5 } || rr.espera[0] != 11) {
+        std::cout << "  [ERROR] Orden o espera de RR: espera P1 = " << rr.espera[0] << "\n";
+        return false;
+    }
+
+    // Lottery en modo solo agregados corre en el motor con 1 CPU: mismo resumen, sin detalle
+    CargaComparacion comparacion = prepararComparacion(procesos);
+    ConfigSMP soloAgregados;
+    soloAgregados.soloAgregados = true;
+    ResultadoComparacion completo = ejecutarComparacion(comparacion, Politica::Lottery, parametros);
+    ResultadoComparacion agregado = ejecutarComparacion(comparacion, Politica::Lottery, parametros, soloAgregados);
+    if (!agregado.ejecutado || !agregado.procesos.empty() ||
+        agregado.metricas.espera.promedio != completo.metricas.espera.promedio ||
+        agregado.utilizacionCPU != completo.utilizacionCPU || agregado.throughput != completo.throughput ||
+        agregado.cambiosContexto != completo.cambiosContexto || completo.procesos.size() != procesos.size()) {
+        std::cout << "  [ERROR] Lottery solo agregados en el motor\n";
+        return false;
+    }
+    return true;
+}
+
+// Puntos de control: reanudar desde cualquier punto da la misma corrida que
+// la completa, y una ventana [desde, hasta) los mismos bloques recortados
+static bool mismosBloques(const BloqueGantt& a, const BloqueGantt& b) {
+    return a.pid == b.pid && a.inicio == b.inicio && a.duracion == b.duracion &&
+           a.cpu == b.cpu && a.tipo == b.tipo;
+}
+
+static bool test_puntos_control() {
+    std::vector<Proceso> procesos;
+    uint32_t semilla = 12345;
+    auto siguiente = [&](int modulo) {
+        semilla = semilla * 1103515245u + 12345u;
+        return static_cast<int>((semilla >> 16) % modulo);
+    };
+    int llegada = 0;
+    for (int k = 0; k < 40; ++k) {
+        llegada += siguiente(4);
+        procesos.push_back({ QString("P%1").arg(k + 1), 1 + siguiente(12), llegada, siguiente(5), 0,0,0,0 });
+    }
+    procesos.push_back({ "TARDE", 5, 400, 1, 0,0,0,0 }); // Hueco ocioso antes de su llegada
+    CargaTrabajo carga = internarProcesos(procesos);
+
+    ParametrosPolitica parametros;
+    parametros.quantum = 3;
+    parametros.envejecimiento = 4;
+    parametros.periodoBoost = 25;
+    ConfigSMP unaCPU;
+    unaCPU.costoCambioContexto = 1;
+    ConfigSMP dosCPUs;
+    dosCPUs.numCPUs = 2;
+    dosCPUs.penalizacionMigracion = 2;
+    dosCPUs.costoMismoProceso = 1;
+
+    const std::vector<std::pair<Politica, ConfigSMP>> casos = {
+        { Politica::SRT, unaCPU }, { Politica::RoundRobin, unaCPU }, { Politica::RoundRobin, dosCPUs },
+        { Politica::CFS, dosCPUs }, { Politica::MLFQ, unaCPU }, { Politica::PreemptivePriority, dosCPUs },
+        { Politica::RoundRobinAdaptativo, dosCPUs }, { Politica::Lottery, dosCPUs }
+    };
+    for (const auto& caso : casos) {
+        const std::string nombre = nombrePolitica(caso.first).toStdString();
+        ResultadoSMP completo = simularMulticore(carga, caso.first, parametros, caso.second);
+        std::vector<PuntoControl> puntos;
+        ResultadoSMP conPuntos = simularConPuntosControl(carga, caso.first, parametros, caso.second, 5, &puntos);
+        if (puntos.size() < 5 || conPuntos.bloques.size() != completo.bloques.size() ||
+            conPuntos.makespan != completo.makespan) {
+            std::cout << "  [ERROR] Corrida con puntos de control distinta (" << nombre << ")\n";
+            return false;
+        }
+        // Los deltas de bloques, concatenados, rehacen el Gantt hasta cada punto
+        std::vector<BloqueGantt> rehecho;
+        for (const PuntoControl& punto : puntos) {
+            rehecho.insert(rehecho.end(), punto.bloquesNuevos.begin(), punto.bloquesNuevos.end());
+            bool igualGantt = rehecho.size() == punto.bloquesPrevios;
+            for (size_t k = 0; igualGantt && k < rehecho.size(); ++k) {
+                igualGantt = mismosBloques(rehecho[k], completo.bloques[k]);
+            }
+            if (!igualGantt) {
+                std::cout << "  [ERROR] Deltas de bloques hasta el ciclo " << punto.tiempo << " (" << nombre << ")\n";
+                return false;
+            }
+        }
+        for (const PuntoControl& punto : puntos) {
+            ResultadoSMP reanudado = reanudarSimulacion(carga, caso.first, parametros, caso.second, punto);
+            bool igual = reanudado.procesos.size() == completo.procesos.size() &&
+                         punto.bloquesPrevios + reanudado.bloques.size() == completo.bloques.size() &&
+                         reanudado.cambiosContexto == completo.cambiosContexto &&
+                         reanudado.migraciones == completo.migraciones &&
+                         reanudado.ciclosCambio == completo.ciclosCambio &&
+                         reanudado.metricas.espera.p90 == completo.metricas.espera.p90 &&
+                         reanudado.metricas.espera.promedio == completo.metricas.espera.promedio &&
+                         reanudado.metricas.indiceJain == completo.metricas.indiceJain;
+            for (size_t k = 0; igual && k < completo.procesos.size(); ++k) {
+                igual = reanudado.procesos[k].pid == completo.procesos[k].pid &&
+                        reanudado.procesos[k].startTime == completo.procesos[k].startTime &&
+                        reanudado.procesos[k].completionTime == completo.procesos[k].completionTime;
+            }
+            for (size_t k = 0; igual && k < reanudado.bloques.size(); ++k) {
+                igual = mismosBloques(reanudado.bloques[k], completo.bloques[punto.bloquesPrevios + k]);
+            }
+            if (!igual) {
+                std::cout << "  [ERROR] Reanudar en el ciclo " << punto.tiempo << " (" << nombre << ")\n";
+                return false;
+            }
+        }
+
+        // Salto a una ventana tardía (desde la mitad de la línea de tiempo)
+        const int desde = completo.bloques[completo.bloques.size() / 2].inicio + 1;
+        const int hasta = desde + 17;
+        std::vector<BloqueGantt> esperado;
+        for (const BloqueGantt& b : completo.bloques) {
+            const int inicio = std::max(b.inicio, desde);
+            const int fin = std::min(b.inicio + b.duracion, hasta);
+            if (fin > inicio) {
+                BloqueGantt r = b;
+                r.inicio = inicio;
+                r.duracion = fin - inicio;
+                esperado.push_back(r);
+            }
+        }
+        std::stable_sort(esperado.begin(), esperado.end(), [](const BloqueGantt& a, const BloqueGantt& b) {
+            return a.inicio != b.inicio ? a.inicio < b.inicio : a.cpu < b.cpu;
+        });
+        std::vector<BloqueGantt> ventana = simularVentana(carga, caso.first, parametros, caso.second, puntos, desde, hasta);
+        bool igual = !esperado.empty() && ventana.size() == esperado.size();
+        for (size_t k = 0; igual && k < ventana.size(); ++k) igual = mismosBloques(ventana[k], esperado[k]);
+        if (!igual) {
+            std::cout << "  [ERROR] Ventana [" << desde << ", " << hasta << ") (" << nombre << ")\n";
+            return false;
+        }
+    }
+
+    // Archivo: ida y vuelta; un punto dañado o de otra política se rechaza
+    std::vector<PuntoControl> puntos;
+    simularConPuntosControl(carga, Politica::SRT, parametros, unaCPU, 10, &puntos);
+    const char* ruta = "puntos_control_test.bin";
+    bool guardado = guardarPuntosControl(ruta, puntos);
+    std::vector<PuntoControl> leidos = cargarPuntosControl(ruta);
+    std::remove(ruta);
+    auto mismosPuntos = [&](const std::vector<PuntoControl>& a, size_t cantidad) {
+        bool iguales = a.size() == cantidad;
+        for (size_t k = 0; iguales && k < cantidad; ++k) {
+            iguales = a[k].tiempo == puntos[k].tiempo && a[k].eventos == puntos[k].eventos &&
+                      a[k].bloquesPrevios == puntos[k].bloquesPrevios && a[k].datos == puntos[k].datos &&
+                      a[k].bloquesNuevos.size() == puntos[k].bloquesNuevos.size();
+            for (size_t b = 0; iguales && b < a[k].bloquesNuevos.size(); ++b) {
+                iguales = mismosBloques(a[k].bloquesNuevos[b], puntos[k].bloquesNuevos[b]);
+            }
+        }
+        return iguales;
+    };
+    bool igual = guardado && mismosPuntos(leidos, puntos.size());
+
+    // Escritura incremental: cada punto ya está en el archivo al tomarse; si la
+    // corrida cae a mitad del último, se recuperan los anteriores
+    {
+        ArchivoPuntosControl archivo(ruta);
+        simularConPuntosControl(carga, Politica::SRT, parametros, unaCPU, 10, &archivo);
+        igual = igual && archivo.ok();
+    }
+    QStringList errores;
+    leidos = cargarPuntosControl(ruta, &errores);
+    igual = igual && mismosPuntos(leidos, puntos.size()) && errores.isEmpty();
+    std::vector<char> bytes;
+    {
+        std::ifstream entrada(ruta, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(entrada), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream cortado(ruta, std::ios::binary | std::ios::trunc);
+        cortado.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 3));
+    }
+    leidos = cargarPuntosControl(ruta, &errores);
+    std::remove(ruta);
+    igual = igual && mismosPuntos(leidos, puntos.size() - 1) && errores.size() == 1;
+    PuntoControl truncado = puntos[1];
+    truncado.datos.resize(truncado.datos.size() / 2);
+    if (!igual || !reanudarSimulacion(carga, Politica::SRT, parametros, unaCPU, truncado).procesos.empty() ||
+        !reanudarSimulacion(carga, Politica::RoundRobin, parametros, unaCPU, puntos[1]).procesos.empty()) {
+        std::cout << "  [ERROR] Archivo de puntos de control o validación del punto\n";
+        return false;
+    }
+    return true;
+}
+
+// Línea de tiempo run-length: la emiten todas las políticas (también FIFO,
+// SJF y Priority), con los huecos ociosos explícitos y forma varint
+static bool test_linea_tiempo() {
+    std::vector<Proceso> procesos;
+    procesos.push_back({ "P1", 4, 1, 2, 0,0,0,0 });
+    procesos.push_back({ "P2", 3, 2, 1, 0,0,0,0 });
+    procesos.push_back({ "P3", 2, 12, 0, 0,0,0,0 });
+    const CargaTrabajo carga = internarProcesos(procesos);
+    ParametrosPolitica parametros;
+    parametros.quantum = 2;
+
+    // FIFO: ocioso [0,1), P1 [1,5), P2 [5,8), ocioso [8,12), P3 [12,14)
+    ResultadoCompacto fifo = ejecutarPoliticaCompacta(carga, Politica::FIFO, parametros);
+    const Tramo esperado[] = { { Tramo::SIN_PROCESO, 0, 1, TipoTramo::Ocioso }, { 0, 1, 4, TipoTramo::Ejecucion },
+                               { 1, 5, 3, TipoTramo::Ejecucion }, { Tramo::SIN_PROCESO, 8, 4, TipoTramo::Ocioso },
+                               { 2, 12, 2, TipoTramo::Ejecucion } };
+    bool igual = fifo.lineaTiempo.size() == 5;
+    for (size_t k = 0; igual && k < 5; ++k) igual = fifo.lineaTiempo.tramos[k] == esperado[k];
+    if (!igual || fifo.lineaTiempo.tramoEn(0) != 0 || fifo.lineaTiempo.tramoEn(7) != 2 ||
+        fifo.lineaTiempo.tramoEn(13) != 4 || fifo.lineaTiempo.tramoEn(14) != -1 ||
+        fifo.lineaTiempo.cambiosDeProceso() != 2) {
+        std::cout << "  [ERROR] Línea de tiempo de FIFO\n";
+        return false;
+    }
+
+    // RR y SRT: los bloques de la línea son los de las funciones de algoritmo.h
+    std::vector<BloqueGantt> bloquesRR, bloquesSRT;
+    std::vector<Proceso> rr = roundRobin(procesos, 2, bloquesRR);
+    shortestRemainingTime(procesos, bloquesSRT);
+    ResultadoCompacto compactoRR = ejecutarPoliticaCompacta(carga, Politica::RoundRobin, parametros);
+    ResultadoCompacto compactoSRT = ejecutarPoliticaCompacta(carga, Politica::SRT, parametros);
+    std::vector<BloqueGantt> desdeRR, desdeSRT;
+    agregarBloques(carga, compactoRR.lineaTiempo, desdeRR);
+    agregarBloques(carga, compactoSRT.lineaTiempo, desdeSRT);
+    igual = desdeRR.size() == bloquesRR.size() && desdeSRT.size() == bloquesSRT.size();
+    for (size_t k = 0; igual && k < desdeRR.size(); ++k) igual = mismosBloques(desdeRR[k], bloquesRR[k]);
+    for (size_t k = 0; igual && k < desdeSRT.size(); ++k) igual = mismosBloques(desdeSRT[k], bloquesSRT[k]);
+    if (!igual || compactoRR.lineaTiempo.cambiosDeProceso() != contarCambiosContexto(rr, bloquesRR)) {
+        std::cout << "  [ERROR] Bloques desde la línea de tiempo de RR / SRT\n";
+        return false;
+    }
+
+    // Todas las políticas: tramos contiguos desde 0 hasta el makespan
+    const Politica politicas[] = { Politica::FIFO, Politica::SJF, Politica::Priority, Politica::RoundRobin,
+                                   Politica::RoundRobinAdaptativo, Politica::SRT, Politica::PreemptivePriority,
+                                   Politica::MLFQ, Politica::CFS, Politica::Stride, Politica::Lottery };
+    for (Politica politica : politicas) {
+        ResultadoCompacto r = ejecutarPoliticaCompacta(carga, politica, parametros);
+        int fin = 0;
+        long long ocupado = 0;
+        for (const Tramo& t : r.lineaTiempo.tramos) {
+            igual = igual && t.inicio == fin && t.duracion > 0;
+            fin = t.fin();
+            if (t.tipo == TipoTramo::Ejecucion) ocupado += t.duracion;
+        }
+        if (!igual || r.lineaTiempo.tramos.empty() || fin != calcularMetricas(carga, r).makespan || ocupado != 9) {
+            std::cout << "  [ERROR] Línea de tiempo no contigua ("
+                      << nombrePolitica(politica).toStdString() << ")\n";
+            return false;
+        }
+
+        // Forma varint: ida y vuelta exacta
+        LineaTiempo leida;
+        if (!decodificarLineaTiempo(codificarLineaTiempo(r.lineaTiempo), carga.size(), &leida) ||
+            leida != r.lineaTiempo) {
+            std::cout << "  [ERROR] Codificación de la línea de tiempo ("
+                      << nombrePolitica(politica).toStdString() << ")\n";
+            return false;
+        }
+    }
+
+    // Una corrida larga ocupa pocos bytes por tramo; datos dañados se rechazan
+    std::vector<Proceso> muchos;
+    for (int i = 0; i < 2000; ++i) {
+        muchos.push_back({ QString::fromStdString("P" + std::to_string(i)), 1 + i % 9, i * 3, i % 4, 0,0,0,0 });
+    }
+    const CargaTrabajo cargaLarga = internarProcesos(muchos);
+    ResultadoCompacto largo = ejecutarPoliticaCompacta(cargaLarga, Politica::RoundRobin, parametros);
+    std::vector<uint8_t> datos = codificarLineaTiempo(largo.lineaTiempo);
+    LineaTiempo leida;
+    std::vector<uint8_t> truncados(datos.begin(), datos.end() - 1);
+    if (datos.size() > 3 * largo.lineaTiempo.size() + 4 ||
+        decodificarLineaTiempo(truncados, cargaLarga.size(), &leida) || !leida.tramos.empty() ||
+        decodificarLineaTiempo(datos, 10, &leida)) {
+        std::cout << "  [ERROR] Tamaño (" << datos.size() << " bytes para " << largo.lineaTiempo.size()
+                  << " tramos) o validación de la forma varint\n";
+        return false;
+    }
+
+    // Motor multicore: una línea por núcleo, con los cambios de contexto
+    ConfigSMP config;
+    config.numCPUs = 2;
+    config.costoCambioContexto = 1;
+    ResultadoSMP motor = simularMulticore(muchos, Politica::RoundRobin, parametros, config);
+    std::vector<LineaTiempo> lineas = lineasDesdeBloques(cargaLarga, motor.bloques, 2);
+    size_t tramosNoOciosos = 0;
+    int cambios = 0;
+    for (const LineaTiempo& linea : lineas) {
+        for (const Tramo& t : linea.tramos) {
+            tramosNoOciosos += t.tipo != TipoTramo::Ocioso;
+            cambios += t.tipo == TipoTramo::CambioContexto;
+        }
+    }
+    if (lineas.size() != 2 || tramosNoOciosos != motor.bloques.size() || cambios == 0 ||
+        lineas[0].fin() > motor.makespan) {
+        std::cout << "  [ERROR] Líneas de tiempo del motor multicore\n";
+        return false;
+    }
+    return true;
+}
+
+// Planificador incremental: los eventos reproducen los bloques y las métricas
+// de simularMulticore, y se puede cortar la corrida en un horizonte
+static bool test_planificador() {
+    std::vector<Proceso> procesos;
+    uint32_t semilla = 777;
+    auto siguiente = [&](int modulo) {
+        semilla = semilla * 1103515245u + 12345u;
+        return static_cast<int>((semilla >> 16) % modulo);
+    };
+    int llegada = 0;
+    for (int k = 0; k < 30; ++k) {
+        llegada += siguiente(4);
+        procesos.push_back({ QString("P%1").arg(k + 1), 1 + siguiente(10), llegada, siguiente(5), 0,0,0,0 });
+    }
+    procesos.push_back({ "TARDE", 4, 300, 0, 0,0,0,0 }); // Hueco ocioso antes de su llegada
+    const CargaTrabajo carga = internarProcesos(procesos);
+
+    ParametrosPolitica parametros;
+    parametros.quantum = 3;
+    parametros.envejecimiento = 4;
+    ConfigSMP unaCPU;
+    unaCPU.costoCambioContexto = 1;
+    ConfigSMP dosCPUs;
+    dosCPUs.numCPUs = 2;
+    dosCPUs.penalizacionMigracion = 2;
+    dosCPUs.costoCambioContexto = 1;
+
+    const std::vector<std::pair<Politica, ConfigSMP>> casos = {
+        { Politica::SRT, unaCPU }, { Politica::RoundRobin, dosCPUs },
+        { Politica::CFS, dosCPUs }, { Politica::PreemptivePriority, dosCPUs }
+    };
+    for (const auto& caso : casos) {
+        const std::string nombre = nombrePolitica(caso.first).toStdString();
+        ResultadoSMP completo = simularMulticore(carga, caso.first, parametros, caso.second);
+
+        // Consumidores: bloques de Gantt y un acumulador de métricas
+        Planificador sim = crearPlanificador(carga, caso.first, parametros, caso.second);
+        std::vector<BloqueGantt> bloques;
+        std::vector<int> primera(carga.size(), -1);
+        AcumuladorMetricas acumulador;
+        size_t llegadas = 0, terminaciones = 0;
+        while (auto ev = sim.siguiente()) {
+            switch (ev->tipo) {
+            case TipoEvento::Llegada:
+                llegadas++;
+                break;
+            case TipoEvento::Despacho:
+                if (primera[ev->id] < 0) primera[ev->id] = ev->tiempo;
+                break;
+            case TipoEvento::Ejecucion:
+            case TipoEvento::CambioContexto:
+                bloques.push_back({ carga.pids[ev->id], ev->tiempo, ev->duracion, ev->cpu,
+                                    ev->tipo == TipoEvento::Ejecucion ? TipoBloque::Proceso
+                                                                      : TipoBloque::CambioContexto });
+                break;
+            case TipoEvento::Terminacion:
+                terminaciones++;
+                acumulador.agregar(carga.arrivalTime[ev->id], primera[ev->id], ev->tiempo, carga.burstTime[ev->id]);
+                break;
+            case TipoEvento::Expropiacion:
+                break;
+            }
+        }
+        bool igual = sim.terminado() && bloques.size() == completo.bloques.size() &&
+                     llegadas == carga.size() && terminaciones == carga.size();
+        for (size_t k = 0; igual && k < bloques.size(); ++k) igual = mismosBloques(bloques[k], completo.bloques[k]);
+        const MetricasEjecucion propias = acumulador.resultado();
+        const ResultadoSMP final = sim.resultado();
+        if (!igual || propias.espera.promedio != completo.metricas.espera.promedio ||
+            propias.respuesta.p90 != completo.metricas.respuesta.p90 ||
+            final.makespan != completo.makespan || final.cambiosContexto != completo.cambiosContexto ||
+            final.metricas.turnaround.p99 != completo.metricas.turnaround.p99 ||
+            !final.bloques.empty() || !final.procesos.empty()) {
+            std::cout << "  [ERROR] Eventos distintos de simularMulticore (" << nombre << ")\n";
+            return false;
+        }
+
+        // Corte en un horizonte: lo entregado es un prefijo de la corrida completa
+        const int horizonte = completo.makespan / 3;
+        Planificador parcial = crearPlanificador(carga, caso.first, parametros, caso.second);
+        size_t tramos = 0;
+        while (auto ev = parcial.siguiente()) {
+            if (ev->tiempo >= horizonte) break;
+            if (ev->tipo != TipoEvento::Ejecucion && ev->tipo != TipoEvento::CambioContexto) continue;
+            igual = igual && tramos < completo.bloques.size() && completo.bloques[tramos].inicio == ev->tiempo &&
+                    completo.bloques[tramos].duracion == ev->duracion;
+            tramos++;
+        }
+        // Mover el planificador a mitad de la corrida no pierde eventos
+        Planificador movido = std::move(parcial);
+        size_t restantes = 0;
+        while (movido.siguiente()) restantes++;
+        if (!igual || tramos == 0 || tramos >= completo.bloques.size() || parcial.siguiente() ||
+            restantes == 0 || !movido.terminado() || movido.resultado().makespan != completo.makespan) {
+            std::cout << "  [ERROR] Corte en el horizonte " << horizonte << " (" << nombre << ")\n";
+            return false;
+        }
+    }
+
+    // Entrada que el motor rechaza: ningún evento
+    ParametrosPolitica sinQuantum = parametros;
+    sinQuantum.quantum = 0;
+    Planificador invalido = crearPlanificador(carga, Politica::RoundRobin, sinQuantum, unaCPU);
+    if (invalido.valido() || invalido.siguiente() || !invalido.terminado() ||
+        invalido.resultado().metricas.procesos != 0) {
+        std::cout << "  [ERROR] Planificador con quantum 0\n";
+        return false;
+    }
+    return true;
+}
+
+// Monte Carlo: réplicas reproducibles con cualquier número de hilos e
+// intervalos t de Student sobre las métricas de cada réplica
+static bool test_replicacion() {
+    if (std::fabs(cuantilStudent(0.975, 1) - 12.706) > 1e-3 || std::fabs(cuantilStudent(0.975, 2) - 4.303) > 1e-3 ||
+        std::fabs(cuantilStudent(0.975, 9) - 2.262) > 2e-3 || std::fabs(cuantilStudent(0.95, 4) - 2.132) > 2e-3 ||
+        std::fabs(cuantilStudent(0.995, 29) - 2.756) > 2e-3 || std::fabs(cuantilStudent(0.025, 9) + 2.262) > 2e-3) {
+        std::cout << "  [ERROR] Cuantil t: " << cuantilStudent(0.975, 9) << "\n";
+        return false;
+    }
+
+    std::vector<Proceso> procesos;
+    for (int k = 0; k < 12; ++k) {
+        procesos.push_back({ QString("P%1").arg(k + 1), 2 + (k * 7) % 9, (k / 2) * 3, k % 4, 0,0,0,0 });
+    }
+    ConfigReplicacion config;
+    config.replicas = 24;
+    config.semilla = 99;
+    config.variacionLlegada = 0.5;
+    config.variacionRafaga = 0.4;
+
+    // Misma réplica -> mismos procesos; réplicas distintas difieren; sin variación, la carga original
+    std::vector<Proceso> a = perturbarProcesos(procesos, config, 3);
+    std::vector<Proceso> b = perturbarProcesos(procesos, config, 3);
+    std::vector<Proceso> c = perturbarProcesos(procesos, config, 4);
+    bool iguales = true, distintas = false;
+    for (size_t k = 0; k < procesos.size(); ++k) {
+        iguales = iguales && a[k].arrivalTime == b[k].arrivalTime && a[k].burstTime == b[k].burstTime;
+        distintas = distintas || a[k].arrivalTime != c[k].arrivalTime || a[k].burstTime != c[k].burstTime;
+        if (a[k].burstTime < 1 || (k > 0 && procesos[k].arrivalTime == procesos[k - 1].arrivalTime &&
+                                   a[k].arrivalTime != a[k - 1].arrivalTime)) {
+            std::cout << "  [ERROR] Perturbación: ráfaga < 1 o llegada simultánea separada\n";
+            return false;
+        }
+    }
+    if (!iguales || !distintas) {
+        std::cout << "  [ERROR] Semillas por réplica no deterministas\n";
+        return false;
+    }
+
+    // 1 hilo y 4 hilos dan exactamente lo mismo
+    const std::vector<Politica> politicas = { Politica::FIFO, Politica::SJF, Politica::RoundRobin, Politica::Lottery };
+    ParametrosPolitica parametros;
+    parametros.quantum = 2;
+    config.hilos = 1;
+    std::vector<ResumenReplicacion> uno = replicarPoliticas(procesos, politicas, parametros, ConfigSMP(), config);
+    config.hilos = 4;
+    std::vector<ResumenReplicacion> cuatro = replicarPoliticas(procesos, politicas, parametros, ConfigSMP(), config);
+    if (uno.size() != politicas.size() || cuatro.size() != politicas.size()) {
+        std::cout << "  [ERROR] Réplicas sin resultado\n";
+        return false;
+    }
+    for (size_t p = 0; p < politicas.size(); ++p) {
+        for (int m = 0; m < NUM_METRICAS_REPLICACION; ++m) {
+            if (uno[p].replicas != config.replicas || uno[p].metricas[m].media != cuatro[p].metricas[m].media ||
+                uno[p].metricas[m].semiancho != cuatro[p].metricas[m].semiancho) {
+                std::cout << "  [ERROR] Resultado distinto con 1 y 4 hilos ("
+                          << nombreMetrica(static_cast<MetricaReplicacion>(m)).toStdString() << ")\n";
+                return false;
+            }
+        }
+    }
+
+    // La media y el intervalo de SJF coinciden con correr cada réplica a mano
+    std::vector<double> esperas;
+    for (int r = 0; r < config.replicas; ++r) {
+        esperas.push_back(calcularMetricas(shortestJobFirst(perturbarProcesos(procesos, config, r))).espera.promedio);
+    }
+    double media = 0.0, var = 0.0;
+    for (double e : esperas) media += e / esperas.size();
+    for (double e : esperas) var += (e - media) * (e - media) / (esperas.size() - 1);
+    const double semiancho = cuantilStudent(0.975, config.replicas - 1) * std::sqrt(var / esperas.size());
+    const IntervaloConfianza& sjf = uno[1].metrica(MetricaReplicacion::EsperaPromedio);
+    if (std::fabs(sjf.media - media) > 1e-9 || std::fabs(sjf.semiancho - semiancho) > 1e-9 || sjf.semiancho <= 0.0 ||
+        sjf.inferior() >= sjf.media || sjf.superior() <= sjf.media) {
+        std::cout << "  [ERROR] Intervalo de SJF: " << sjf.media << " ± " << sjf.semiancho
+                  << " (esperado " << media << " ± " << semiancho << ")\n";
+        return false;
+    }
+
+    // Sin variación todas las réplicas son la carga original: intervalo nulo
+    config.variacionLlegada = 0.0;
+    config.variacionRafaga = 0.0;
+    std::vector<ResumenReplicacion> fijas = replicarPoliticas(procesos, { Politica::FIFO }, parametros, ConfigSMP(), config);
+    const IntervaloConfianza& fifoEspera = fijas[0].metrica(MetricaReplicacion::EsperaPromedio);
+    if (std::fabs(fifoEspera.media - calcularMetricas(fifo(procesos)).espera.promedio) > 1e-9 ||
+        fifoEspera.semiancho != 0.0) {
+        std::cout << "  [ERROR] Réplicas sin variación\n";
+        return false;
+    }
+    config.replicas = 1;
+    if (!replicarPoliticas(procesos, politicas, parametros, ConfigSMP(), config).empty()) {
+        std::cout << "  [ERROR] Se aceptó una sola réplica\n";
+        return false;
+    }
+    return true;
+}
+
+// Modelo analítico M/G/1: fórmulas exactas sobre una carga chica y, sobre
+// una carga de Poisson grande, cerca de lo que simula cada política
+static bool test_modelo_analitico() {
+    // λ = 0.1, ráfagas 2/4/6/8: E[S] = 5, E[S²] = 30, ρ = 0.5
+    std::vector<Proceso> chica;
+    chica.push_back({ "P1", 2, 0, 3, 0,0,0,0 });
+    chica.push_back({ "P2", 4, 10, 2, 0,0,0,0 });
+    chica.push_back({ "P3", 6, 20, 1, 0,0,0,0 });
+    chica.push_back({ "P4", 8, 30, 0, 0,0,0,0 });
+    const CargaTrabajo carga = internarProcesos(chica);
+    const AjusteCarga ajuste = ajustarCarga(carga);
+    auto cerca = [](double a, double b, double tolerancia) { return std::fabs(a - b) <= tolerancia; };
+    if (!ajuste.valido() || !cerca(ajuste.tasaLlegada, 0.1, 1e-12) || !cerca(ajuste.utilizacion, 0.5, 1e-12) ||
+        !cerca(ajuste.servicioCuadrado, 30.0, 1e-12) || ajuste.cvLlegadas != 0.0 ||
+        !cerca(ajuste.cvServicio, std::sqrt(5.0) / 5.0, 1e-12)) {
+        std::cout << "  [ERROR] Ajuste de la carga\n";
+        return false;
+    }
+    // FCFS 3, Cobham por ráfaga 2.5608, por prioridad (la ráfaga 8 primero)
+    // 3.6025, expropiativo 4.5511 y processor sharing 5
+    const std::vector<Politica> politicas = { Politica::FIFO, Politica::SJF, Politica::Priority,
+                                              Politica::PreemptivePriority, Politica::RoundRobin, Politica::MLFQ };
+    std::vector<EstimacionAnalitica> est = estimarPoliticas(carga, politicas);
+    const double esperado[] = { 3.0, 2.560814, 3.602491, 4.551136, 5.0 };
+    for (size_t k = 0; k < 5; ++k) {
+        if (!est[k].aplicable || !est[k].estable || !cerca(est[k].espera, esperado[k], 1e-5) ||
+            !cerca(est[k].turnaround, esperado[k] + 5.0, 1e-5)) {
+            std::cout << "  [ERROR] Estimación de " << nombrePolitica(politicas[k]).toStdString()
+                      << ": " << est[k].espera << "\n";
+            return false;
+        }
+    }
+    if (est[5].aplicable || discrepaDelModelo(est[5], 100.0) ||
+        !discrepaDelModelo(est[0], 3.0 * 1.3) || discrepaDelModelo(est[0], 3.0 * 1.2)) {
+        std::cout << "  [ERROR] Política sin modelo o detección de discrepancias\n";
+        return false;
+    }
+
+    // Saturada (ρ = 2) o sin proceso de llegadas (todos en 0)
+    std::vector<Proceso> saturada = chica, juntos = chica;
+    for (Proceso& p : saturada) p.burstTime *= 4;
+    for (Proceso& p : juntos) p.arrivalTime = 0;
+    const EstimacionAnalitica inestable = estimarPoliticas(internarProcesos(saturada), { Politica::SJF })[0];
+    const EstimacionAnalitica sinLlegadas = estimarPoliticas(internarProcesos(juntos), { Politica::FIFO })[0];
+    if (!inestable.aplicable || inestable.estable || !std::isinf(inestable.espera) || sinLlegadas.aplicable) {
+        std::cout << "  [ERROR] Carga saturada o sin llegadas\n";
+        return false;
+    }
+
+    // 100000 procesos con interllegadas y ráfagas exponenciales (ρ ≈ 0.6):
+    // cada política simulada queda a menos de 10 % de su fórmula
+    std::mt19937_64 generador(2024);
+    auto exponencial = [&](double media) {
+        const double u = static_cast<double>(generador() >> 11) * (1.0 / 9007199254740992.0);
+        return -media * std::log(1.0 - u);
+    };
+    std::vector<Proceso> grande;
+    double llegada = 0.0;
+    for (int k = 0; k < 100000; ++k) {
+        llegada += exponencial(25.0);
+        const int rafaga = std::max(1, static_cast<int>(std::lround(exponencial(15.0))));
+        grande.push_back({ QString::fromStdString("P" + std::to_string(k)), rafaga,
+                           static_cast<int>(llegada), static_cast<int>(generador() % 4), 0,0,0,0 });
+    }
+    const CargaTrabajo cargaGrande = internarProcesos(grande);
+    ParametrosPolitica parametros;
+    parametros.quantum = 1;
+    std::vector<EstimacionAnalitica> estimaciones = estimarPoliticas(cargaGrande, politicas);
+    for (size_t k = 0; k < 5; ++k) {
+        const double simulada =
+            calcularMetricas(cargaGrande, ejecutarPoliticaCompacta(cargaGrande, politicas[k], parametros)).espera.promedio;
+        if (discrepaDelModelo(estimaciones[k], simulada, 0.10)) {
+            std::cout << "  [ERROR] " << nombrePolitica(politicas[k]).toStdString() << ": simulada " << simulada
+                      << ", modelo " << estimaciones[k].espera << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Kernels SoA: el camino AVX2 (si la CPU lo tiene) y el escalar dan las
+// mismas columnas y reducciones, también en la cola que no llena un vector
+static bool test_kernels_metricas() {
+    ColumnasEjecucion c;
+    const size_t n = 1003;
+    uint32_t x = 12345;
+    auto aleatorio = [&x](int tope) { x = x * 1103515245u + 12345u; return static_cast<int>((x >> 8) % tope); };
+    for (size_t i = 0; i < n; ++i) {
+        const int llegada = aleatorio(100000);
+        const int rafaga = 1 + aleatorio(5000);
+        const int es = aleatorio(300);
+        const int inicio = llegada + aleatorio(2000);
+        c.llegada.push_back(llegada);
+        c.rafaga.push_back(rafaga);
+        c.ciclosES.push_back(es);
+        c.inicio.push_back(inicio);
+        c.fin.push_back(inicio + rafaga + es + aleatorio(3000));
+    }
+
+    // Referencia directa
+    long long sumaEspera = 0, sumaRespuesta = 0;
+    double cuadradosTurnaround = 0.0;
+    int minEspera = INT_MAX, maxTurnaround = INT_MIN;
+    for (size_t i = 0; i < n; ++i) {
+        const int vuelta = c.fin[i] - c.llegada[i];
+        const int espera = vuelta - c.rafaga[i] - c.ciclosES[i];
+        sumaEspera += espera;
+        sumaRespuesta += c.inicio[i] - c.llegada[i];
+        cuadradosTurnaround += static_cast<double>(vuelta) * vuelta;
+        minEspera = std::min(minEspera, espera);
+        maxTurnaround = std::max(maxTurnaround, vuelta);
+    }
+
+    std::vector<int> turnaroundSimd(n), esperaSimd(n), respuestaSimd(n);
+    std::vector<int> turnaroundEsc(n), esperaEsc(n), respuestaEsc(n);
+    ReduccionesMetricas simd = calcularMetricasColumnas(c.llegada.data(), c.rafaga.data(), c.inicio.data(),
+                                                        c.fin.data(), c.ciclosES.data(), n, turnaroundSimd.data(),
+                                                        esperaSimd.data(), respuestaSimd.data());
+    ReduccionesMetricas escalar = calcularMetricasColumnas(c.llegada.data(), c.rafaga.data(), c.inicio.data(),
+                                                           c.fin.data(), c.ciclosES.data(), n, turnaroundEsc.data(),
+                                                           esperaEsc.data(), respuestaEsc.data(), false);
+    std::cout << "  (AVX2 " << (kernelsSimdDisponibles() ? "disponible" : "no disponible") << ")\n";
+    auto iguales = [](const ReduccionColumna& a, const ReduccionColumna& b) {
+        return a.cantidad == b.cantidad && a.suma == b.suma && a.minimo == b.minimo && a.maximo == b.maximo &&
+               std::fabs(a.sumaCuadrados - b.sumaCuadrados) <= 1e-12 * b.sumaCuadrados;
+    };
+    if (turnaroundSimd != turnaroundEsc || esperaSimd != esperaEsc || respuestaSimd != respuestaEsc ||
+        !iguales(simd.turnaround, escalar.turnaround) || !iguales(simd.espera, escalar.espera) ||
+        !iguales(simd.respuesta, escalar.respuesta)) {
+        std::cout << "  [ERROR] SIMD y escalar difieren\n";
+        return false;
+    }
+    if (simd.espera.suma != sumaEspera || simd.respuesta.suma != sumaRespuesta ||
+        simd.espera.minimo != minEspera || simd.turnaround.maximo != maxTurnaround ||
+        std::fabs(simd.turnaround.sumaCuadrados - cuadradosTurnaround) > 1e-12 * cuadradosTurnaround ||
+        esperaSimd[n - 1] != c.fin[n - 1] - c.llegada[n - 1] - c.rafaga[n - 1] - c.ciclosES[n - 1]) {
+        std::cout << "  [ERROR] Reducciones: espera " << simd.espera.suma << " vs " << sumaEspera << "\n";
+        return false;
+    }
+
+    // Solo reducciones (sin columnas de salida), sin E/S ni inicio
+    ReduccionesMetricas reducido = calcularMetricasColumnas(c.llegada.data(), c.rafaga.data(), nullptr,
+                                                            c.fin.data(), nullptr, n);
+    long long sumaSinES = 0;
+    for (size_t i = 0; i < n; ++i) sumaSinES += c.fin[i] - c.llegada[i] - c.rafaga[i];
+    if (reducido.espera.suma != sumaSinES || reducido.respuesta.cantidad != 0 ||
+        reducido.turnaround.suma != simd.turnaround.suma) {
+        std::cout << "  [ERROR] Reducción sin E/S ni respuesta\n";
+        return false;
+    }
+
+    // columnasDe recupera la E/S descontada de waitingTime; sin E/S la omite
+    std::vector<Proceso> ejecucion;
+    Proceso p1{ "P1", 5, 0, 1, 0, 9, 2, 9 };  // 2 ciclos de E/S
+    Proceso p2{ "P2", 3, 1, 1, 5, 8, 4, 7 };
+    ejecucion.push_back(p1);
+    ejecucion.push_back(p2);
+    ReduccionesMetricas r = calcularMetricasColumnas(columnasDe(ejecucion));
+    ReduccionesMetricas vacio = calcularMetricasColumnas(ColumnasEjecucion());
+    if (r.espera.suma != 6 || r.turnaround.suma != 16 || r.respuesta.maximo != 4 ||
+        std::fabs(r.espera.varianza() - 1.0) > 1e-12 || !columnasDe({ p2 }).ciclosES.empty() ||
+        vacio.espera.cantidad != 0 || vacio.turnaround.minimo != 0) {
+        std::cout << "  [ERROR] columnasDe: espera " << r.espera.suma << "\n";
+        return false;
+    }
+
+    // Los resúmenes de producción toman promedio y máximo de las reducciones
+    std::vector<Proceso> carga;
+    for (int k = 0; k < 200; ++k) {
+        carga.push_back({ QString("P%1").arg(k + 1), 1 + (k * 7) % 13, (k * 3) / 2, k % 4, 0,0,0,0 });
+    }
+    const CargaTrabajo internada = internarProcesos(carga);
+    ParametrosPolitica parametros;
+    const ResultadoCompacto compacto = ejecutarPoliticaCompacta(internada, Politica::RoundRobin, parametros);
+    const MetricasEjecucion resumen = calcularMetricas(internada, compacto);
+    const std::vector<Proceso> rr = expandirResultado(internada, compacto);
+    ConfigSMP soloAgregados;
+    soloAgregados.soloAgregados = true;
+    const ResultadoSMP motor = simularMulticore(internada, Politica::RoundRobin, parametros, soloAgregados);
+    if (resumen.espera.promedio != compacto.reducciones.espera.promedio() ||
+        resumen.turnaround.maximo != compacto.reducciones.turnaround.maximo ||
+        calcularTiempoEsperaPromedio(carga, rr) != resumen.espera.promedio ||
+        motor.metricas.espera.promedio != resumen.espera.promedio ||
+        motor.metricas.respuesta.maximo != resumen.respuesta.maximo) {
+        std::cout << "  [ERROR] Promedio y máximo desde las reducciones del kernel\n";
+        return false;
+    }
+    return true;
+}
+
+// Barrido de quantum de RR: coincide con roundRobin y con el motor SMP, y
+// elige el mejor quantum por costo de cambio
+static bool test_barrido_quantum() {
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 5, 0, 1, 0,0,0,0 };
+    Proceso p2{ "P2", 3, 0, 1, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+
+    // Quantum 1..5 con costo 0 y 1, repartido en 2 hilos
+    std::vector<PuntoBarrido> puntos = barridoQuantumRR(procesos, 1, 5, {0, 1}, 2);
+    if (puntos.size() != 10) {
+        std::cout << "  [ERROR] Barrido: se esperaban 10 puntos, hay " << puntos.size() << "\n";
+        return false;
+    }
+
+    // Con costo 0 cada punto coincide con roundRobin()
+    for (int q = 1; q <= 5; ++q) {
+        std::vector<BloqueGantt> bloques;
+        std::vector<Proceso> rr = roundRobin(procesos, q, bloques, nullptr);
+        double espera = 0.0;
+        for (const auto& p : rr) espera += p.waitingTime;
+        espera /= rr.size();
+        const PuntoBarrido& punto = puntos[q - 1];
+        if (punto.quantum != q || punto.costoCambio != 0 ||
+            std::fabs(punto.esperaPromedio - espera) > 1e-9) {
+            std::cout << "  [ERROR] Barrido q=" << q << " espera " << punto.esperaPromedio
+                      << ", Round Robin " << espera << "\n";
+            return false;
+        }
+    }
+
+    // q=2, costo 1: P1 P2 P1 P2 P1 -> 4 cambios, esperas 7 y 7
+    const PuntoBarrido& conCosto = puntos[5 + 1];
+    if (conCosto.quantum != 2 || conCosto.costoCambio != 1 ||
+        conCosto.cambiosContexto != 4 || std::fabs(conCosto.esperaPromedio - 7.0) > 1e-9 ||
+        puntos[1].cambiosContexto != 4 || std::fabs(puntos[1].esperaPromedio - 3.5) > 1e-9) {
+        std::cout << "  [ERROR] Barrido con costo de cambio: espera " << conCosto.esperaPromedio
+                  << ", cambios " << conCosto.cambiosContexto << "\n";
+        return false;
+    }
+
+    // Con costos distintos de 0, cada punto coincide con simularMulticore
+    // (Round Robin, 1 CPU, costoCambioContexto) en espera, turnaround y cambios
+    std::vector<Proceso> flujo;
+    uint32_t semilla = 2024;
+    int llegada = 0;
+    for (int k = 0; k < 30; ++k) {
+        semilla = semilla * 1103515245u + 12345u;
+        llegada += static_cast<int>((semilla >> 16) % 6);
+        flujo.push_back({ QString("P%1").arg(k + 1), 1 + static_cast<int>((semilla >> 8) % 15), llegada, 0, 0,0,0,0 });
+    }
+    for (const PuntoBarrido& punto : barridoQuantumRR(flujo, 1, 6, {1, 2, 5}, 2)) {
+        ParametrosPolitica parametros;
+        parametros.quantum = punto.quantum;
+        ConfigSMP config;
+        config.costoCambioContexto = punto.costoCambio;
+        ResultadoSMP motor = simularMulticore(flujo, Politica::RoundRobin, parametros, config);
+        if (std::fabs(punto.esperaPromedio - motor.metricas.espera.promedio) > 1e-9 ||
+            std::fabs(punto.turnaroundPromedio - motor.metricas.turnaround.promedio) > 1e-9 ||
+            punto.cambiosContexto != motor.cambiosContexto) {
+            std::cout << "  [ERROR] Barrido q=" << punto.quantum << " costo " << punto.costoCambio
+                      << " distinto del motor SMP: espera " << punto.esperaPromedio << " / "
+                      << motor.metricas.espera.promedio << ", cambios " << punto.cambiosContexto << " / "
+                      << motor.cambiosContexto << "\n";
+            return false;
+        }
+    }
+
+    // q=5 ejecuta cada proceso de una vez: mejor espera con y sin costo
+    int mejor0 = mejorPuntoBarrido(puntos, 0);
+    int mejor1 = mejorPuntoBarrido(puntos, 1);
+    if (mejor0 != 4 || mejor1 != 9 || mejorPuntoBarrido(puntos, 7) != -1 ||
+        std::fabs(puntos[mejor1].esperaPromedio - 3.0) > 1e-9) {
+        std::cout << "  [ERROR] Barrido: mejor punto " << mejor0 << " / " << mejor1 << "\n";
+        return false;
+    }
+    return true;
+}
+
+// SRT y RR event-driven: ráfagas enormes y huecos ociosos largos deben
+// resolverse por eventos (sin avanzar ciclo a ciclo) con los mismos bloques
+static bool test_event_driven_rafagas_grandes() {
+    std::vector<Proceso> procesos;
+    Proceso p1{ "P1", 50000000, 0,        1, 0,0,0,0 };
+    Proceso p2{ "P2", 10,       1000,     1, 0,0,0,0 };
+    Proceso p3{ "P3", 20,       90000000, 1, 0,0,0,0 };
+    procesos.push_back(p1);
+    procesos.push_back(p2);
+    procesos.push_back(p3);
+
+    std::vector<BloqueGantt> bloques;
+    shortestRemainingTime(procesos, bloques, nullptr);
+    std::vector<std::string> exp = { "P1@0+1000", "P2@1000+10", "P1@1010+49999000", "P3@90000000+20" };
+    std::vector<std::string> res;
+    for (auto &b : bloques) {
+        res.push_back(b.pid.toStdString() + "@" + std::to_string(b.inicio) + "+" + std::to_string(b.duracion));
+    }
+    if (!igual_seq(res, exp)) {
+        std::cout << "  [ERROR] SRT event-driven: bloques = ";
+        for (auto &x : res) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+
+    std::vector<BloqueGantt> bloquesRR;
+    auto resultRR = roundRobin(procesos, 40000000, bloquesRR, nullptr);
+    // P1 corre 40M, P2 (llegó en 1000) corre 10, P1 termina en 50000010,
+    // luego CPU ociosa hasta 90M y P3 corre sus 20 ciclos
+    if (bloquesRR.size() != 4 || bloquesRR[3].inicio != 90000000 ||
+        resultRR[0].completionTime != 50000010 || resultRR[2].completionTime != 90000020) {
+        std::cout << "  [ERROR] Round Robin event-driven: " << bloquesRR.size() << " bloques\n";
+        return false;
+    }
+    return true;
+}
+
+// priorityQueue indexada: deleteValue / decreaseKey / increaseKey por id,
+// en variantes binaria y 4-aria (max-heap vía std::greater)
+template <typename Cola>
+static bool probar_cola_indexada(Cola &cola, bool esMinimo, const char *nombre) {
+    // claves: id 0..7 -> 50, 20, 70, 10, 40, 60, 30, 80
+    int claves[] = { 50, 20, 70, 10, 40, 60, 30, 80 };
+    for (uint32_t id = 0; id < 8; id++) cola.insertNewValue(id, claves[id]);
+
+    cola.deleteValue(3);       // elimina 10
+    cola.decreaseKey(5, 5);    // 60 -> 5
+    cola.increaseKey(1, 90);   // 20 -> 90
+    bool okBorrado = !cola.deleteValue(3) && !cola.contains(3) && cola.keyOf(5) == 5;
+
+    std::vector<std::string> res;
+    while (!cola.isEmpty()) res.push_back(std::to_string(cola.pop().id));
+    std::vector<std::string> exp = esMinimo
+        ? std::vector<std::string>{ "5", "6", "4", "0", "2", "7", "1" }
+        : std::vector<std::string>{ "1", "7", "2", "0", "4", "6", "5" };
+    if (!okBorrado || !igual_seq(res, exp)) {
+        std::cout << "  [ERROR] priorityQueue " << nombre << ": orden = ";
+        for (auto &x : res) std::cout << x << " ";
+        std::cout << "\n";
+        return false;
+    }
+    return true;
+}
+
+static bool test_priority_queue_indexada() {
+    priorityQueue<int> binaria;
+    priorityQueue4<int, std::greater<int>> cuaternaria;
+    priorityQueue8<int> octal;
+    return probar_cola_indexada(binaria, true, "binaria") &&
+           probar_cola_indexada(cuaternaria, false, "4-aria") &&
+           probar_cola_indexada(octal, true, "8-aria");
+}
+
 // ---------------------------------
 // Tests para Simulación B (mutex/semaforos)
 // ---------------------------------
@@ -276,6 +2036,90 @@ int main() {
     if (test_srt_simple()) { std::cout << "  OK\n"; passed++; }
     else { std::cout << "  FAILED\n"; failed++; }
 
+    std::cout << "\n=== TEST PREEMPTIVE PRIORITY (AGING) ===\n";
+    if (test_preemptive_priority_aging()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST MLFQ ===\n";
+    if (test_mlfq()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST CFS ===\n";
+    if (test_cfs()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST LOTTERY Y STRIDE ===\n";
+    if (test_lottery_stride()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST ROUND ROBIN ADAPTATIVO ===\n";
+    if (test_rr_adaptativo()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST TIEMPO REAL (EDF / RMS) ===\n";
+    if (test_tiempo_real()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST SMP (MULTICORE) ===\n";
+    if (test_smp()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST RÁFAGAS CPU/E-S ===\n";
+    if (test_entrada_salida()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST CAMBIO DE CONTEXTO ===\n";
+    if (test_cambio_contexto()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST MÉTRICAS (PERCENTILES Y JAIN) ===\n";
+    if (test_metricas()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST COMPARACIÓN DE POLÍTICAS ===\n";
+    if (test_comparacion()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST RESULTADO COMPACTO ===\n";
+    if (test_resultado_compacto()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST PUNTOS DE CONTROL ===\n";
+    if (test_puntos_control()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST LÍNEA DE TIEMPO (RUN-LENGTH) ===\n";
+    if (test_linea_tiempo()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST PLANIFICADOR INCREMENTAL (PULL) ===\n";
+    if (test_planificador()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST RÉPLICAS MONTE CARLO ===\n";
+    if (test_replicacion()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST KERNELS DE MÉTRICAS (SoA / AVX2) ===\n";
+    if (test_kernels_metricas()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST MODELO ANALÍTICO (M/G/1) ===\n";
+    if (test_modelo_analitico()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST BARRIDO DE QUANTUM (RR) ===\n";
+    if (test_barrido_quantum()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST EVENT-DRIVEN (RÁFAGAS GRANDES) ===\n";
+    if (test_event_driven_rafagas_grandes()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
+    std::cout << "\n=== TEST PRIORITY QUEUE INDEXADA ===\n";
+    if (test_priority_queue_indexada()) { std::cout << "  OK\n"; passed++; }
+    else { std::cout << "  FAILED\n"; failed++; }
+
     std::cout << "\n=== TEST MUTEX ===\n";
     if (test_mutex_simple()) { std::cout << "  OK\n"; passed++; }
     else { std::cout << "  FAILED\n"; failed++; }